@@ -15,6 +15,7 @@
 #include <string.h>
 #include <initializer_list>
 #include <cstdint>
+#include <type_traits>
 #ifdef _MSC_VER
 #    include <stdlib.h>
 #endif
@@ -50,6 +51,12 @@
 #    define ENABLE_LOGGING
 #endif
 
+// LOG_INFO / LOG_WARNING / LOG_ERROR with a lower severity are removed at compile time (0 = Information,
+// 1 = Warning, 2 = Error) - see Log::SetMinSeverity for the run-time threshold
+#ifndef APPCUI_LOG_MIN_SEVERITY
+#    define APPCUI_LOG_MIN_SEVERITY 0
+#endif
+
 #ifdef ENABLE_LOGGING
 #    define ASSERT(c, error)                                                                                           \
         {                                                                                                              \
@@ -105,13 +112,32 @@
             return (returnValue);                                                                                      \
         }
 #    define LOG_INFO(format, ...)                                                                                      \
-        AppCUI::Log::Report(                                                                                           \
-              AppCUI::Log::Severity::Information, __FILE__, __FUNCTION__, "", __LINE__, format, ##__VA_ARGS__);
+        do                                                                                                             \
+        {                                                                                                              \
+            if constexpr (APPCUI_LOG_MIN_SEVERITY <= 0)                                                                \
+                AppCUI::Log::ReportStructured(                                                                         \
+                      AppCUI::Log::Severity::Information,                                                              \
+                      __FILE__,                                                                                        \
+                      __FUNCTION__,                                                                                    \
+                      "",                                                                                              \
+                      __LINE__,                                                                                        \
+                      format,                                                                                          \
+                      ##__VA_ARGS__);                                                                                  \
+        } while (0)
 #    define LOG_WARNING(format, ...)                                                                                   \
-        AppCUI::Log::Report(                                                                                           \
-              AppCUI::Log::Severity::Warning, __FILE__, __FUNCTION__, "", __LINE__, format, ##__VA_ARGS__);
+        do                                                                                                             \
+        {                                                                                                              \
+            if constexpr (APPCUI_LOG_MIN_SEVERITY <= 1)                                                                \
+                AppCUI::Log::ReportStructured(                                                                         \
+                      AppCUI::Log::Severity::Warning, __FILE__, __FUNCTION__, "", __LINE__, format, ##__VA_ARGS__);    \
+        } while (0)
 #    define LOG_ERROR(format, ...)                                                                                     \
-        AppCUI::Log::Report(AppCUI::Log::Severity::Error, __FILE__, __FUNCTION__, "", __LINE__, format, ##__VA_ARGS__);
+        do                                                                                                             \
+        {                                                                                                              \
+            if constexpr (APPCUI_LOG_MIN_SEVERITY <= 2)                                                                \
+                AppCUI::Log::ReportStructured(                                                                         \
+                      AppCUI::Log::Severity::Error, __FILE__, __FUNCTION__, "", __LINE__, format, ##__VA_ARGS__);      \
+        } while (0)
 #else
 inline void Unused(...)
 {
@@ -146,9 +172,19 @@ inline void Unused(...)
         {                                                                                                              \
             return (returnValue);                                                                                      \
         }
-#    define LOG_INFO(format, ...) Unused(format, ##__VA_ARGS__);
-#    define LOG_WARNING(format, ...)
-#    define LOG_ERROR(format, ...)
+#    define LOG_INFO(format, ...)                                                                                      \
+        do                                                                                                             \
+        {                                                                                                              \
+            Unused(format, ##__VA_ARGS__);                                                                             \
+        } while (0)
+#    define LOG_WARNING(format, ...)                                                                                   \
+        do                                                                                                             \
+        {                                                                                                              \
+        } while (0)
+#    define LOG_ERROR(format, ...)                                                                                     \
+        do                                                                                                             \
+        {                                                                                                              \
+        } while (0)
 #endif
 
 #define ADD_FLAG_OPERATORS(type, basic_type)                                                                           \
@@ -1948,12 +1984,20 @@ namespace Utils
     {
         const char* text;
         uint32 len;
+        uint32 index;
+        void* Data; // the IniValue that contains this array value (if any)
+
+        IniValueArray(void* data, uint32 itemIndex, string_view obj)
+            : text(obj.data()), len((uint32) obj.size()), index(itemIndex), Data(data)
+        {
+        }
+        friend class IniValue;
 
       public:
-        IniValueArray() : text(nullptr), len(0)
+        IniValueArray() : text(nullptr), len(0), index(0), Data(nullptr)
         {
         }
-        IniValueArray(string_view obj) : text(obj.data()), len((uint32) obj.size())
+        IniValueArray(string_view obj) : text(obj.data()), len((uint32) obj.size()), index(0), Data(nullptr)
         {
         }
 
@@ -1963,10 +2007,7 @@ namespace Utils
         optional<int32> AsInt32() const;
         optional<bool> AsBool() const;
         optional<Input::Key> AsKey() const;
-        inline optional<const char*> AsString() const
-        {
-            return text;
-        }
+        optional<const char*> AsString() const;
         inline optional<string_view> AsStringView() const
         {
             return string_view(text, len);
@@ -2148,10 +2189,32 @@ namespace Utils
 
         bool CreateFromString(string_view text);
         bool CreateFromFile(const std::filesystem::path& fileName);
+        /**
+         * Writes the ini object into a file. If the object was loaded (or previously saved) only the changed
+         * values and sections are rewritten - comments and layout of the original text are preserved. If nothing
+         * was changed since the last save of the same file, the file is not written at all.
+         */
         bool Save(const std::filesystem::path& fileName);
         bool Create();
         void Clear();
 
+        /**
+         * Saves the ini object into a file after it was not changed for a period of time (a burst of changes
+         * is written only once). The pending changes are checked by ProcessAutoSave.
+         * @param[in] fileName is the file where the object is saved.
+         * @param[in] delayMilliseconds is the time that has to pass from the last change until the file is saved.
+         */
+        bool EnableAutoSave(const std::filesystem::path& fileName, uint32 delayMilliseconds);
+        /**
+         * Saves the pending changes (if any) and stops the auto-save.
+         */
+        bool DisableAutoSave();
+        /**
+         * Saves the object if the auto-save is enabled and the delay has passed since the last change (or
+         * immediately if saveNow is true). Returns false only if the object has to be saved and the save fails.
+         */
+        bool ProcessAutoSave(bool saveNow = false);
+
         bool HasSection(string_view name) const;
         IniSection GetSection(string_view name);
         IniSection CreateSection(string_view name, bool emptyContent);
@@ -2185,6 +2248,15 @@ namespace OS
         static bool Clear();
         static bool HasText();
     };
+    /**
+     * One of the buffers of a scatter read (ReadVector).
+     */
+    struct IOBuffer
+    {
+        void* Data;
+        uint32 Size;
+    };
+
     class EXPORT DataObject
     {
       protected:
@@ -2202,6 +2274,22 @@ namespace OS
         virtual bool SetCurrentPos(uint64 newPosition);
         virtual void Close();
 
+        /**
+         * Reads the data from offset into several buffers (each buffer is filled before the next one). The current
+         * position is not changed.
+         * @param[in] offset is the offset of the first byte that is read.
+         * @param[in] buffers is the list of buffers to fill.
+         * @param[in] count is the number of buffers.
+         * @param[out] bytesRead is the total number of bytes that were read (less than the total size of the buffers
+         * only if the end of the data was reached).
+         */
+        virtual bool ReadVector(uint64 offset, const IOBuffer* buffers, uint32 count, uint64& bytesRead);
+        /**
+         * Writes the content of several buffers (one after another) from offset. The current position is not
+         * changed.
+         */
+        virtual bool WriteVector(uint64 offset, const Utils::BufferView* buffers, uint32 count, uint64& bytesWritten);
+
         // read methods
         bool Read(void* buffer, uint32 bufferSize, uint32& bytesRead);
         bool Read(void* buffer, uint32 bufferSize);
@@ -2276,10 +2364,22 @@ namespace OS
         bool SetSize(uint64 newSize) override;
         bool SetCurrentPos(uint64 newPosition) override;
         void Close() override;
+        bool ReadVector(uint64 offset, const IOBuffer* buffers, uint32 count, uint64& bytesRead) override;
+        bool WriteVector(uint64 offset, const Utils::BufferView* buffers, uint32 count, uint64& bytesWritten) override;
+        /**
+         * Writes the data from the system buffers to the disk.
+         */
+        bool Flush();
 
         static Utils::Buffer ReadContent(const std::filesystem::path& path);
         static bool WriteContent(const std::filesystem::path& path, Utils::BufferView buf);
         static bool WriteContent(const std::filesystem::path& path, string_view text);
+        /**
+         * Writes the text into a temporary file (from the same folder) that is renamed over the file. The file
+         * always has either the old or the new content (it is never partially written).
+         * @param[in] path is the full path of the file (it is created if it does not exist).
+         */
+        static bool ReplaceContent(const std::filesystem::path& path, string_view text);
     };
 
     class EXPORT MemoryFile : public DataObject
@@ -2307,6 +2407,181 @@ namespace OS
         void Close() override;
     };
 
+    enum class AccessPattern : uint32
+    {
+        Normal = 0,
+        Sequential, // the data is read from the begining to the end (the next pages are read in advance)
+        Random      // the data is read in a random order (only the pages that are accessed are read)
+    };
+
+    /**
+     * A read-only file whose content is accessed through a memory mapping of the file. The data can be read like
+     * from any other DataObject (by copying it into a buffer) or without any copy with GetView.
+     * When the file is larger than the address space budget, only a window of the file (of at most the budget size)
+     * is mapped. The window slides over the file when the data outside of it is accessed.
+     */
+    class EXPORT MappedFile : public DataObject
+    {
+        union
+        {
+            void* Handle;
+            int fid;
+        } FileID;
+        void* mappingHandle;
+        const uint8* window;
+        uint64 windowStart;
+        uint64 windowSize;
+        uint64 maxWindowSize;
+        uint64 fileSize;
+        uint64 pos;
+        AccessPattern accessPattern;
+
+        static uint64 GetMappingAlignment();
+        bool OpenFile(const std::filesystem::path& filePath);
+        void CloseFile();
+        bool MapWindow(uint64 start, uint64 size);
+        void UnmapWindow();
+        void ApplyAccessPattern();
+        bool MoveWindow(uint64 offset);
+
+      protected:
+        bool ReadBuffer(void* buffer, uint32 bufferSize, uint32& bytesRead) override;
+        bool WriteBuffer(const void* buffer, uint32 bufferSize, uint32& bytesWritten) override;
+
+      public:
+        MappedFile();
+        ~MappedFile();
+
+        /**
+         * Opens and maps an existing file for read.
+         * @param[in] filePath is the full path to an existing file.
+         * @param[in] addressSpaceBudget is the maximum size of the mapped window (0 for the default budget - large
+         * enough to map any file on a 64-bit system and 256 MB on a 32-bit one).
+         */
+        bool Open(const std::filesystem::path& filePath, uint64 addressSpaceBudget = 0);
+        /**
+         * Returns a view (without any copy) over the mapped file. The view is shorter than size if the range
+         * exceeds the end of the file or if it is larger than the address space budget. The view is valid until the
+         * next call of GetView, Read or Close. The file must not be truncated by another process while it is
+         * mapped.
+         * @param[in] offset is the offset in the file of the first byte of the view.
+         * @param[in] size is the size of the view.
+         */
+        Utils::BufferView GetView(uint64 offset, uint32 size);
+        /**
+         * Tells the operating system how the file will be read (the hint is applied to the mapped window).
+         */
+        bool SetAccessPattern(AccessPattern pattern);
+        inline AccessPattern GetAccessPattern() const
+        {
+            return accessPattern;
+        }
+
+        uint64 GetSize() override;
+        uint64 GetCurrentPos() override;
+        bool SetSize(uint64 newSize) override;
+        bool SetCurrentPos(uint64 newPosition) override;
+        void Close() override;
+    };
+
+    struct OnAsyncReadCompletedInterface
+    {
+        /**
+         * Called on the UI thread (from the application loop) when an asynchronous read is completed.
+         * @param[in] requestID is the value returned by AsyncReader::Read.
+         * @param[in] offset is the offset of the data.
+         * @param[in] data is the data that was read (shorter than the requested size if the end of the data was
+         * reached). The view is valid only during this call.
+         * @param[in] succeeded is false if the data could not be read.
+         */
+        virtual void OnAsyncReadCompleted(uint64 requestID, uint64 offset, Utils::BufferView data, bool succeeded) = 0;
+    };
+
+    /**
+     * Reads a DataObject on a background thread (from a small pool shared by all readers). The requests of a reader
+     * are processed in order (one at a time) and their results are delivered on the UI thread through the handler.
+     * The reader must be used from the UI thread and the data object must not be used directly while it has pending
+     * requests. Destroying (or closing) the reader cancels its requests.
+     */
+    class EXPORT AsyncReader
+    {
+        void* data;
+
+      public:
+        AsyncReader();
+        ~AsyncReader();
+
+        bool Create(DataObject* dataObject, OnAsyncReadCompletedInterface* handler);
+        /**
+         * Schedules a read of size bytes from offset and returns the ID of the request (0 if the request could not be
+         * scheduled).
+         */
+        uint64 Read(uint64 offset, uint32 size);
+        /**
+         * Cancels a request (its handler will not be called). A read that already started is finished, but its result
+         * is ignored.
+         */
+        bool Cancel(uint64 requestID);
+        uint32 GetPendingRequestsCount() const;
+        /**
+         * Cancels all requests and waits for the read that is in progress (if any) to finish.
+         */
+        void Close();
+
+        /**
+         * Calls the handlers of the completed reads and returns the number of handlers that were called. It is
+         * called by the application loop (it is only needed by the applications that do not use it).
+         */
+        static uint32 ProcessCompletions();
+    };
+
+    /**
+     * A read-only cache over another DataObject. The data is read in fixed-size pages that are kept in memory (the
+     * least recently used page is replaced when the cache is full) and consecutive pages are read in advance when
+     * the data is read sequentially. Many small reads of the same area (a viewer that reads the visible data on
+     * every paint) need only one read of the underlying object per page.
+     */
+    class EXPORT CachedDataObject : public DataObject
+    {
+        void* data;
+        uint64 pos;
+
+      protected:
+        bool ReadBuffer(void* buffer, uint32 bufferSize, uint32& bytesRead) override;
+        bool WriteBuffer(const void* buffer, uint32 bufferSize, uint32& bytesWritten) override;
+
+      public:
+        static constexpr uint32 DEFAULT_PAGE_SIZE   = 0x10000;
+        static constexpr uint32 DEFAULT_PAGES_COUNT = 64;
+
+        CachedDataObject();
+        ~CachedDataObject();
+
+        /**
+         * @param[in] dataObject is the object whose data is cached (it must not be used directly while it is cached).
+         * @param[in] pageSize is the size of a page (at least 512 bytes).
+         * @param[in] pagesCount is the number of pages that are kept in memory (at least 2).
+         */
+        bool Create(
+              DataObject* dataObject, uint32 pageSize = DEFAULT_PAGE_SIZE, uint32 pagesCount = DEFAULT_PAGES_COUNT);
+        /**
+         * Returns a view over the data. If the range is inside a page the view points into the cache (no copy),
+         * otherwise the data is copied into an internal buffer. The view is shorter than size if the range exceeds
+         * the end of the data and it is valid until the next call of GetView, Read, Invalidate or Close.
+         */
+        Utils::BufferView GetView(uint64 offset, uint32 size);
+        /**
+         * Drops all cached pages and reads the size of the data again (for an object that was changed).
+         */
+        void Invalidate();
+
+        uint64 GetSize() override;
+        uint64 GetCurrentPos() override;
+        bool SetSize(uint64 newSize) override;
+        bool SetCurrentPos(uint64 newPosition) override;
+        void Close() override;
+    };
+
     class EXPORT DateTime
     {
         uint32 year, month, day, hour, minute, second;
@@ -2391,6 +2666,29 @@ namespace OS
     EXPORT void GetSpecialFolders(SpecialFolderMap& specialFolders, RootsVector& roots);
     EXPORT std::filesystem::path GetCurrentApplicationPath();
 
+    struct DirectoryEntry
+    {
+        std::u16string Name;
+        uint64 Size;
+        uint64 ModifiedTime; // seconds since 1970-01-01 (UTC)
+        bool IsFolder;
+    };
+    using DirectoryEntries = vector<DirectoryEntry>;
+
+    // listings of the most recently used directories (shared by the whole application, FileDialog included)
+    // a listing is dropped as soon as its directory changes (inotify on Linux, the modified time of the directory on
+    // other systems)
+    namespace DirectoryCache
+    {
+        constexpr uint32 DEFAULT_CAPACITY = 16;
+
+        // entries of a directory (read and added to the cache if needed) or nullptr if the directory can not be read
+        EXPORT std::shared_ptr<const DirectoryEntries> GetEntries(const std::filesystem::path& path);
+        EXPORT void Invalidate(const std::filesystem::path& path);
+        EXPORT void Clear();
+        EXPORT void SetCapacity(uint32 directories);
+    } // namespace DirectoryCache
+
 } // namespace OS
 namespace Graphics
 {
@@ -2777,18 +3075,21 @@ namespace Graphics
         Pixel* pixels;
         uint32 width;
         uint32 height;
+        uint64 generation;
 
       public:
         Image();
         Image(const Image& img);
         Image(Image&& img) noexcept
         {
-            this->width  = img.width;
-            this->height = img.height;
-            this->pixels = img.pixels;
-            img.pixels   = nullptr;
-            img.width    = 0;
-            img.height   = 0;
+            this->width      = img.width;
+            this->height     = img.height;
+            this->pixels     = img.pixels;
+            this->generation = img.generation;
+            img.pixels       = nullptr;
+            img.width        = 0;
+            img.height       = 0;
+            img.generation   = 0;
         }
         ~Image();
         bool Load(const std::filesystem::path& imageFilePath);
@@ -2826,19 +3127,69 @@ namespace Graphics
         {
             return height;
         }
-        inline Pixel* GetPixelsBuffer() const
+        inline const Pixel* GetPixelsBuffer() const
         {
             return pixels;
         }
+        /**
+         * The pixels can be modified through the returned buffer, so the image is considered modified (a new
+         * generation) by this call. Call it again after the buffer was modified if the image was drawn meanwhile.
+         */
+        Pixel* GetPixelsBuffer();
+        /**
+         * A value that is unique for every image and changes every time its pixels are modified (Create, Load,
+         * SetPixel, Clear, GetPixelsBuffer, ...). Two identical generations mean identical pixels.
+         */
+        inline uint64 GetGeneration() const
+        {
+            return generation;
+        }
         Image& operator=(const Image& img);
         Image& operator=(Image&& img) noexcept
         {
             std::swap(this->pixels, img.pixels);
             std::swap(this->width, img.width);
             std::swap(this->height, img.height);
+            std::swap(this->generation, img.generation);
             return *this;
         }
     };
+    // An image that is too large to be kept in memory (e.g. 30000 x 20000 pixels). The pixels are read in tiles
+    // of TILE_SIZE x TILE_SIZE pixels, only for the regions that are requested, and the tiles are kept in a LRU
+    // cache limited by a memory budget. Every level L halves the size of the previous one: a pixel (x,y) of level L
+    // is the pixel (x * 2^L, y * 2^L) of the image, so that a zoomed out view only reads a few pixels per tile.
+    class EXPORT TiledImage
+    {
+        void* context;
+
+      public:
+        static constexpr uint32 TILE_SIZE             = 256;
+        static constexpr uint64 DEFAULT_MEMORY_BUDGET = 256ULL * 1024ULL * 1024ULL;
+
+        TiledImage();
+        TiledImage(const TiledImage&) = delete;
+        TiledImage(TiledImage&& img) noexcept;
+        ~TiledImage();
+        TiledImage& operator=(const TiledImage&) = delete;
+        TiledImage& operator=(TiledImage&& img) noexcept;
+
+        // uncompressed bitmaps (8, 24 or 32 bits/pixel) are memory mapped and the tiles are read straight from
+        // the file - any other image is decoded in memory first
+        bool Load(const std::filesystem::path& imageFilePath);
+        bool Create(Image&& img);
+        void Close();
+
+        bool SetMemoryBudget(uint64 bytes);
+        uint64 GetMemoryUsage() const;
+        uint32 GetWidth() const;
+        uint32 GetHeight() const;
+        uint32 GetLevelWidth(uint32 level) const;
+        uint32 GetLevelHeight(uint32 level) const;
+        bool IsValid() const;
+
+        // copies the [x, x + width) x [y, y + height) pixels of a level into result
+        bool GetRegion(uint32 x, uint32 y, uint32 width, uint32 height, uint32 level, Image& result);
+    };
     enum class LineType : uint8
     {
         Single = 0,
@@ -2971,10 +3322,18 @@ namespace Graphics
               int y,
               ImageRenderingMethod method = ImageRenderingMethod::PixelTo16ColorsSmallBlock,
               ImageScaleMethod scale      = ImageScaleMethod::NoScale);
+        bool DrawImage(
+              const Image& img,
+              int x,
+              int y,
+              uint32 width,
+              uint32 height,
+              ImageRenderingMethod method = ImageRenderingMethod::PixelTo16ColorsSmallBlock);
         Size ComputeRenderingSize(
               const Image& img,
               ImageRenderingMethod method = ImageRenderingMethod::PixelTo16ColorsSmallBlock,
               ImageScaleMethod scale      = ImageScaleMethod::NoScale);
+        Size ComputeRenderingSize(const Image& img, ImageRenderingMethod method, double scale);
     };
 
     class EXPORT Canvas : public Renderer
@@ -3023,6 +3382,37 @@ namespace Graphics
         }
     };
 
+    // frames of a video or of an animation (played by a VideoView)
+    class EXPORT FrameSource
+    {
+      public:
+        virtual ~FrameSource() = default;
+        virtual uint32 GetFramesCount() = 0;
+        // draws the frame in the canvas (resizing it if needed) - called from the thread that decodes the frames
+        virtual bool DrawFrame(uint32 index, Canvas& frame) = 0;
+    };
+
+    // a screen recording (see Application::Recorder) - any frame can be drawn, starting from the closest key frame
+    class EXPORT ScreenRecording : public FrameSource
+    {
+        void* context;
+
+      public:
+        ScreenRecording();
+        ScreenRecording(const ScreenRecording&) = delete;
+        ~ScreenRecording();
+        ScreenRecording& operator=(const ScreenRecording&) = delete;
+
+        bool Open(const std::filesystem::path& path);
+        void Close();
+        uint32 GetFramesCount() override;
+        // microseconds since the recording started
+        uint64 GetFrameTime(uint32 index);
+        // the frame that was on the screen at a specific time
+        uint32 FindFrame(uint64 time);
+        bool DrawFrame(uint32 index, Canvas& frame) override;
+    };
+
 }; // namespace Graphics
 namespace Controls
 {
@@ -3041,6 +3431,7 @@ namespace Controls
         class EXPORT Tab;
         class EXPORT CanvasViewer;
         class EXPORT ImageView;
+        class EXPORT VideoView;
         class EXPORT ListView;
         class EXPORT ComboBox;
         class EXPORT NumericSelector;
@@ -3611,6 +4002,238 @@ namespace Controls
 
     } // namespace Handlers
 
+    // A layout string parsed at compile time, built with the _layout literal:
+    //     Factory::Button::Create(this, "&OK", "x:1,y:2,w:15"_layout, 100);
+    // An invalid layout does not compile. Every control constructor accepts it (see ConstLayout).
+    struct PrecompiledLayout
+    {
+        static constexpr uint16 FIELD_X      = 0x0001;
+        static constexpr uint16 FIELD_Y      = 0x0002;
+        static constexpr uint16 FIELD_LEFT   = 0x0004;
+        static constexpr uint16 FIELD_RIGHT  = 0x0008;
+        static constexpr uint16 FIELD_TOP    = 0x0010;
+        static constexpr uint16 FIELD_BOTTOM = 0x0020;
+        static constexpr uint16 FIELD_WIDTH  = 0x0040;
+        static constexpr uint16 FIELD_HEIGHT = 0x0080;
+        static constexpr uint16 FIELD_ALIGN  = 0x0100;
+        static constexpr uint16 FIELD_DOCK   = 0x0200;
+
+        struct Value
+        {
+            int16 Number; // for percentages: value * 100 (50% = 5000)
+            bool IsPercentage;
+        };
+
+        uint16 Fields;
+        Value X, Y, Left, Right, Top, Bottom, Width, Height;
+        Graphics::Alignament Align, Dock;
+
+        consteval PrecompiledLayout(const char* text, size_t size)
+            : Fields(0), X{ 0, false }, Y{ 0, false }, Left{ 0, false }, Right{ 0, false }, Top{ 0, false },
+              Bottom{ 0, false }, Width{ 1, false }, Height{ 1, false }, Align(Graphics::Alignament::TopLeft),
+              Dock(Graphics::Alignament::TopLeft)
+        {
+            const char* end = text + size;
+            while (text < end)
+            {
+                // <key> (':' or '=') <value> [(',' or ';')]
+                const char* key = text;
+                while ((text < end) && (*text != ':') && (*text != '='))
+                    text++;
+                if (text >= end)
+                    throw "Layout: expecting a 'key:value' pair";
+                const char* keyEnd = text++;
+                const char* value  = text;
+                while ((text < end) && (*text != ',') && (*text != ';'))
+                    text++;
+                const char* valueEnd = text;
+                if (text < end)
+                    text++;
+                Trim(key, keyEnd);
+                Trim(value, valueEnd);
+                if (value == valueEnd)
+                    throw "Layout: missing value";
+
+                if (Is(key, keyEnd, "x"))
+                    SetValue(X, FIELD_X, value, valueEnd);
+                else if (Is(key, keyEnd, "y"))
+                    SetValue(Y, FIELD_Y, value, valueEnd);
+                else if (Is(key, keyEnd, "l") || Is(key, keyEnd, "left"))
+                    SetValue(Left, FIELD_LEFT, value, valueEnd);
+                else if (Is(key, keyEnd, "r") || Is(key, keyEnd, "right"))
+                    SetValue(Right, FIELD_RIGHT, value, valueEnd);
+                else if (Is(key, keyEnd, "t") || Is(key, keyEnd, "top"))
+                    SetValue(Top, FIELD_TOP, value, valueEnd);
+                else if (Is(key, keyEnd, "b") || Is(key, keyEnd, "bottom"))
+                    SetValue(Bottom, FIELD_BOTTOM, value, valueEnd);
+                else if (Is(key, keyEnd, "w") || Is(key, keyEnd, "width"))
+                    SetValue(Width, FIELD_WIDTH, value, valueEnd);
+                else if (Is(key, keyEnd, "h") || Is(key, keyEnd, "height"))
+                    SetValue(Height, FIELD_HEIGHT, value, valueEnd);
+                else if (Is(key, keyEnd, "a") || Is(key, keyEnd, "align"))
+                {
+                    Align = ToAlignament(value, valueEnd);
+                    Fields |= FIELD_ALIGN;
+                }
+                else if (Is(key, keyEnd, "d") || Is(key, keyEnd, "dock"))
+                {
+                    Dock = ToAlignament(value, valueEnd);
+                    Fields |= FIELD_DOCK;
+                }
+                else
+                    throw "Layout: unknown layout item";
+            }
+            Validate();
+        }
+
+      private:
+        // same keys combinations that ControlContext::UpdateLayoutFormat accepts
+        consteval void Validate() const
+        {
+            constexpr uint16 ANCHORS = FIELD_LEFT | FIELD_RIGHT | FIELD_TOP | FIELD_BOTTOM;
+            if (Fields & FIELD_DOCK)
+            {
+                if (Fields & (ANCHORS | FIELD_X | FIELD_Y | FIELD_ALIGN))
+                    throw "Layout: dock can not be combined with (x,y), anchors or align";
+                return;
+            }
+            if ((Fields & (FIELD_X | FIELD_Y)) == (FIELD_X | FIELD_Y))
+            {
+                if (Fields & ANCHORS)
+                    throw "Layout: (x,y) can not be combined with anchors";
+                return;
+            }
+            switch (Fields & ANCHORS)
+            {
+            case FIELD_LEFT | FIELD_TOP:
+            case FIELD_RIGHT | FIELD_TOP:
+            case FIELD_RIGHT | FIELD_BOTTOM:
+            case FIELD_LEFT | FIELD_BOTTOM:
+                if (Fields & (FIELD_X | FIELD_Y))
+                    throw "Layout: a corner anchor can not be combined with x or y";
+                return;
+            case FIELD_LEFT | FIELD_RIGHT:
+                if (Fields & (FIELD_X | FIELD_WIDTH))
+                    throw "Layout: (left,right) can not be combined with x or width";
+                if ((Fields & FIELD_ALIGN) && (Align != Graphics::Alignament::Top) &&
+                    (Align != Graphics::Alignament::Center) && (Align != Graphics::Alignament::Bottom))
+                    throw "Layout: (left,right) only allows top, center or bottom alignament";
+                return;
+            case FIELD_TOP | FIELD_BOTTOM:
+                if (Fields & (FIELD_Y | FIELD_HEIGHT))
+                    throw "Layout: (top,bottom) can not be combined with y or height";
+                if ((Fields & FIELD_ALIGN) && (Align != Graphics::Alignament::Left) &&
+                    (Align != Graphics::Alignament::Center) && (Align != Graphics::Alignament::Right))
+                    throw "Layout: (top,bottom) only allows left, center or right alignament";
+                return;
+            case FIELD_LEFT | FIELD_TOP | FIELD_RIGHT:
+            case FIELD_LEFT | FIELD_BOTTOM | FIELD_RIGHT:
+                if (Fields & (FIELD_X | FIELD_Y | FIELD_ALIGN | FIELD_WIDTH))
+                    throw "Layout: three anchors can not be combined with x, y, align or the deduced size";
+                return;
+            case FIELD_TOP | FIELD_LEFT | FIELD_BOTTOM:
+            case FIELD_TOP | FIELD_RIGHT | FIELD_BOTTOM:
+                if (Fields & (FIELD_X | FIELD_Y | FIELD_ALIGN | FIELD_HEIGHT))
+                    throw "Layout: three anchors can not be combined with x, y, align or the deduced size";
+                return;
+            case ANCHORS:
+                if (Fields & (FIELD_X | FIELD_Y | FIELD_ALIGN | FIELD_WIDTH | FIELD_HEIGHT))
+                    throw "Layout: (left,top,right,bottom) can not be combined with x, y, align, width or height";
+                return;
+            }
+            throw "Layout: invalid keys combination";
+        }
+        static consteval void Trim(const char*& s, const char*& e)
+        {
+            while ((s < e) && ((*s == ' ') || (*s == '\t')))
+                s++;
+            while ((e > s) && ((e[-1] == ' ') || (e[-1] == '\t')))
+                e--;
+        }
+        static consteval bool Is(const char* s, const char* e, const char* name)
+        {
+            for (; (s < e) && (*name); s++, name++)
+                if ((((*s) >= 'A') && ((*s) <= 'Z') ? (*s) | 0x20 : (*s)) != (*name))
+                    return false;
+            return (s == e) && ((*name) == 0);
+        }
+        consteval void SetValue(Value& v, uint16 field, const char* s, const char* e)
+        {
+            bool negative = false;
+            int32 number  = 0;
+            if ((*s) == '-')
+            {
+                negative = true;
+                s++;
+            }
+            if ((s >= e) || ((*s) < '0') || ((*s) > '9'))
+                throw "Layout: expecting a valid number or percentage";
+            while ((s < e) && ((*s) >= '0') && ((*s) <= '9'))
+            {
+                number = number * 10 + (int32) ((*s) - '0');
+                if (number > 30000)
+                    throw "Layout: values must be within [-30000..30000] (or [-300%..300%])";
+                s++;
+            }
+            // percentages can have up to two decimals (12.75% is stored as 1275)
+            int32 decimals = 0;
+            if ((s < e) && ((*s) == '.'))
+            {
+                s++;
+                for (auto cnt = 0; cnt < 2; cnt++)
+                {
+                    decimals *= 10;
+                    if ((s < e) && ((*s) >= '0') && ((*s) <= '9'))
+                        decimals += (int32) ((*(s++)) - '0');
+                }
+                if ((s < e) && ((*s) >= '0') && ((*s) <= '9'))
+                    throw "Layout: percentages can have at most two decimals";
+                if ((s >= e) || ((*s) != '%'))
+                    throw "Layout: only percentages can have decimals";
+            }
+            v.IsPercentage = (s < e) && ((*s) == '%');
+            if (v.IsPercentage)
+            {
+                number = number * 100 + decimals;
+                s++;
+            }
+            if (s != e)
+                throw "Layout: expecting a valid number or percentage";
+            if (number > 30000)
+                throw "Layout: values must be within [-30000..30000] (or [-300%..300%])";
+            v.Number = (int16) (negative ? -number : number);
+            Fields |= field;
+        }
+        static consteval Graphics::Alignament ToAlignament(const char* s, const char* e)
+        {
+            if (Is(s, e, "tl") || Is(s, e, "lt") || Is(s, e, "topleft") || Is(s, e, "lefttop"))
+                return Graphics::Alignament::TopLeft;
+            if (Is(s, e, "t") || Is(s, e, "top"))
+                return Graphics::Alignament::Top;
+            if (Is(s, e, "tr") || Is(s, e, "rt") || Is(s, e, "topright") || Is(s, e, "righttop"))
+                return Graphics::Alignament::TopRight;
+            if (Is(s, e, "r") || Is(s, e, "right"))
+                return Graphics::Alignament::Right;
+            if (Is(s, e, "br") || Is(s, e, "rb") || Is(s, e, "bottomright") || Is(s, e, "rightbottom"))
+                return Graphics::Alignament::BottomRight;
+            if (Is(s, e, "b") || Is(s, e, "bottom"))
+                return Graphics::Alignament::Bottom;
+            if (Is(s, e, "bl") || Is(s, e, "lb") || Is(s, e, "bottomleft") || Is(s, e, "leftbottom"))
+                return Graphics::Alignament::BottomLeft;
+            if (Is(s, e, "l") || Is(s, e, "left"))
+                return Graphics::Alignament::Left;
+            if (Is(s, e, "c") || Is(s, e, "center"))
+                return Graphics::Alignament::Center;
+            throw "Layout: unknown align/dock value";
+        }
+    };
+    consteval PrecompiledLayout operator""_layout(const char* text, size_t size)
+    {
+        return PrecompiledLayout(text, size);
+    }
+    // the layout of a control - a string (parsed when the control is created) or a precompiled layout
+    using ConstLayout = variant<string_view, PrecompiledLayout>;
+
     class EXPORT Control
     {
       public:
@@ -3631,7 +4254,7 @@ namespace Controls
         Reference<Control> AddChildControl(unique_ptr<Control> control);
 
         // protected constructor
-        Control(void* context, const ConstString& caption, string_view layout, bool computeHotKey);
+        Control(void* context, const ConstString& caption, const ConstLayout& layout, bool computeHotKey);
 
       public:
         template <typename T>
@@ -3822,7 +4445,7 @@ namespace Controls
         bool ProcessControlBarItem(uint32 index);
 
       protected:
-        Window(const ConstString& caption, string_view layout, WindowFlags windowsFlags);
+        Window(const ConstString& caption, const ConstLayout& layout, WindowFlags windowsFlags);
 
       public:
         void Paint(Graphics::Renderer& renderer) override;
@@ -3859,7 +4482,7 @@ namespace Controls
     };
     class EXPORT Label : public Control
     {
-        Label(const ConstString& caption, string_view layout);
+        Label(const ConstString& caption, const ConstLayout& layout);
 
       public:
         void Paint(Graphics::Renderer& renderer) override;
@@ -3874,7 +4497,7 @@ namespace Controls
     class EXPORT Button : public Control
     {
       protected:
-        Button(const ConstString& caption, string_view layout, int controlID, ButtonFlags flags);
+        Button(const ConstString& caption, const ConstLayout& layout, int controlID, ButtonFlags flags);
 
       public:
         void OnMousePressed(int x, int y, Input::MouseButton button) override;
@@ -3895,7 +4518,7 @@ namespace Controls
     class EXPORT CheckBox : public Control
     {
       protected:
-        CheckBox(const ConstString& caption, string_view layout, int controlID);
+        CheckBox(const ConstString& caption, const ConstLayout& layout, int controlID);
 
       public:
         void OnMouseReleased(int x, int y, Input::MouseButton button) override;
@@ -3914,7 +4537,7 @@ namespace Controls
     class EXPORT RadioBox : public Control
     {
       protected:
-        RadioBox(const ConstString& caption, string_view layout, int groupID, int controlID, bool checked);
+        RadioBox(const ConstString& caption, const ConstLayout& layout, int groupID, int controlID, bool checked);
 
       public:
         void OnMouseReleased(int x, int y, Input::MouseButton button) override;
@@ -3940,7 +4563,7 @@ namespace Controls
     class EXPORT Splitter : public Control
     {
       protected:
-        Splitter(string_view layout, SplitterFlags flags = SplitterFlags::Horizontal);
+        Splitter(const ConstLayout& layout, SplitterFlags flags = SplitterFlags::Horizontal);
 
       public:
         void Paint(Graphics::Renderer& renderer) override;
@@ -3976,7 +4599,7 @@ namespace Controls
     class EXPORT Password : public Control
     {
       protected:
-        Password(const ConstString& caption, string_view layout);
+        Password(const ConstString& caption, const ConstLayout& layout);
 
       public:
         void OnMousePressed(int x, int y, Input::MouseButton button) override;
@@ -3993,7 +4616,7 @@ namespace Controls
     class EXPORT Panel : public Control
     {
       protected:
-        Panel(const ConstString& caption, string_view layout);
+        Panel(const ConstString& caption, const ConstLayout& layout);
 
       public:
         void Paint(Graphics::Renderer& renderer) override;
@@ -4012,7 +4635,7 @@ namespace Controls
     class EXPORT TextField : public Control
     {
       protected:
-        TextField(const ConstString& caption, string_view layout, TextFieldFlags flags);
+        TextField(const ConstString& caption, const ConstLayout& layout, TextFieldFlags flags);
 
       public:
         bool OnKeyEvent(Input::Key keyCode, char16 UnicodeChar) override;
@@ -4059,7 +4682,7 @@ namespace Controls
     class EXPORT TextArea : public Control
     {
       protected:
-        TextArea(const ConstString& caption, string_view layout, TextAreaFlags flags);
+        TextArea(const ConstString& caption, const ConstLayout& layout, TextAreaFlags flags);
 
       public:
         void Paint(Graphics::Renderer& renderer) override;
@@ -4110,7 +4733,7 @@ namespace Controls
     class EXPORT Tab : public Control
     {
       protected:
-        Tab(string_view layout, TabFlags flags, uint32 tabPageSize);
+        Tab(const ConstLayout& layout, TabFlags flags, uint32 tabPageSize);
 
       public:
         bool SetCurrentTabPageByIndex(uint32 index, bool setFocus = false);
@@ -4148,8 +4771,9 @@ namespace Controls
     class EXPORT UserControl : public Control
     {
       protected:
-        UserControl(const ConstString& caption, string_view layout, UserControlFlags flags = UserControlFlags::None);
-        UserControl(string_view layout, UserControlFlags flags = UserControlFlags::None);
+        UserControl(
+              const ConstString& caption, const ConstLayout& layout, UserControlFlags flags = UserControlFlags::None);
+        UserControl(const ConstLayout& layout, UserControlFlags flags = UserControlFlags::None);
     };
     enum class ViewerFlags : uint32
     {
@@ -4163,7 +4787,14 @@ namespace Controls
       protected:
         CanvasViewer(
               const ConstString& caption,
-              string_view layout,
+              const ConstLayout& layout,
+              uint32 canvasWidth,
+              uint32 canvasHeight,
+              ViewerFlags flags);
+        CanvasViewer(
+              void* context,
+              const ConstString& caption,
+              const ConstLayout& layout,
               uint32 canvasWidth,
               uint32 canvasHeight,
               ViewerFlags flags);
@@ -4187,15 +4818,53 @@ namespace Controls
     class EXPORT ImageView : public CanvasViewer
     {
       protected:
-        ImageView(const ConstString& caption, string_view layout, ViewerFlags flags);
+        ImageView(const ConstString& caption, const ConstLayout& layout, ViewerFlags flags);
 
       public:
+        ~ImageView();
         bool SetImage(
               const Graphics::Image& img, Graphics::ImageRenderingMethod method, Graphics::ImageScaleMethod scale);
+        bool SetImage(const Graphics::Image& img, Graphics::ImageRenderingMethod method, double scale);
+        bool SetImage(Graphics::TiledImage&& img, Graphics::ImageRenderingMethod method, double scale);
+        bool SetScale(double scale);
+        bool ScaleToFit();
+        double GetScale() const;
+
+        void Paint(Graphics::Renderer& renderer) override;
+        bool OnKeyEvent(Input::Key keyCode, char16 UnicodeChar) override;
+        void OnAfterResize(int newWidth, int newHeight) override;
 
         friend Factory::ImageView;
         friend Control;
     };
+    class EXPORT VideoView : public CanvasViewer
+    {
+      protected:
+        VideoView(const ConstString& caption, const ConstLayout& layout, ViewerFlags flags);
+
+      public:
+        ~VideoView();
+        bool SetFrames(std::unique_ptr<Graphics::FrameSource> source, uint32 framesPerSecond);
+        bool SetFrames(
+              std::vector<Graphics::Image>&& images,
+              Graphics::ImageRenderingMethod method,
+              Graphics::ImageScaleMethod scale,
+              uint32 framesPerSecond);
+        bool Play();
+        void Pause();
+        void Stop();
+        void SetLoop(bool loop);
+        bool IsPlaying() const;
+        uint32 GetFramesCount() const;
+        uint32 GetCurrentFrame() const;
+        uint64 GetDroppedFramesCount() const;
+
+        bool OnFrameUpdate() override;
+        bool OnKeyEvent(Input::Key keyCode, char16 UnicodeChar) override;
+
+        friend Factory::VideoView;
+        friend Control;
+    };
 
     class EXPORT Column
     {
@@ -4261,8 +4930,8 @@ namespace Controls
 
       protected:
         ColumnsHeaderView(
-              string_view layout, std::initializer_list<ConstString> columnsList, ColumnsHeaderViewFlags flags);
-        ColumnsHeaderView(void* context, string_view layout);
+              const ConstLayout& layout, std::initializer_list<ConstString> columnsList, ColumnsHeaderViewFlags flags);
+        ColumnsHeaderView(void* context, const ConstLayout& layout);
         bool HeaderHasMouseCaption() const;
         bool SetColumnClipRect(Graphics::Renderer& renderer, uint32 columnIndex);
 
@@ -4319,7 +4988,7 @@ namespace Controls
     class EXPORT ListView : public ColumnsHeaderView
     {
       protected:
-        ListView(string_view layout, std::initializer_list<ConstString> columns, ListViewFlags flags);
+        ListView(const ConstLayout& layout, std::initializer_list<ConstString> columns, ListViewFlags flags);
 
         // Columns header view interface
         void OnColumnClicked(uint32 columnIndex) override;
@@ -4372,7 +5041,7 @@ namespace Controls
         bool AddItem(const ConstString& caption, GenericRef userData);
 
       protected:
-        ComboBox(string_view layout, const ConstString& text, char itemsSeparator);
+        ComboBox(const ConstLayout& layout, const ConstString& text, char itemsSeparator);
 
       public:
         static const uint32 NO_ITEM_SELECTED = 0xFFFFFFFF;
@@ -4474,7 +5143,7 @@ namespace Controls
     class EXPORT NumericSelector : public Control
     {
       protected:
-        NumericSelector(const int64 minValue, const int64 maxValue, int64 value, string_view layout);
+        NumericSelector(const int64 minValue, const int64 maxValue, int64 value, const ConstLayout& layout);
 
       public:
         int64 GetValue() const;
@@ -4632,7 +5301,7 @@ namespace Controls
 
       protected:
         TreeView(
-              string_view layout,
+              const ConstLayout& layout,
               std::initializer_list<ConstString> columns,
               TreeViewFlags flags = TreeViewFlags::None);
 
@@ -4690,7 +5359,7 @@ namespace Controls
     class EXPORT Grid : public Control
     {
       protected:
-        Grid(string_view layout, uint32 columnsNo, uint32 rowsNo, GridFlags flags);
+        Grid(const ConstLayout& layout, uint32 columnsNo, uint32 rowsNo, GridFlags flags);
 
       public:
         void Paint(Graphics::Renderer& renderer) override;
@@ -4748,7 +5417,7 @@ namespace Controls
     {
       protected:
         PropertyList(
-              string_view layout,
+              const ConstLayout& layout,
               Reference<PropertiesInterface> object,
               PropertyListFlags flags = PropertyListFlags::None);
 
@@ -4788,7 +5457,7 @@ namespace Controls
     {
       protected:
         KeySelector(
-              string_view layout,
+              const ConstLayout& layout,
               Input::Key keyCode     = Input::Key::None,
               KeySelectorFlags flags = KeySelectorFlags::None);
 
@@ -4808,7 +5477,7 @@ namespace Controls
     class EXPORT ColorPicker : public Control
     {
       protected:
-        ColorPicker(string_view layout, Graphics::Color color);
+        ColorPicker(const ConstLayout& layout, Graphics::Color color);
 
       public:
         void Paint(Graphics::Renderer& renderer) override;
@@ -4831,7 +5500,7 @@ namespace Controls
     class EXPORT CharacterTable : public Control
     {
       protected:
-        CharacterTable(string_view layout);
+        CharacterTable(const ConstLayout& layout);
 
       public:
         virtual ~CharacterTable();
@@ -4859,10 +5528,10 @@ namespace Controls
 
           public:
             static Reference<Controls::Label> Create(
-                  Controls::Control* parent, const ConstString& caption, string_view layout);
+                  Controls::Control* parent, const ConstString& caption, const ConstLayout& layout);
             static Reference<Controls::Label> Create(
-                  Controls::Control& parent, const ConstString& caption, string_view layout);
-            static Pointer<Controls::Label> Create(const ConstString& caption, string_view layout);
+                  Controls::Control& parent, const ConstString& caption, const ConstLayout& layout);
+            static Pointer<Controls::Label> Create(const ConstString& caption, const ConstLayout& layout);
         };
         class EXPORT Button
         {
@@ -4872,18 +5541,18 @@ namespace Controls
             static Reference<Controls::Button> Create(
                   Controls::Control* parent,
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   int controlID     = 0,
                   ButtonFlags flags = ButtonFlags::None);
             static Reference<Controls::Button> Create(
                   Controls::Control& parent,
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   int controlID     = 0,
                   ButtonFlags flags = ButtonFlags::None);
             static Pointer<Controls::Button> Create(
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   int controlID               = 0,
                   Controls::ButtonFlags flags = Controls::ButtonFlags::None);
         };
@@ -4893,10 +5562,10 @@ namespace Controls
 
           public:
             static Reference<Controls::Password> Create(
-                  Controls::Control* parent, const ConstString& caption, string_view layout);
+                  Controls::Control* parent, const ConstString& caption, const ConstLayout& layout);
             static Reference<Controls::Password> Create(
-                  Controls::Control& parent, const ConstString& caption, string_view layout);
-            static Pointer<Controls::Password> Create(const ConstString& caption, string_view layout);
+                  Controls::Control& parent, const ConstString& caption, const ConstLayout& layout);
+            static Pointer<Controls::Password> Create(const ConstString& caption, const ConstLayout& layout);
         };
         class EXPORT CheckBox
         {
@@ -4904,11 +5573,11 @@ namespace Controls
 
           public:
             static Reference<Controls::CheckBox> Create(
-                  Controls::Control* parent, const ConstString& caption, string_view layout, int controlID = 0);
+                  Controls::Control* parent, const ConstString& caption, const ConstLayout& layout, int controlID = 0);
             static Reference<Controls::CheckBox> Create(
-                  Controls::Control& parent, const ConstString& caption, string_view layout, int controlID = 0);
+                  Controls::Control& parent, const ConstString& caption, const ConstLayout& layout, int controlID = 0);
             static Pointer<Controls::CheckBox> Create(
-                  const ConstString& caption, string_view layout, int controlID = 0);
+                  const ConstString& caption, const ConstLayout& layout, int controlID = 0);
         };
         class EXPORT RadioBox
         {
@@ -4916,18 +5585,22 @@ namespace Controls
 
           public:
             static Pointer<Controls::RadioBox> Create(
-                  const ConstString& caption, string_view layout, int groupID, int controlID = 0, bool checked = false);
+                  const ConstString& caption,
+                  const ConstLayout& layout,
+                  int groupID,
+                  int controlID = 0,
+                  bool checked  = false);
             static Reference<Controls::RadioBox> Create(
                   Controls::Control* parent,
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   int groupID,
                   int controlID = 0,
                   bool checked  = false);
             static Reference<Controls::RadioBox> Create(
                   Controls::Control& parent,
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   int groupID,
                   int controlID = 0,
                   bool checked  = false);
@@ -4938,11 +5611,15 @@ namespace Controls
 
           public:
             static Reference<Controls::Splitter> Create(
-                  Controls::Control* parent, string_view layout, SplitterFlags flags = SplitterFlags::Horizontal);
+                  Controls::Control* parent,
+                  const ConstLayout& layout,
+                  SplitterFlags flags = SplitterFlags::Horizontal);
             static Reference<Controls::Splitter> Create(
-                  Controls::Control& parent, string_view layout, SplitterFlags flags = SplitterFlags::Horizontal);
+                  Controls::Control& parent,
+                  const ConstLayout& layout,
+                  SplitterFlags flags = SplitterFlags::Horizontal);
             static Pointer<Controls::Splitter> Create(
-                  string_view layout, SplitterFlags flags = SplitterFlags::Horizontal);
+                  const ConstLayout& layout, SplitterFlags flags = SplitterFlags::Horizontal);
         };
         class EXPORT Panel
         {
@@ -4950,13 +5627,13 @@ namespace Controls
 
           public:
             static Reference<Controls::Panel> Create(
-                  Controls::Control* parent, const ConstString& caption, string_view layout);
+                  Controls::Control* parent, const ConstString& caption, const ConstLayout& layout);
             static Reference<Controls::Panel> Create(
-                  Controls::Control& parent, const ConstString& caption, string_view layout);
-            static Pointer<Controls::Panel> Create(const ConstString& caption, string_view layout);
-            static Reference<Controls::Panel> Create(Controls::Control* parent, string_view layout);
-            static Reference<Controls::Panel> Create(Controls::Control& parent, string_view layout);
-            static Pointer<Controls::Panel> Create(string_view layout);
+                  Controls::Control& parent, const ConstString& caption, const ConstLayout& layout);
+            static Pointer<Controls::Panel> Create(const ConstString& caption, const ConstLayout& layout);
+            static Reference<Controls::Panel> Create(Controls::Control* parent, const ConstLayout& layout);
+            static Reference<Controls::Panel> Create(Controls::Control& parent, const ConstLayout& layout);
+            static Pointer<Controls::Panel> Create(const ConstLayout& layout);
         };
         class EXPORT TextField
         {
@@ -4966,16 +5643,16 @@ namespace Controls
             static Reference<Controls::TextField> Create(
                   Controls::Control* parent,
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Controls::TextFieldFlags flags = Controls::TextFieldFlags::None);
             static Reference<Controls::TextField> Create(
                   Controls::Control& parent,
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Controls::TextFieldFlags flags = Controls::TextFieldFlags::None);
             static Pointer<Controls::TextField> Create(
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Controls::TextFieldFlags flags = Controls::TextFieldFlags::None);
         };
         class EXPORT TextArea
@@ -4986,16 +5663,16 @@ namespace Controls
             static Reference<Controls::TextArea> Create(
                   Controls::Control* parent,
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Controls::TextAreaFlags flags = Controls::TextAreaFlags::None);
             static Reference<Controls::TextArea> Create(
                   Controls::Control& parent,
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Controls::TextAreaFlags flags = Controls::TextAreaFlags::None);
             static Pointer<Controls::TextArea> Create(
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Controls::TextAreaFlags flags = Controls::TextAreaFlags::None);
         };
         class EXPORT TabPage
@@ -5014,16 +5691,18 @@ namespace Controls
           public:
             static Reference<Controls::Tab> Create(
                   Controls::Control* parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Controls::TabFlags flags = Controls::TabFlags::TopTabs,
                   uint32 tabPageSize       = 16);
             static Reference<Controls::Tab> Create(
                   Controls::Control& parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Controls::TabFlags flags = Controls::TabFlags::TopTabs,
                   uint32 tabPageSize       = 16);
             static Pointer<Controls::Tab> Create(
-                  string_view layout, Controls::TabFlags flags = Controls::TabFlags::TopTabs, uint32 tabPageSize = 16);
+                  const ConstLayout& layout,
+                  Controls::TabFlags flags = Controls::TabFlags::TopTabs,
+                  uint32 tabPageSize       = 16);
         };
         class EXPORT CanvasViewer
         {
@@ -5032,38 +5711,38 @@ namespace Controls
           public:
             static Reference<Controls::CanvasViewer> Create(
                   Controls::Control* parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   uint32 canvasWidth,
                   uint32 canvasHeight,
                   Controls::ViewerFlags flags = Controls::ViewerFlags::None);
             static Reference<Controls::CanvasViewer> Create(
                   Controls::Control& parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   uint32 canvasWidth,
                   uint32 canvasHeight,
                   Controls::ViewerFlags flags = Controls::ViewerFlags::None);
             static Pointer<Controls::CanvasViewer> Create(
-                  string_view layout,
+                  const ConstLayout& layout,
                   uint32 canvasWidth,
                   uint32 canvasHeight,
                   Controls::ViewerFlags flags = ViewerFlags::None);
             static Reference<Controls::CanvasViewer> Create(
                   Controls::Control* parent,
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   uint32 canvasWidth,
                   uint32 canvasHeight,
                   Controls::ViewerFlags flags = ViewerFlags::None);
             static Reference<Controls::CanvasViewer> Create(
                   Controls::Control& parent,
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   uint32 canvasWidth,
                   uint32 canvasHeight,
                   Controls::ViewerFlags flags = ViewerFlags::None);
             static Pointer<Controls::CanvasViewer> Create(
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   uint32 canvasWidth,
                   uint32 canvasHeight,
                   Controls::ViewerFlags flags = ViewerFlags::None);
@@ -5074,28 +5753,58 @@ namespace Controls
 
           public:
             static Pointer<Controls::ImageView> Create(
-                  string_view layout, Controls::ViewerFlags flags = Controls::ViewerFlags::None);
+                  const ConstLayout& layout, Controls::ViewerFlags flags = Controls::ViewerFlags::None);
             static Reference<Controls::ImageView> Create(
                   Controls::Control* parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Controls::ViewerFlags flags = Controls::ViewerFlags::None);
             static Reference<Controls::ImageView> Create(
                   Controls::Control& parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Controls::ViewerFlags flags = Controls::ViewerFlags::None);
             static Pointer<Controls::ImageView> Create(
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Controls::ViewerFlags flags = Controls::ViewerFlags::None);
             static Reference<Controls::ImageView> Create(
                   Controls::Control* parent,
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Controls::ViewerFlags flags = Controls::ViewerFlags::None);
             static Reference<Controls::ImageView> Create(
                   Controls::Control& parent,
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
+                  Controls::ViewerFlags flags = Controls::ViewerFlags::None);
+        };
+        class EXPORT VideoView
+        {
+            VideoView() = delete;
+
+          public:
+            static Pointer<Controls::VideoView> Create(
+                  const ConstLayout& layout, Controls::ViewerFlags flags = Controls::ViewerFlags::None);
+            static Reference<Controls::VideoView> Create(
+                  Controls::Control* parent,
+                  const ConstLayout& layout,
+                  Controls::ViewerFlags flags = Controls::ViewerFlags::None);
+            static Reference<Controls::VideoView> Create(
+                  Controls::Control& parent,
+                  const ConstLayout& layout,
+                  Controls::ViewerFlags flags = Controls::ViewerFlags::None);
+            static Pointer<Controls::VideoView> Create(
+                  const ConstString& caption,
+                  const ConstLayout& layout,
+                  Controls::ViewerFlags flags = Controls::ViewerFlags::None);
+            static Reference<Controls::VideoView> Create(
+                  Controls::Control* parent,
+                  const ConstString& caption,
+                  const ConstLayout& layout,
+                  Controls::ViewerFlags flags = Controls::ViewerFlags::None);
+            static Reference<Controls::VideoView> Create(
+                  Controls::Control& parent,
+                  const ConstString& caption,
+                  const ConstLayout& layout,
                   Controls::ViewerFlags flags = Controls::ViewerFlags::None);
         };
         class EXPORT ListView
@@ -5104,17 +5813,17 @@ namespace Controls
 
           public:
             static Pointer<Controls::ListView> Create(
-                  string_view layout,
+                  const ConstLayout& layout,
                   std::initializer_list<ConstString> columns,
                   Controls::ListViewFlags flags = Controls::ListViewFlags::None);
             static Reference<Controls::ListView> Create(
                   Controls::Control* parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   std::initializer_list<ConstString> columns,
                   Controls::ListViewFlags flags = Controls::ListViewFlags::None);
             static Reference<Controls::ListView> Create(
                   Controls::Control& parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   std::initializer_list<ConstString> columns,
                   Controls::ListViewFlags flags = Controls::ListViewFlags::None);
         };
@@ -5124,16 +5833,16 @@ namespace Controls
 
           public:
             static Pointer<Controls::ComboBox> Create(
-                  string_view layout, const ConstString& text = string_view(), char itemsSeparator = ',');
+                  const ConstLayout& layout, const ConstString& text = string_view(), char itemsSeparator = ',');
 
             static Reference<Controls::ComboBox> Create(
                   Controls::Control* parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   const ConstString& text = string_view(),
                   char itemsSeparator     = ',');
             static Reference<Controls::ComboBox> Create(
                   Controls::Control& parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   const ConstString& text = string_view(),
                   char itemsSeparator     = ',');
         };
@@ -5143,19 +5852,19 @@ namespace Controls
 
           public:
             static Pointer<Controls::NumericSelector> Create(
-                  const int64 minValue, const int64 maxValue, int64 value, string_view layout);
+                  const int64 minValue, const int64 maxValue, int64 value, const ConstLayout& layout);
             static Reference<Controls::NumericSelector> Create(
                   Controls::Control* parent,
                   const int64 minValue,
                   const int64 maxValue,
                   int64 value,
-                  string_view layout);
+                  const ConstLayout& layout);
             static Reference<Controls::NumericSelector> Create(
                   Controls::Control& parent,
                   const int64 minValue,
                   const int64 maxValue,
                   int64 value,
-                  string_view layout);
+                  const ConstLayout& layout);
         };
         class EXPORT Window
         {
@@ -5164,7 +5873,7 @@ namespace Controls
           public:
             static Pointer<Controls::Window> Create(
                   const ConstString& caption,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Controls::WindowFlags windowFlags = Controls::WindowFlags::None);
         };
         class EXPORT Desktop
@@ -5180,17 +5889,17 @@ namespace Controls
 
           public:
             static Pointer<Controls::TreeView> Create(
-                  string_view layout,
+                  const ConstLayout& layout,
                   std::initializer_list<ConstString> columns,
                   const Controls::TreeViewFlags flags = Controls::TreeViewFlags::None);
             static Reference<Controls::TreeView> Create(
                   Control* parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   std::initializer_list<ConstString> columns,
                   const Controls::TreeViewFlags flags = Controls::TreeViewFlags::None);
             static Reference<Controls::TreeView> Create(
                   Control& parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   std::initializer_list<ConstString> columns,
                   const Controls::TreeViewFlags flags = Controls::TreeViewFlags::None);
         };
@@ -5200,16 +5909,16 @@ namespace Controls
 
           public:
             static Pointer<Controls::Grid> Create(
-                  string_view layout, uint32 columnsNo, uint32 rowsNo, Controls::GridFlags flags);
+                  const ConstLayout& layout, uint32 columnsNo, uint32 rowsNo, Controls::GridFlags flags);
             static Reference<Controls::Grid> Create(
                   Controls::Control* parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   uint32 columnsNo,
                   uint32 rowsNo,
                   Controls::GridFlags flags);
             static Reference<Controls::Grid> Create(
                   Controls::Control& parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   uint32 columnsNo,
                   uint32 rowsNo,
                   Controls::GridFlags flags);
@@ -5220,17 +5929,17 @@ namespace Controls
 
           public:
             static Pointer<Controls::PropertyList> Create(
-                  string_view layout,
+                  const ConstLayout& layout,
                   Reference<PropertiesInterface> object,
                   PropertyListFlags flags = PropertyListFlags::None);
             static Reference<Controls::PropertyList> Create(
                   Controls::Control* parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Reference<PropertiesInterface> object,
                   PropertyListFlags flags = PropertyListFlags::None);
             static Reference<Controls::PropertyList> Create(
                   Controls::Control& parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Reference<PropertiesInterface> object,
                   PropertyListFlags flags = PropertyListFlags::None);
         };
@@ -5241,16 +5950,16 @@ namespace Controls
           public:
             static Reference<Controls::KeySelector> Create(
                   Controls::Control* parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Input::Key keyCode     = Input::Key::None,
                   KeySelectorFlags flags = KeySelectorFlags::None);
             static Reference<Controls::KeySelector> Create(
                   Controls::Control& parent,
-                  string_view layout,
+                  const ConstLayout& layout,
                   Input::Key keyCode     = Input::Key::None,
                   KeySelectorFlags flags = KeySelectorFlags::None);
             static Pointer<Controls::KeySelector> Create(
-                  string_view layout,
+                  const ConstLayout& layout,
                   Input::Key keyCode     = Input::Key::None,
                   KeySelectorFlags flags = KeySelectorFlags::None);
         };
@@ -5260,19 +5969,19 @@ namespace Controls
 
           public:
             static Reference<Controls::ColorPicker> Create(
-                  Controls::Control* parent, string_view layout, Graphics::Color color);
+                  Controls::Control* parent, const ConstLayout& layout, Graphics::Color color);
             static Reference<Controls::ColorPicker> Create(
-                  Controls::Control& parent, string_view layout, Graphics::Color color);
-            static Pointer<Controls::ColorPicker> Create(string_view layout, Graphics::Color color);
+                  Controls::Control& parent, const ConstLayout& layout, Graphics::Color color);
+            static Pointer<Controls::ColorPicker> Create(const ConstLayout& layout, Graphics::Color color);
         };
         class EXPORT CharacterTable
         {
             CharacterTable() = delete;
 
           public:
-            static Reference<Controls::CharacterTable> Create(Controls::Control* parent, string_view layout);
-            static Reference<Controls::CharacterTable> Create(Controls::Control& parent, string_view layout);
-            static Pointer<Controls::CharacterTable> Create(string_view layout);
+            static Reference<Controls::CharacterTable> Create(Controls::Control* parent, const ConstLayout& layout);
+            static Reference<Controls::CharacterTable> Create(Controls::Control& parent, const ConstLayout& layout);
+            static Pointer<Controls::CharacterTable> Create(const ConstLayout& layout);
         };
     } // namespace Factory
 
@@ -5359,8 +6068,141 @@ namespace Log
           uint32 line,
           const char* format,
           ...);
+
+    // an argument of a message whose formatting is deferred (see ReportStructured)
+    enum class ArgumentType : uint32
+    {
+        Int64,
+        UInt64,
+        Double,
+        String,
+        Pointer
+    };
+    struct Argument
+    {
+        ArgumentType Type;
+        uint32 Size; // sizeof the original value (%u or %x of a negative int32 is a 32-bit number)
+        union
+        {
+            int64 Int64;
+            uint64 UInt64;
+            double Double;
+            const char* String;
+            const void* Pointer;
+        };
+    };
+    template <typename T>
+    inline Argument MakeArgument(const T& value)
+    {
+        using Type = std::decay_t<T>;
+        Argument arg;
+        arg.Size = (uint32) sizeof(Type);
+        if constexpr (std::is_same_v<Type, char*> || std::is_same_v<Type, const char*>)
+        {
+            arg.Type   = ArgumentType::String;
+            arg.String = value;
+        }
+        else if constexpr (std::is_pointer_v<Type> || std::is_null_pointer_v<Type>)
+        {
+            arg.Type    = ArgumentType::Pointer;
+            arg.Pointer = value;
+        }
+        else if constexpr (std::is_enum_v<Type>)
+        {
+            return MakeArgument(static_cast<std::underlying_type_t<Type>>(value));
+        }
+        else if constexpr (std::is_floating_point_v<Type>)
+        {
+            arg.Type   = ArgumentType::Double;
+            arg.Double = (double) value;
+        }
+        else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>)
+        {
+            arg.Type  = ArgumentType::Int64;
+            arg.Int64 = (int64) value;
+        }
+        else
+        {
+            static_assert(std::is_integral_v<Type>, "Unsupported log argument (expecting a number, string or pointer)");
+            arg.Type   = ArgumentType::UInt64;
+            arg.UInt64 = (uint64) value;
+        }
+        return arg;
+    }
+    /**
+     * Same as Report, but if ToFileAsync is used and staticFormat is true, the arguments are only stored and the text
+     * is formatted by the writer thread (otherwise it is formatted right away, by the calling thread). Strings are
+     * copied (at most the precision of a %.*s specifier); the format, the file name, the function and the condition
+     * are kept as pointers, so staticFormat must be true only for a format with a static storage (a literal).
+     */
+    void EXPORT ReportArguments(
+          Severity type,
+          const char* fileName,
+          const char* function,
+          const char* condition,
+          uint32 line,
+          const char* format,
+          bool staticFormat,
+          const Argument* arguments,
+          uint32 argumentsCount);
+    // a format that can be kept as a pointer (the constructor only accepts a literal or a static array)
+    struct StaticFormat
+    {
+        const char* Text;
+
+        template <size_t N>
+        consteval StaticFormat(const char (&text)[N]) : Text(text)
+        {
+        }
+    };
+    template <typename... T>
+    inline void ReportStructured(
+          Severity type,
+          const char* fileName,
+          const char* function,
+          const char* condition,
+          uint32 line,
+          StaticFormat format,
+          const T&... args)
+    {
+        if constexpr (sizeof...(T) == 0)
+        {
+            ReportArguments(type, fileName, function, condition, line, format.Text, true, nullptr, 0);
+        }
+        else
+        {
+            const Argument arguments[] = { MakeArgument(args)... };
+            ReportArguments(type, fileName, function, condition, line, format.Text, true, arguments, sizeof...(T));
+        }
+    }
+    /**
+     * Messages with a lower severity are discarded by Report and ReportArguments before they are formatted.
+     */
+    void EXPORT SetMinSeverity(Severity type);
+    enum class OverflowPolicy : uint32
+    {
+        Block = 0, // the thread that logs waits until the writer makes room in the queue
+        Drop,      // the message is discarded (the number of discarded messages is written in the log)
+    };
     void EXPORT SetLogCallback(void (*callback)(const Message&));
     bool EXPORT ToFile(const std::filesystem::path& fileName);
+    /**
+     * The messages are queued (without locks) for a background thread that writes them into the file in batches.
+     * Report formats a message on the thread that logs it; LOG_INFO, LOG_WARNING and LOG_ERROR (ReportStructured)
+     * only queue its arguments and the background thread formats it. Fatal and internal errors are written before
+     * Report returns.
+     * @param[in] fileName is the log file (it is created or truncated).
+     * @param[in] queueSize is the size (in bytes) of the queue (rounded up to a power of 2).
+     * @param[in] policy specifies what happens with a message when the queue is full.
+     */
+    bool EXPORT ToFileAsync(
+          const std::filesystem::path& fileName,
+          uint32 queueSize      = 0x100000,
+          OverflowPolicy policy = OverflowPolicy::Block);
+    /**
+     * Waits until all queued messages are written (only needed for ToFileAsync).
+     */
+    void EXPORT Flush();
     bool EXPORT ToOutputDebugString();
     bool EXPORT ToStdErr();
     bool EXPORT ToStdOut();
@@ -5381,6 +6223,7 @@ namespace Application
         EnableFPSMode           = 0x0080,
         SingleWindowApp         = 0x0100,
         DisableAutoCloseDesktop = 0x0200,
+        EnableProfiler          = 0x0400,
     };
 
     enum class CharacterSize : uint32
@@ -5399,6 +6242,7 @@ namespace Application
         Terminal       = 2,
         WindowsConsole = 3,
         Tests          = 4,
+        SDLHeadless    = 5, // script driven (like Tests) with SDL rendering into an offscreen surface
     };
     enum class ThemeType : uint32
     {
@@ -5425,11 +6269,13 @@ namespace Application
         ThemeType Theme;
         SpecialCharacterSetType SpecialCharacterSet;
         Controls::Desktop* (*CustomDesktopConstructor)();
+        uint32 GlyphCacheMemory; // bytes used to cache rendered glyphs (SDL frontend only, 0 = default)
 
         InitializationData()
             : Width(0), Height(0), Frontend(FrontendType::Default), CharSize(CharacterSize::Default),
               Flags(InitializationFlags::None), FontName(""), Theme(ThemeType::Default),
-              SpecialCharacterSet(SpecialCharacterSetType::Auto), CustomDesktopConstructor(nullptr)
+              SpecialCharacterSet(SpecialCharacterSetType::Auto), CustomDesktopConstructor(nullptr),
+              GlyphCacheMemory(0)
         {
         }
     };
@@ -5552,6 +6398,71 @@ namespace Application
     EXPORT void Close();
     EXPORT void SetTheme(ThemeType themeType);
     EXPORT bool SetSpecialCharacterSet(SpecialCharacterSetType characterSetType);
+
+    // Glyph cache usage (only frontends that render glyphs themselves, like SDL, have one)
+    struct GlyphCacheStats
+    {
+        uint64 Hits, Misses, Evictions;
+        uint32 UsedGlyphs, MaxGlyphs;
+        uint64 MemoryBudget;
+    };
+    EXPORT bool GetGlyphCacheStats(GlyphCacheStats& stats);
+
+    // Frame and paint timings (all times are in nanoseconds).
+    // Profiling is off by default (see InitializationFlags::EnableProfiler or Profiler::Enable).
+    namespace Profiler
+    {
+        struct FrameInfo
+        {
+            uint64 FrameIndex;
+            uint64 ComputePositionsTime;
+            uint64 PaintTime;
+            uint64 TerminalUpdateTime;
+            uint64 TotalTime;
+            uint32 PaintedControls;
+        };
+        struct ControlInfo
+        {
+            Controls::Control* Control;
+            std::string TypeName;
+            uint64 PaintCalls;
+            uint64 TotalPaintTime;
+            uint64 MaxPaintTime;
+        };
+
+        EXPORT void Enable(bool enabled);
+        EXPORT bool IsEnabled();
+        EXPORT void Reset();
+
+        // the overlay (top-right corner) shows the last frames and the slowest controls
+        EXPORT void ShowOverlay(bool visible);
+        EXPORT void SetOverlayHotKey(Input::Key hotKey);
+
+        // last recorded frames (index 0 is the most recent one)
+        EXPORT uint32 GetFramesCount();
+        EXPORT bool GetFrame(uint32 index, FrameInfo& frame);
+
+        // GetControlsCount takes a snapshot of all painted controls, sorted by their total paint time
+        // (slowest first); GetControl reads from that snapshot
+        EXPORT uint32 GetControlsCount();
+        EXPORT bool GetControl(uint32 index, ControlInfo& info);
+
+        EXPORT bool DumpToFile(const std::filesystem::path& path);
+    }; // namespace Profiler
+
+    // Records every frame that is sent to the terminal (only the characters that changed since the previous frame
+    // are written, with a key frame every keyFrameInterval frames). Recordings are read with
+    // Graphics::ScreenRecording.
+    namespace Recorder
+    {
+        constexpr uint32 DEFAULT_KEY_FRAME_INTERVAL = 256;
+
+        EXPORT bool Start(const std::filesystem::path& path, uint32 keyFrameInterval = DEFAULT_KEY_FRAME_INTERVAL);
+        EXPORT bool Stop();
+        EXPORT bool IsRecording();
+        // plays a recording on the current frontend (with the recorded timing or as fast as possible)
+        EXPORT bool Replay(const std::filesystem::path& path, bool realTime = true);
+    }; // namespace Recorder
 }; // namespace Application
 namespace Endian
 {
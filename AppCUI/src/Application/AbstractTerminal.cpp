@@ -9,6 +9,7 @@ AbstractTerminal::AbstractTerminal()
     this->LastCursorVisibility = false;
     this->LastCursorX          = 0xFFFFFFFF;
     this->LastCursorY          = 0xFFFFFFFF;
+    this->FrameUpdateRequests  = 0;
     this->Inited               = false;
 }
 AbstractTerminal::~AbstractTerminal()
@@ -39,6 +40,10 @@ void AbstractTerminal::UnInit()
     // OS specific On-unit
     this->OnUnInit();
 }
+bool AbstractTerminal::GetGlyphCacheStats(Application::GlyphCacheStats&)
+{
+    RETURNERROR(false, "This frontend does not cache glyphs");
+}
 void AbstractTerminal::Update()
 {
     this->OnFlushToScreen();
@@ -55,5 +60,10 @@ void AbstractTerminal::Update()
             this->LastCursorVisibility = this->ScreenCanvas.GetCursorVisibility();
         }
     }
+    if ((this->Recorder) && (!this->Recorder->AddFrame(this->ScreenCanvas)))
+    {
+        LOG_ERROR("Fail to record the screen - recording was stopped !");
+        this->Recorder.reset();
+    }
 }
 } // namespace AppCUI::Internal
\ No newline at end of file
@@ -107,6 +107,12 @@ bool Application::GetDesktopSize(Graphics::Size& size)
     return true;
 }
 
+bool Application::GetGlyphCacheStats(GlyphCacheStats& stats)
+{
+    CHECK(app, false, "Application has not been initialized !");
+    return app->terminal->GetGlyphCacheStats(stats);
+}
+
 void Application::ArrangeWindows(ArrangeWindowsMethod method)
 {
     if (app)
@@ -338,6 +344,7 @@ void PaintControl(Controls::Control* ctrl, Graphics::Renderer& renderer, bool fo
     }
 
     // draw current control
+    const auto paintStart = app->Profiler.Start();
     if (Members->handlers)
     {
         if (Members->handlers->PaintControl.obj)
@@ -362,6 +369,14 @@ void PaintControl(Controls::Control* ctrl, Graphics::Renderer& renderer, bool fo
         ctrl->OnUpdateScrollBars(); // update scroll bars value
         Members->PaintScrollbars(renderer);
     }
+    if ((app->Profiler.Enabled) && (paintStart != 0))
+    {
+        const auto paintTime = FrameProfiler::Now() - paintStart;
+        Members->PaintProfile.Calls++;
+        Members->PaintProfile.TotalTime += paintTime;
+        Members->PaintProfile.MaxTime = std::max<>(Members->PaintProfile.MaxTime, paintTime);
+        app->Profiler.Current.PaintedControls++;
+    }
 
 #if defined(APPCUI_ENABLE_CONTROL_BORDER_MODE)
     // draw border before checking any selection below
@@ -428,16 +443,34 @@ void ComputeControlLayout(Graphics::Clip& parentClip, Control* ctrl)
         }
     }
     // calculez clip-ul client
-    Graphics::Clip client;
-    client.Set(
+    Members->ClientClip.Set(
           parentClip,
           Members->Layout.X + Members->Margins.Left,
           Members->Layout.Y + Members->Margins.Top,
           Members->Layout.Width - (Members->Margins.Right + Members->Margins.Left),
           Members->Layout.Height - (Members->Margins.Bottom + Members->Margins.Top));
+    Members->LayoutDirty.Self     = false;
+    Members->LayoutDirty.Children = false;
     // calculez pentru fiecare copil
     for (uint32 tr = 0; tr < Members->ControlsCount; tr++)
-        ComputeControlLayout(client, Members->Controls[tr]);
+        ComputeControlLayout(Members->ClientClip, Members->Controls[tr]);
+}
+void ComputeDirtyControlLayout(Graphics::Clip& parentClip, Control* ctrl)
+{
+    if (ctrl == nullptr)
+        return;
+    CREATE_CONTROL_CONTEXT(ctrl, Members, );
+    if (Members->LayoutDirty.Self)
+    {
+        ComputeControlLayout(parentClip, ctrl);
+        return;
+    }
+    if (!Members->LayoutDirty.Children)
+        return;
+    // my own clips are still valid --> only walk down to the dirty descendants
+    Members->LayoutDirty.Children = false;
+    for (uint32 tr = 0; tr < Members->ControlsCount; tr++)
+        ComputeDirtyControlLayout(Members->ClientClip, Members->Controls[tr]);
 }
 void DestroyControl(Controls::Control* ctrl)
 {
@@ -472,39 +505,6 @@ bool ProcessUpdateFrameEvent(Controls::Control* ctrl)
     }
     return res;
 }
-Controls::Control* RecursiveCoordinatesToControl(Controls::Control* ctrl, int x, int y)
-{
-    if (ctrl == nullptr)
-        return nullptr;
-    CREATE_CONTROL_CONTEXT(ctrl, Members, nullptr);
-    if ((Members->Flags & (GATTR_ENABLE | GATTR_VISIBLE)) != (GATTR_ENABLE | GATTR_VISIBLE))
-        return nullptr;
-    if (Members->ScreenClip.Visible == false)
-        return nullptr;
-    if ((x < Members->ScreenClip.ClipRect.X) || (y < Members->ScreenClip.ClipRect.Y) ||
-        (x >= (Members->ScreenClip.ClipRect.X + Members->ScreenClip.ClipRect.Width)) ||
-        (y >= (Members->ScreenClip.ClipRect.Y + Members->ScreenClip.ClipRect.Height)))
-        return nullptr;
-    // controlul e ok - verific acuma pentru copii
-    if (Members->ControlsCount > 0)
-    {
-        uint32 idx = Members->CurrentControlIndex;
-        if (idx >= Members->ControlsCount)
-            idx = 0;
-        for (uint32 tr = 0; tr < Members->ControlsCount; tr++)
-        {
-            Control* res = RecursiveCoordinatesToControl(Members->Controls[idx], x, y);
-            if (res != nullptr)
-                return res;
-            idx++;
-            if (idx >= Members->ControlsCount)
-                idx = 0;
-        }
-    }
-    // daca nu e ok pe nici un copil sau nu am copii - atunci ma returnez pe mine
-    return ctrl;
-}
-
 Controls::Control* CoordinatesToControl(Controls::Control* ctrl, int x, int y)
 {
     if (app->ExpandedControl)
@@ -515,7 +515,8 @@ Controls::Control* CoordinatesToControl(Controls::Control* ctrl, int x, int y)
             (y < (Members->ExpandedViewClip.ClipRect.Y + Members->ExpandedViewClip.ClipRect.Height)))
             return app->ExpandedControl;
     }
-    return RecursiveCoordinatesToControl(ctrl, x, y);
+    return app->HitTest.Get(
+          ctrl, x, y, app->terminal->ScreenCanvas.GetWidth(), app->terminal->ScreenCanvas.GetHeight());
 }
 
 Controls::Control* GetFocusedControl(Controls::Control* ctrl)
@@ -550,6 +551,7 @@ ApplicationImpl::ApplicationImpl()
     this->VisibleMenu        = nullptr;
     this->ModalControlsCount = 0;
     this->LastWindowID       = 0;
+    this->HotKeysVersion     = 0;
     this->loopStatus         = LoopStatus::Normal;
     this->RepaintStatus      = REPAINT_STATUS_ALL;
     this->mouseLockedObject  = MouseLockedObject::None;
@@ -785,6 +787,8 @@ bool ApplicationImpl::Init(Application::InitializationData& initData)
     ModalControlsCount = 0;
     LastWindowID       = 0;
     InitFlags          = initData.Flags;
+    Profiler.Enabled   = (initData.Flags & Application::InitializationFlags::EnableProfiler) !=
+                       Application::InitializationFlags::None;
 
     this->Inited = true;
     LOG_INFO("AppCUI initialized succesifully");
@@ -830,6 +834,9 @@ void ApplicationImpl::Paint()
               this->ToolTip.ScreenClip.ScreenPosition.X, this->ToolTip.ScreenClip.ScreenPosition.Y);
         this->ToolTip.Paint(this->terminal->ScreenCanvas);
     }
+    // profiler overlay is drawn over everything (including the ToolTip)
+    if ((this->Profiler.Enabled) && (this->Profiler.OverlayVisible))
+        PaintProfilerOverlay();
 }
 void ApplicationImpl::ComputePositions()
 {
@@ -838,11 +845,29 @@ void ApplicationImpl::ComputePositions()
     ComputeControlLayout(full, this->AppDesktop);
     for (uint32 tr = 0; tr < ModalControlsCount; tr++)
         ComputeControlLayout(full, ModalControlsStack[tr]);
+    // screen clips have changed --> the hit-test map will be rebuilt on the next mouse event
+    this->HitTest.Invalidate();
+}
+void ApplicationImpl::ComputeDirtyPositions()
+{
+    Graphics::Clip full;
+    full.Set(0, 0, app->terminal->ScreenCanvas.GetWidth(), app->terminal->ScreenCanvas.GetHeight());
+    ComputeDirtyControlLayout(full, this->AppDesktop);
+    for (uint32 tr = 0; tr < ModalControlsCount; tr++)
+        ComputeDirtyControlLayout(full, ModalControlsStack[tr]);
+    this->HitTest.Invalidate();
 }
 void ApplicationImpl::ProcessKeyPress(Input::Key KeyCode, char16 unicodeCharacter)
 {
     Reference<Control> ctrl = nullptr;
 
+    if ((this->Profiler.Enabled) && (KeyCode == this->Profiler.OverlayHotKey))
+    {
+        this->Profiler.OverlayVisible = !this->Profiler.OverlayVisible;
+        RepaintStatus |= REPAINT_STATUS_DRAW;
+        return;
+    }
+
     // if a contextual menu is visible --> all keys will be handle by it
     if (this->VisibleMenu)
     {
@@ -1076,7 +1101,7 @@ void ApplicationImpl::OnMouseMove(int x, int y, Input::MouseButton button)
                   x - ((ControlContext*) (MouseLockedControl->Context))->ScreenClip.ScreenPosition.X,
                   y - ((ControlContext*) (MouseLockedControl->Context))->ScreenClip.ScreenPosition.Y,
                   button))
-            RepaintStatus |= (REPAINT_STATUS_DRAW | REPAINT_STATUS_COMPUTE_POSITION);
+            RepaintStatus |= REPAINT_STATUS_DRAW; // MoveTo/Resize mark the dragged subtree as dirty
         break;
     case MouseLockedObject::None:
         if (ProcessMenuAndCmdBarMouseMove(x, y))
@@ -1248,6 +1273,7 @@ bool ApplicationImpl::ExecuteEventLoop(Control* ctrl)
                 delete c;
             }
             toDelete.clear();
+            this->HitTest.Invalidate();
         }
         if (this->cmdBarUpdate)
         {
@@ -1256,23 +1282,44 @@ bool ApplicationImpl::ExecuteEventLoop(Control* ctrl)
         }
         if (RepaintStatus != REPAINT_STATUS_NONE)
         {
+            auto& frame           = this->Profiler.Current;
+            const auto frameStart = this->Profiler.Start();
+            auto sectionStart     = frameStart;
             if ((RepaintStatus & REPAINT_STATUS_COMPUTE_POSITION) != 0)
                 ComputePositions();
+            else if ((RepaintStatus & REPAINT_STATUS_COMPUTE_DIRTY_POSITION) != 0)
+                ComputeDirtyPositions();
+            this->Profiler.Stop(frame.ComputePositionsTime, sectionStart);
             if ((RepaintStatus & REPAINT_STATUS_DRAW) != 0)
             {
                 RepaintStatus = REPAINT_STATUS_NONE;
+                sectionStart  = this->Profiler.Start();
                 this->Paint();
+                this->Profiler.Stop(frame.PaintTime, sectionStart);
                 // pentru cazul in care OnFocus sau OnLoseFocus schimba repaint status
+                sectionStart = this->Profiler.Start();
                 if ((RepaintStatus & REPAINT_STATUS_COMPUTE_POSITION) != 0)
                     ComputePositions();
+                else if ((RepaintStatus & REPAINT_STATUS_COMPUTE_DIRTY_POSITION) != 0)
+                    ComputeDirtyPositions();
+                this->Profiler.Stop(frame.ComputePositionsTime, sectionStart);
                 if (this->cmdBarUpdate)
                     UpdateCommandBar();
                 if ((RepaintStatus & REPAINT_STATUS_DRAW) != 0)
+                {
+                    sectionStart = this->Profiler.Start();
                     this->Paint();
+                    this->Profiler.Stop(frame.PaintTime, sectionStart);
+                }
+                sectionStart = this->Profiler.Start();
                 this->terminal->Update();
+                this->Profiler.Stop(frame.TerminalUpdateTime, sectionStart);
             }
             RepaintStatus = REPAINT_STATUS_NONE;
+            this->Profiler.EndFrame(frameStart);
         }
+        // the settings are saved once they are no longer changed (if auto-save was enabled)
+        this->settings.ProcessAutoSave();
         this->terminal->GetSystemEvent(evnt);
         if (evnt.updateFrames)
         {
@@ -1282,6 +1329,9 @@ bool ApplicationImpl::ExecuteEventLoop(Control* ctrl)
                 if (ProcessUpdateFrameEvent(this->ModalControlsStack[tr]))
                     this->RepaintStatus |= REPAINT_STATUS_DRAW;
         }
+        // the handlers of the asynchronous reads are called on this thread
+        if (OS::AsyncReader::ProcessCompletions() > 0)
+            this->RepaintStatus |= REPAINT_STATUS_DRAW;
         switch (evnt.eventType)
         {
         case SystemEventType::AppClosed:
@@ -1468,6 +1518,7 @@ void ApplicationImpl::Terminate()
 bool ApplicationImpl::UnInit()
 {
     CHECK(this->Inited, false, "Nothing to uninit --> have you called Application::Init(...) ?");
+    this->settings.ProcessAutoSave(true);
     this->terminal->UnInit();
     this->Inited = false;
     return true;
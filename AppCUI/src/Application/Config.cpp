@@ -726,7 +726,7 @@ bool Internal::Config::Save(Application::Config& config, const std::filesystem::
     WRITE_COLOR(config.Window.Background.Info, "Info");
 
     // save
-    return File::WriteContent(outputFile, temp.ToStringView());
+    return File::ReplaceContent(outputFile, temp.ToStringView());
 }
 bool Internal::Config::Load(Application::Config& config, const std::filesystem::path& inputFile)
 {
@@ -0,0 +1,69 @@
+#include "ControlContext.hpp"
+
+namespace AppCUI::Internal
+{
+HitTestMap::HitTestMap()
+{
+    this->Root   = nullptr;
+    this->Width  = 0;
+    this->Height = 0;
+    this->Valid  = false;
+}
+void HitTestMap::Invalidate()
+{
+    this->Valid = false;
+}
+void HitTestMap::Fill(Controls::Control* ctrl)
+{
+    if (ctrl == nullptr)
+        return;
+    CREATE_CONTROL_CONTEXT(ctrl, Members, );
+    if ((Members->Flags & (GATTR_ENABLE | GATTR_VISIBLE)) != (GATTR_ENABLE | GATTR_VISIBLE))
+        return;
+    if (Members->ScreenClip.Visible == false)
+        return;
+
+    // the clip rect is already bounded to the screen, but make sure we never write outside the map
+    const auto& r     = Members->ScreenClip.ClipRect;
+    const auto left   = std::max<>(r.X, 0);
+    const auto top    = std::max<>(r.Y, 0);
+    const auto right  = std::min<>(r.X + r.Width, (int) this->Width);
+    const auto bottom = std::min<>(r.Y + r.Height, (int) this->Height);
+    if ((left >= right) || (top >= bottom))
+        return;
+    for (auto y = top; y < bottom; y++)
+    {
+        auto p = this->Cells.data() + (size_t) y * this->Width;
+        std::fill(p + left, p + right, ctrl);
+    }
+
+    // children are searched starting with the focused one (see RecursiveCoordinatesToControl)
+    // the first child that contains a point wins --> paint them in reverse order so that the
+    // child with the highest priority overwrites the others
+    const auto cnt = Members->ControlsCount;
+    if (cnt == 0)
+        return;
+    auto idx = Members->CurrentControlIndex;
+    if (idx >= cnt)
+        idx = 0;
+    for (uint32 tr = cnt; tr > 0; tr--)
+        Fill(Members->Controls[(idx + tr - 1) % cnt]);
+}
+void HitTestMap::Rebuild(Controls::Control* root, uint32 width, uint32 height)
+{
+    this->Width  = width;
+    this->Height = height;
+    this->Root   = root;
+    this->Cells.assign((size_t) width * height, nullptr);
+    Fill(root);
+    this->Valid = true;
+}
+Controls::Control* HitTestMap::Get(Controls::Control* root, int x, int y, uint32 width, uint32 height)
+{
+    if ((!this->Valid) || (this->Root != root) || (this->Width != width) || (this->Height != height))
+        Rebuild(root, width, height);
+    if ((x < 0) || (y < 0) || (x >= (int) this->Width) || (y >= (int) this->Height))
+        return nullptr;
+    return this->Cells[(size_t) y * this->Width + x];
+}
+} // namespace AppCUI::Internal
@@ -0,0 +1,306 @@
+#include "ControlContext.hpp"
+
+#include <algorithm>
+#include <chrono>
+#if defined(__GNUC__) || defined(__clang__)
+#    include <cxxabi.h>
+#endif
+
+namespace AppCUI
+{
+using namespace Application::Profiler;
+
+constexpr uint32 PROFILER_OVERLAY_FRAMES   = 64; // frames used for the average/max values in the overlay
+constexpr uint32 PROFILER_OVERLAY_CONTROLS = 5;
+constexpr uint32 PROFILER_OVERLAY_WIDTH    = 60;
+
+std::string GetControlTypeName(Control* ctrl)
+{
+    const char* name = typeid(*ctrl).name();
+#if defined(__GNUC__) || defined(__clang__)
+    int status      = 0;
+    char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (demangled)
+    {
+        std::string result = (status == 0) ? std::string(demangled) : std::string(name);
+        free(demangled);
+        return result;
+    }
+#endif
+    return std::string(name);
+}
+void CollectPaintedControls(Control* ctrl, vector<ControlInfo>& list)
+{
+    if (ctrl == nullptr)
+        return;
+    CREATE_CONTROL_CONTEXT(ctrl, Members, );
+    if (Members->PaintProfile.Calls > 0)
+    {
+        list.push_back({ ctrl,
+                         GetControlTypeName(ctrl),
+                         Members->PaintProfile.Calls,
+                         Members->PaintProfile.TotalTime,
+                         Members->PaintProfile.MaxTime });
+    }
+    for (uint32 tr = 0; tr < Members->ControlsCount; tr++)
+        CollectPaintedControls(Members->Controls[tr], list);
+}
+void ResetPaintedControls(Control* ctrl)
+{
+    if (ctrl == nullptr)
+        return;
+    CREATE_CONTROL_CONTEXT(ctrl, Members, );
+    Members->PaintProfile.Calls     = 0;
+    Members->PaintProfile.TotalTime = 0;
+    Members->PaintProfile.MaxTime   = 0;
+    for (uint32 tr = 0; tr < Members->ControlsCount; tr++)
+        ResetPaintedControls(Members->Controls[tr]);
+}
+void BuildControlsSnapshot(Internal::ApplicationImpl* app, vector<ControlInfo>& list)
+{
+    list.clear();
+    CollectPaintedControls(app->AppDesktop, list);
+    for (uint32 tr = 0; tr < app->ModalControlsCount; tr++)
+        CollectPaintedControls(app->ModalControlsStack[tr], list);
+    std::sort(
+          list.begin(),
+          list.end(),
+          [](const ControlInfo& a, const ControlInfo& b) { return a.TotalPaintTime > b.TotalPaintTime; });
+}
+
+//=====================================================================================================[FrameProfiler]
+Internal::FrameProfiler::FrameProfiler()
+{
+    this->OverlayHotKey  = Input::Key::Ctrl | Input::Key::Alt | Input::Key::P;
+    this->Enabled        = false;
+    this->OverlayVisible = false;
+    ClearFrames();
+}
+uint64 Internal::FrameProfiler::Now()
+{
+    return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+void Internal::FrameProfiler::ClearFrames()
+{
+    this->FramesCount = 0;
+    this->NextFrame   = 0;
+    this->FrameIndex  = 0;
+    this->Current     = {};
+}
+void Internal::FrameProfiler::EndFrame(uint64 start)
+{
+    if ((this->Enabled) && (start != 0))
+    {
+        this->Current.FrameIndex      = this->FrameIndex++;
+        this->Current.TotalTime       = Now() - start;
+        this->Frames[this->NextFrame] = this->Current;
+        this->NextFrame               = (this->NextFrame + 1) % PROFILER_MAX_FRAMES;
+        if (this->FramesCount < PROFILER_MAX_FRAMES)
+            this->FramesCount++;
+    }
+    this->Current = {};
+}
+uint32 Internal::FrameProfiler::GetFramesCount() const
+{
+    return this->FramesCount;
+}
+const FrameInfo* Internal::FrameProfiler::GetFrame(uint32 index) const
+{
+    if (index >= this->FramesCount)
+        return nullptr;
+    return &this->Frames[(this->NextFrame + PROFILER_MAX_FRAMES - 1 - index) % PROFILER_MAX_FRAMES];
+}
+
+//=====================================================================================================[Overlay]
+void Internal::ApplicationImpl::PaintProfilerOverlay()
+{
+    auto& canvas   = this->terminal->ScreenCanvas;
+    const auto col = this->config.ToolTip.Text;
+    const int w    = (int) PROFILER_OVERLAY_WIDTH;
+    const int x    = std::max<>(0, (int) canvas.GetWidth() - w);
+    LocalString<128> tmp;
+
+    // average and max values over the last frames
+    FrameInfo avg = {}, max = {};
+    const auto cnt = std::min<>(this->Profiler.GetFramesCount(), PROFILER_OVERLAY_FRAMES);
+    for (uint32 tr = 0; tr < cnt; tr++)
+    {
+        const auto f = this->Profiler.GetFrame(tr);
+        avg.ComputePositionsTime += f->ComputePositionsTime;
+        avg.PaintTime += f->PaintTime;
+        avg.TerminalUpdateTime += f->TerminalUpdateTime;
+        avg.TotalTime += f->TotalTime;
+        avg.PaintedControls += f->PaintedControls;
+        max.ComputePositionsTime = std::max<>(max.ComputePositionsTime, f->ComputePositionsTime);
+        max.PaintTime            = std::max<>(max.PaintTime, f->PaintTime);
+        max.TerminalUpdateTime   = std::max<>(max.TerminalUpdateTime, f->TerminalUpdateTime);
+        max.TotalTime            = std::max<>(max.TotalTime, f->TotalTime);
+        max.PaintedControls      = std::max<>(max.PaintedControls, f->PaintedControls);
+    }
+    const double div = cnt > 0 ? (double) cnt * 1000000.0 : 1.0; // ns --> ms
+
+    vector<ControlInfo> controls;
+    BuildControlsSnapshot(this, controls);
+    const auto controlsCount = std::min<>((uint32) controls.size(), PROFILER_OVERLAY_CONTROLS);
+
+    canvas.ClearClip();
+    canvas.SetTranslate(0, 0);
+    canvas.FillRectSize(x, 0, w, 10 + controlsCount, ' ', col);
+    canvas.DrawRectSize(x, 0, w, 10 + controlsCount, col, LineType::Single);
+    canvas.WriteSingleLineText(x + 2, 0, " Profiler ", col);
+
+    canvas.WriteSingleLineText(x + 2, 1, tmp.Format("Last %u frames (avg / max ms)", cnt), col);
+    canvas.WriteSingleLineText(
+          x + 2,
+          2,
+          tmp.Format("Layout  : %8.3f / %8.3f", avg.ComputePositionsTime / div, max.ComputePositionsTime / 1000000.0),
+          col);
+    canvas.WriteSingleLineText(
+          x + 2, 3, tmp.Format("Paint   : %8.3f / %8.3f", avg.PaintTime / div, max.PaintTime / 1000000.0), col);
+    canvas.WriteSingleLineText(
+          x + 2,
+          4,
+          tmp.Format("Update  : %8.3f / %8.3f", avg.TerminalUpdateTime / div, max.TerminalUpdateTime / 1000000.0),
+          col);
+    canvas.WriteSingleLineText(
+          x + 2, 5, tmp.Format("Total   : %8.3f / %8.3f", avg.TotalTime / div, max.TotalTime / 1000000.0), col);
+    canvas.WriteSingleLineText(
+          x + 2,
+          6,
+          tmp.Format("Painted : %u / %u controls", cnt > 0 ? avg.PaintedControls / cnt : 0, max.PaintedControls),
+          col);
+    canvas.WriteSingleLineText(x + 2, 8, "Slowest controls   avg(us)  max(us)    calls", col);
+    for (uint32 tr = 0; tr < controlsCount; tr++)
+    {
+        const auto& c    = controls[tr];
+        string_view name = c.TypeName;
+        if (name.starts_with("AppCUI::Controls::"))
+            name = name.substr(18);
+        if (name.size() > 17)
+            name = name.substr(0, 17);
+        tmp.Format(
+              "%-17.*s %8.1f %8.1f %8llu",
+              (int) name.size(),
+              name.data(),
+              (double) c.TotalPaintTime / (c.PaintCalls * 1000.0),
+              (double) c.MaxPaintTime / 1000.0,
+              (unsigned long long) c.PaintCalls);
+        canvas.WriteSingleLineText(x + 2, 9 + tr, tmp, col);
+    }
+}
+//=====================================================================================================[API]
+void Application::Profiler::Enable(bool enabled)
+{
+    auto app = Application::GetApplication();
+    if (!app)
+        return;
+    if (app->Profiler.Enabled != enabled)
+        app->Profiler.Current = {};
+    app->Profiler.Enabled = enabled;
+    app->RepaintStatus |= REPAINT_STATUS_DRAW;
+}
+bool Application::Profiler::IsEnabled()
+{
+    auto app = Application::GetApplication();
+    return (app) && (app->Profiler.Enabled);
+}
+void Application::Profiler::Reset()
+{
+    auto app = Application::GetApplication();
+    if (!app)
+        return;
+    app->Profiler.ClearFrames();
+    app->Profiler.Snapshot.clear();
+    ResetPaintedControls(app->AppDesktop);
+    for (uint32 tr = 0; tr < app->ModalControlsCount; tr++)
+        ResetPaintedControls(app->ModalControlsStack[tr]);
+}
+void Application::Profiler::ShowOverlay(bool visible)
+{
+    auto app = Application::GetApplication();
+    if (!app)
+        return;
+    app->Profiler.OverlayVisible = visible;
+    app->RepaintStatus |= REPAINT_STATUS_DRAW;
+}
+void Application::Profiler::SetOverlayHotKey(Input::Key hotKey)
+{
+    auto app = Application::GetApplication();
+    if (app)
+        app->Profiler.OverlayHotKey = hotKey;
+}
+uint32 Application::Profiler::GetFramesCount()
+{
+    auto app = Application::GetApplication();
+    CHECK(app, 0, "Application has not been initialized !");
+    return app->Profiler.GetFramesCount();
+}
+bool Application::Profiler::GetFrame(uint32 index, FrameInfo& frame)
+{
+    auto app = Application::GetApplication();
+    CHECK(app, false, "Application has not been initialized !");
+    const auto f = app->Profiler.GetFrame(index);
+    CHECK(f, false, "Invalid frame index: %u (there are only %u frames)", index, app->Profiler.GetFramesCount());
+    frame = *f;
+    return true;
+}
+uint32 Application::Profiler::GetControlsCount()
+{
+    auto app = Application::GetApplication();
+    CHECK(app, 0, "Application has not been initialized !");
+    BuildControlsSnapshot(app, app->Profiler.Snapshot);
+    return (uint32) app->Profiler.Snapshot.size();
+}
+bool Application::Profiler::GetControl(uint32 index, ControlInfo& info)
+{
+    auto app = Application::GetApplication();
+    CHECK(app, false, "Application has not been initialized !");
+    CHECK(index < app->Profiler.Snapshot.size(),
+          false,
+          "Invalid control index: %u (call GetControlsCount() first to take a snapshot)",
+          index);
+    info = app->Profiler.Snapshot[index];
+    return true;
+}
+bool Application::Profiler::DumpToFile(const std::filesystem::path& path)
+{
+    auto app = Application::GetApplication();
+    CHECK(app, false, "Application has not been initialized !");
+    std::string content;
+    LocalString<256> tmp;
+
+    content += "# frames (times in microseconds, oldest first)\n";
+    content += "frame,compute_positions,paint,terminal_update,total,painted_controls\n";
+    for (uint32 tr = app->Profiler.GetFramesCount(); tr > 0; tr--)
+    {
+        const auto f = app->Profiler.GetFrame(tr - 1);
+        content += tmp.Format(
+              "%llu,%.3f,%.3f,%.3f,%.3f,%u\n",
+              (unsigned long long) f->FrameIndex,
+              f->ComputePositionsTime / 1000.0,
+              f->PaintTime / 1000.0,
+              f->TerminalUpdateTime / 1000.0,
+              f->TotalTime / 1000.0,
+              f->PaintedControls);
+    }
+    content += "\n# controls (times in microseconds, slowest first)\n";
+    content += "type,control,paint_calls,total_paint,avg_paint,max_paint\n";
+    vector<ControlInfo> controls;
+    BuildControlsSnapshot(app, controls);
+    for (const auto& c : controls)
+    {
+        content += tmp.Format(
+              "%s,%p,%llu,%.3f,%.3f,%.3f\n",
+              c.TypeName.c_str(),
+              (void*) c.Control,
+              (unsigned long long) c.PaintCalls,
+              c.TotalPaintTime / 1000.0,
+              (double) c.TotalPaintTime / (c.PaintCalls * 1000.0),
+              c.MaxPaintTime / 1000.0);
+    }
+    CHECK(OS::File::WriteContent(path, string_view(content)), false, "Fail to write profiler data !");
+    return true;
+}
+} // namespace AppCUI
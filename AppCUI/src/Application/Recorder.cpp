@@ -0,0 +1,223 @@
+#include "Internal.hpp"
+
+#include <thread>
+
+namespace AppCUI
+{
+using namespace Internal::CellStream;
+
+constexpr size_t RECORDER_FLUSH_SIZE = 64 * 1024; // encoded frames are written in blocks of (at least) this size
+constexpr size_t RECORDER_MIN_RUN    = 2;
+
+static_assert(sizeof(Graphics::Character) == sizeof(uint32), "A character should be encoded as its PackedValue");
+
+static inline void WriteOperation(std::vector<uint8>& output, uint32 type, size_t count)
+{
+    uint64 value = (((uint64) count) << 2) | type;
+    while (value >= 0x80)
+    {
+        output.push_back((uint8) (value | 0x80));
+        value >>= 7;
+    }
+    output.push_back((uint8) value);
+}
+// the first character from [pos, count) that differs from the previous frame (count if there is none) - only the
+// rest of the current line is compared character by character, the next lines are compared with memcmp
+static size_t FindNextChange(
+      const Graphics::Character* characters, const uint32* previous, size_t pos, size_t count, uint32 width)
+{
+    auto lineEnd = std::min<>((pos / width + 1) * width, count);
+    while (true)
+    {
+        for (; pos < lineEnd; pos++)
+            if (characters[pos].PackedValue != previous[pos])
+                return pos;
+        if (pos >= count)
+            return count;
+        lineEnd = std::min<>(pos + width, count);
+        if (memcmp(characters + pos, previous + pos, (lineEnd - pos) * sizeof(uint32)) == 0)
+            pos = lineEnd;
+    }
+}
+static inline void WriteValues(std::vector<uint8>& output, const Graphics::Character* characters, size_t count)
+{
+    const auto pos = output.size();
+    output.resize(pos + count * sizeof(uint32));
+    memcpy(output.data() + pos, characters, count * sizeof(uint32));
+}
+
+Internal::ScreenRecorder::~ScreenRecorder()
+{
+    Close();
+}
+bool Internal::ScreenRecorder::Create(const std::filesystem::path& path, uint32 interval)
+{
+    CHECK(interval > 0, false, "Key frame interval should be at least 1");
+    CHECK(this->file.Create(path, true), false, "Fail to create recording file: %s", path.string().c_str());
+    const FileHeader header = { FILE_MAGIC, FORMAT_VERSION, 0 };
+    CHECK(this->file.Write(header), false, "Fail to write recording header");
+    this->output.clear();
+    this->output.reserve(RECORDER_FLUSH_SIZE * 2);
+    this->previous.clear();
+    this->start               = std::chrono::steady_clock::now();
+    this->width               = 0;
+    this->height              = 0;
+    this->cursorX             = 0;
+    this->cursorY             = 0;
+    this->cursorVisible       = false;
+    this->keyFrameInterval    = interval;
+    this->framesSinceKeyFrame = 0;
+    return true;
+}
+bool Internal::ScreenRecorder::AddFrame(const Graphics::Canvas& screen)
+{
+    const auto w     = screen.GetWidth();
+    const auto h     = screen.GetHeight();
+    const auto count = (size_t) w * h;
+    const auto* c    = screen.GetCharactersBuffer();
+    CHECK((c) && (count > 0), false, "Screen canvas was not created");
+
+    const auto sameSize   = (w == this->width) && (h == this->height) && (this->previous.size() == count);
+    auto* p               = this->previous.data();
+    const auto sameCursor = (screen.GetCursorVisibility() == this->cursorVisible) &&
+                            (screen.GetCursorX() == this->cursorX) && (screen.GetCursorY() == this->cursorY);
+    const auto firstChange = sameSize ? FindNextChange(c, p, 0, count, w) : 0;
+    if ((sameSize) && (sameCursor) && (firstChange == count))
+        return true; // same frame as the previous one
+    const auto keyFrame = (!sameSize) || (this->framesSinceKeyFrame >= this->keyFrameInterval);
+
+    // the header is filled after the characters are encoded (its size is not known yet)
+    const auto headerPos = this->output.size();
+    this->output.resize(headerPos + sizeof(FrameHeader));
+    size_t i = 0;
+    while (i < count)
+    {
+        auto j = i + 1;
+        if ((!keyFrame) && (c[i].PackedValue == p[i]))
+        {
+            j = i == 0 ? firstChange : FindNextChange(c, p, j, count, w);
+            WriteOperation(this->output, OP_SKIP, j - i);
+            i = j;
+            continue;
+        }
+        while ((j < count) && (c[j].PackedValue == c[i].PackedValue))
+            j++;
+        if (j - i >= RECORDER_MIN_RUN)
+        {
+            WriteOperation(this->output, OP_RUN, j - i);
+            WriteValues(this->output, c + i, 1);
+        }
+        else
+        {
+            // different values - up to the first character that did not change or the first run
+            while ((j < count) && ((keyFrame) || (c[j].PackedValue != p[j])) &&
+                   ((j + 1 == count) || (c[j].PackedValue != c[j + 1].PackedValue)))
+                j++;
+            WriteOperation(this->output, OP_LITERAL, j - i);
+            WriteValues(this->output, c + i, j - i);
+        }
+        // delta frames --> only the characters that changed are copied in the previous frame
+        if (!keyFrame)
+            memcpy(p + i, c + i, (j - i) * sizeof(uint32));
+        i = j;
+    }
+
+    FrameHeader header;
+    header.size          = (uint32) (this->output.size() - headerPos - sizeof(FrameHeader));
+    header.type          = keyFrame ? KEY_FRAME : DELTA_FRAME;
+    header.cursorVisible = screen.GetCursorVisibility() ? 1 : 0;
+    header.reserved      = 0;
+    header.time          = (uint64) std::chrono::duration_cast<std::chrono::microseconds>(
+                                 std::chrono::steady_clock::now() - this->start)
+                                 .count();
+    header.width         = (uint16) w;
+    header.height        = (uint16) h;
+    header.cursorX       = (uint16) screen.GetCursorX();
+    header.cursorY       = (uint16) screen.GetCursorY();
+    memcpy(this->output.data() + headerPos, &header, sizeof(header));
+
+    if (keyFrame)
+    {
+        this->previous.resize(count);
+        memcpy(this->previous.data(), c, count * sizeof(uint32));
+    }
+    this->width               = w;
+    this->height              = h;
+    this->cursorX             = screen.GetCursorX();
+    this->cursorY             = screen.GetCursorY();
+    this->cursorVisible       = screen.GetCursorVisibility();
+    this->framesSinceKeyFrame = keyFrame ? 1 : this->framesSinceKeyFrame + 1;
+    if (this->output.size() >= RECORDER_FLUSH_SIZE)
+        return Flush();
+    return true;
+}
+bool Internal::ScreenRecorder::Flush()
+{
+    if (this->output.empty())
+        return true;
+    CHECK(this->file.Write(this->output.data(), (uint32) this->output.size()), false, "Fail to write recorded frames");
+    this->output.clear();
+    return true;
+}
+bool Internal::ScreenRecorder::Close()
+{
+    const auto result = Flush();
+    this->file.Close();
+    return result;
+}
+
+//=====================================================================================================[API]
+bool Application::Recorder::Start(const std::filesystem::path& path, uint32 keyFrameInterval)
+{
+    auto app = Application::GetApplication();
+    CHECK(app, false, "Application has not been initialized !");
+    CHECK(app->terminal, false, "No terminal was associated/linked to current app");
+    CHECK(!app->terminal->Recorder, false, "A recording is already in progress (call Stop first)");
+    auto recorder = std::make_unique<Internal::ScreenRecorder>();
+    CHECK(recorder->Create(path, keyFrameInterval), false, "");
+    app->terminal->Recorder = std::move(recorder);
+    app->RepaintStatus |= REPAINT_STATUS_DRAW; // the first frame is the current screen
+    return true;
+}
+bool Application::Recorder::Stop()
+{
+    auto app = Application::GetApplication();
+    CHECK(app, false, "Application has not been initialized !");
+    CHECK((app->terminal) && (app->terminal->Recorder), false, "No recording is in progress");
+    const auto result = app->terminal->Recorder->Close();
+    app->terminal->Recorder.reset();
+    return result;
+}
+bool Application::Recorder::IsRecording()
+{
+    auto app = Application::GetApplication();
+    return (app) && (app->terminal) && (app->terminal->Recorder);
+}
+bool Application::Recorder::Replay(const std::filesystem::path& path, bool realTime)
+{
+    auto app = Application::GetApplication();
+    CHECK(app, false, "Application has not been initialized !");
+    CHECK(app->terminal, false, "No terminal was associated/linked to current app");
+    Graphics::ScreenRecording recording;
+    CHECK(recording.Open(path), false, "Fail to open recording: %s", path.string().c_str());
+
+    Graphics::Canvas frame;
+    auto& screen     = app->terminal->ScreenCanvas;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32 tr = 0; tr < recording.GetFramesCount(); tr++)
+    {
+        CHECK(recording.DrawFrame(tr, frame), false, "Fail to decode frame %u", tr);
+        if (realTime)
+            std::this_thread::sleep_until(start + std::chrono::microseconds(recording.GetFrameTime(tr)));
+        screen.ClearEntireSurface(' ', Graphics::DefaultColorPair);
+        screen.DrawCanvas(0, 0, frame);
+        if (frame.GetCursorVisibility())
+            screen.SetCursor(frame.GetCursorX(), frame.GetCursorY());
+        else
+            screen.HideCursor();
+        app->terminal->Update();
+    }
+    app->RepaintStatus = REPAINT_STATUS_ALL; // the application is painted again after the replay
+    return true;
+}
+} // namespace AppCUI
@@ -1,8 +1,13 @@
 #pragma once
 
 #include "Internal.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <optional>
 #include <set>
+#include <thread>
+#include <unordered_map>
 
 namespace AppCUI
 {
@@ -67,7 +72,7 @@ struct LayoutMetricData
 struct ControlContext
 {
   public:
-    Graphics::Clip ScreenClip, ExpandedViewClip;
+    Graphics::Clip ScreenClip, ExpandedViewClip, ClientClip;
     struct
     {
         struct
@@ -86,6 +91,15 @@ struct ControlContext
         int Left, Top, Right, Bottom;
     } Margins;
     struct
+    {
+        uint64 Calls, TotalTime, MaxTime;
+    } PaintProfile;
+    struct
+    {
+        bool Self;     // own position/size/margins changed --> recompute this subtree
+        bool Children; // at least one descendant has Self set
+    } LayoutDirty;
+    struct
     {
         uint32 TopMargin;
         uint32 LeftMargin;
@@ -121,13 +135,14 @@ struct ControlContext
     bool ProcessTLBAnchors(LayoutInformation& inf);
     bool ProcessTRBAnchors(LayoutInformation& inf);
     bool ProcessLTRBAnchors(LayoutInformation& inf);
-    bool UpdateLayoutFormat(string_view format);
+    bool UpdateLayoutFormat(const ConstLayout& format);
     void SetControlSize(uint32 width, uint32 heigh);
     bool RecomputeLayout_PointAndSize(const LayoutMetricData& md);
     bool RecomputeLayout_LeftRightAnchorsAndHeight(const LayoutMetricData& md);
     bool RecomputeLayout_TopBottomAnchorsAndWidth(const LayoutMetricData& md);
 
     bool RecomputeLayout(Control* parent);
+    void MarkLayoutDirty();
     void PaintScrollbars(Graphics::Renderer& renderer);
 
     constexpr inline ControlState GetControlState(ControlStateFlags stateFlags)
@@ -280,6 +295,12 @@ struct WindowControlContext : public ControlContext
         unsigned char Current;
         bool IsCurrentItemPressed;
     } ControlBar;
+    struct
+    {
+        std::unordered_map<Input::Key, Controls::Control*> Table;
+        uint32 Version;
+        bool Built;
+    } HotKeys;
     bool Maximized;
     bool ResizeMoveMode;
 
@@ -445,7 +466,88 @@ struct CanvasControlContext : public ControlContext
     Graphics::Canvas canvas;
     int CanvasScrollX, CanvasScrollY, mouseDragX, mouseDragY;
     bool dragModeEnabled;
+    // when set, the canvas only holds the visible part of a larger surface (surfaceWidth x surfaceHeight) that is
+    // drawn by the owner control, and the scroll position is relative to that surface
+    bool canvasIsViewport;
+    uint32 surfaceWidth, surfaceHeight;
     void MoveScrollTo(int newX, int newY);
+    inline uint32 GetSurfaceWidth() const
+    {
+        return canvasIsViewport ? surfaceWidth : canvas.GetWidth();
+    }
+    inline uint32 GetSurfaceHeight() const
+    {
+        return canvasIsViewport ? surfaceHeight : canvas.GetHeight();
+    }
+};
+struct ImageViewControlContext : public CanvasControlContext
+{
+    Graphics::ImageIntegral integral; // only kept for images with an arbitrary scale
+    Graphics::TiledImage tiled;       // very large images --> only the visible part is rendered
+    Graphics::ImageRenderingMethod method;
+    double scale;
+    bool scaleToFit;
+    struct
+    {
+        int x, y;
+        uint32 width, height;
+        bool valid;
+    } viewport; // last region of the image that was rendered in the canvas
+    bool Render();
+    bool RenderViewport();
+    inline bool IsScalable() const
+    {
+        return integral.IsValid() || tiled.IsValid();
+    }
+    inline uint32 GetImageWidth() const
+    {
+        return tiled.IsValid() ? tiled.GetWidth() : integral.GetWidth();
+    }
+    inline uint32 GetImageHeight() const
+    {
+        return tiled.IsValid() ? tiled.GetHeight() : integral.GetHeight();
+    }
+};
+struct VideoViewControlContext : public CanvasControlContext
+{
+    // changed columns [left, right) of a line of characters (left == right --> nothing changed)
+    struct LineChange
+    {
+        uint32 left, right;
+    };
+    struct Frame
+    {
+        Graphics::Canvas cells;
+        std::vector<LineChange> changes; // compared to the previous decoded frame
+        uint64 position;                 // frames since the playback started (index = position % frames count)
+        bool keyFrame;                   // all characters have to be copied
+    };
+    // decoding thread
+    std::unique_ptr<Graphics::FrameSource> source;
+    std::unique_ptr<Frame[]> ring;
+    std::thread worker;
+    std::mutex lock;
+    std::condition_variable frameConsumed;
+    uint64 readPos, writePos;    // frames in the ring: [readPos, writePos)
+    uint64 nextPosition;         // next position to decode
+    uint64 targetPosition;       // positions behind this one are not decoded any more
+    uint64 endPosition;          // playback stops after this position (no loop)
+    uint32 generation;           // changed by Stop --> a frame that is decoded while stopping is discarded
+    bool stopWorker, needKeyFrame;
+    // presentation (UI thread)
+    std::chrono::steady_clock::time_point startTime;
+    std::vector<LineChange> pendingChanges;
+    uint64 startPosition, presentedPosition, droppedFrames;
+    uint32 framesCount, framesPerSecond;
+    bool playing, loop, presentedAny;
+
+    ~VideoViewControlContext();
+    bool Start(std::unique_ptr<Graphics::FrameSource> frameSource, uint32 fps);
+    void StopWorker();
+    void Reset();
+    void DecodeFrames();
+    bool Present();
+    uint64 GetCurrentPosition() const;
 };
 
 constexpr uint32 MAX_LISTVIEW_COLUMNS     = 64;
@@ -1096,6 +1198,12 @@ struct MenuContext
     uint32 CurrentItem;
     uint32 Width, TextWidth;
     MenuButtonState ButtonUp, ButtonDown;
+    struct
+    {
+        std::unordered_map<Input::Key, std::pair<MenuContext*, uint32>> Table;
+        uint32 Version;
+        bool Built;
+    } Shortcuts;
 
     MenuContext();
     ItemHandle AddItem(unique_ptr<MenuItem> itm);
@@ -1125,6 +1233,7 @@ struct MenuContext
 
     // key events
     bool OnKeyEvent(Input::Key keyCode);
+    void BuildShortcutsTable(MenuContext* root);
     bool ProcessShortCut(Input::Key keyCode);
 
     // Show
@@ -4,8 +4,8 @@ namespace AppCUI
 {
 void CanvasControlContext::MoveScrollTo(int newX, int newY)
 {
-    const int imgWidth  = canvas.GetWidth();
-    const int imgHeight = canvas.GetHeight();
+    const int imgWidth  = GetSurfaceWidth();
+    const int imgHeight = GetSurfaceHeight();
     int viewWidth       = Layout.Width;
     int viewHeight      = Layout.Height;
 
@@ -28,8 +28,18 @@ void CanvasControlContext::MoveScrollTo(int newX, int newY)
 }
 
 CanvasViewer::CanvasViewer(
-      const ConstString& caption, string_view layout, uint32 canvasWidth, uint32 canvasHeight, ViewerFlags flags)
-    : Control(new CanvasControlContext(), caption, layout, true)
+      const ConstString& caption, const ConstLayout& layout, uint32 canvasWidth, uint32 canvasHeight, ViewerFlags flags)
+    : CanvasViewer(new CanvasControlContext(), caption, layout, canvasWidth, canvasHeight, flags)
+{
+}
+CanvasViewer::CanvasViewer(
+      void* context,
+      const ConstString& caption,
+      const ConstLayout& layout,
+      uint32 canvasWidth,
+      uint32 canvasHeight,
+      ViewerFlags flags)
+    : Control(context, caption, layout, true)
 {
     auto Members = reinterpret_cast<CanvasControlContext*>(this->Context);
 
@@ -43,6 +53,9 @@ CanvasViewer::CanvasViewer(
     Members->mouseDragX                = 0;
     Members->mouseDragY                = 0;
     Members->dragModeEnabled           = false;
+    Members->canvasIsViewport          = false;
+    Members->surfaceWidth              = 0;
+    Members->surfaceHeight             = 0;
     Members->ScrollBars.OutsideControl = !(Members->Flags && ViewerFlags::Border);
     ASSERT(Members->canvas.Create(canvasWidth, canvasHeight), "Fail to create a canvas of size object !");
 }
@@ -86,14 +99,15 @@ void CanvasViewer::Paint(Graphics::Renderer& renderer)
             return; // clipping is not visible --> no need to try to draw the rest
         left = top = 1;
     }
+    if (!Members->canvasIsViewport)
+    {
+        left += Members->CanvasScrollX;
+        top += Members->CanvasScrollY;
+    }
     if (!this->IsEnabled())
-        renderer.DrawCanvas(
-              Members->CanvasScrollX + left,
-              Members->CanvasScrollY + top,
-              Members->canvas,
-              Members->Cfg->Text.Inactive);
+        renderer.DrawCanvas(left, top, Members->canvas, Members->Cfg->Text.Inactive);
     else
-        renderer.DrawCanvas(Members->CanvasScrollX + left, Members->CanvasScrollY + top, Members->canvas);
+        renderer.DrawCanvas(left, top, Members->canvas);
 }
 
 void CanvasViewer::OnUpdateScrollBars()
@@ -103,16 +117,16 @@ void CanvasViewer::OnUpdateScrollBars()
     uint32 borderSize = Members->Flags && ViewerFlags::Border ? 2 : 0;
 
     // horizontal
-    if (Members->canvas.GetHeight() > (borderSize + (uint32) Members->Layout.Height))
+    if (Members->GetSurfaceHeight() > (borderSize + (uint32) Members->Layout.Height))
         UpdateVScrollBar(
-              -Members->CanvasScrollY, Members->canvas.GetHeight() - (borderSize + (uint32) Members->Layout.Height));
+              -Members->CanvasScrollY, Members->GetSurfaceHeight() - (borderSize + (uint32) Members->Layout.Height));
     else
         UpdateVScrollBar(-Members->CanvasScrollY, 0);
 
     // vertical
-    if (Members->canvas.GetWidth() > (borderSize + (uint32) Members->Layout.Width))
+    if (Members->GetSurfaceWidth() > (borderSize + (uint32) Members->Layout.Width))
         UpdateHScrollBar(
-              -Members->CanvasScrollX, Members->canvas.GetWidth() - (borderSize + (uint32) Members->Layout.Width));
+              -Members->CanvasScrollX, Members->GetSurfaceWidth() - (borderSize + (uint32) Members->Layout.Width));
     else
         UpdateHScrollBar(-Members->CanvasScrollX, 0);
 }
@@ -140,13 +154,13 @@ bool CanvasViewer::OnKeyEvent(Input::Key KeyCode, char16)
         Members->MoveScrollTo(0, Members->CanvasScrollY);
         return true;
     case Key::Ctrl | Key::Right:
-        Members->MoveScrollTo(-((int) Members->canvas.GetWidth()), Members->CanvasScrollY);
+        Members->MoveScrollTo(-((int) Members->GetSurfaceWidth()), Members->CanvasScrollY);
         return true;
     case Key::Ctrl | Key::Up:
         Members->MoveScrollTo(Members->CanvasScrollX, 0);
         return true;
     case Key::Ctrl | Key::Down:
-        Members->MoveScrollTo(Members->CanvasScrollX, -((int) Members->canvas.GetHeight()));
+        Members->MoveScrollTo(Members->CanvasScrollX, -((int) Members->GetSurfaceHeight()));
         return true;
 
     case Key::Shift | Key::Left:
@@ -166,7 +180,7 @@ bool CanvasViewer::OnKeyEvent(Input::Key KeyCode, char16)
         Members->MoveScrollTo(0, 0);
         return true;
     case Key::End:
-        Members->MoveScrollTo(-((int) Members->canvas.GetWidth()), -((int) Members->canvas.GetHeight()));
+        Members->MoveScrollTo(-((int) Members->GetSurfaceWidth()), -((int) Members->GetSurfaceHeight()));
         return true;
     default:
         break;
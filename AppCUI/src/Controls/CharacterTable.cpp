@@ -243,7 +243,7 @@ void CharacterTableContext::Paint(Graphics::Renderer& renderer)
             break;
     }
 }
-CharacterTable::CharacterTable(string_view layout) : Control(new CharacterTableContext(), "", layout, false)
+CharacterTable::CharacterTable(const ConstLayout& layout) : Control(new CharacterTableContext(), "", layout, false)
 {
     auto Members              = reinterpret_cast<CharacterTableContext*>(this->Context);
     Members->Layout.MinWidth  = 10;
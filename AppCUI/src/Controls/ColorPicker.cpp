@@ -227,7 +227,7 @@ bool ColorPickerContext::OnKeyEvent(Input::Key keyCode)
     return false;
 }
 
-ColorPicker::ColorPicker(string_view layout, Graphics::Color _color)
+ColorPicker::ColorPicker(const ConstLayout& layout, Graphics::Color _color)
     : Control(new ColorPickerContext(), "", layout, false)
 {
     auto Members              = reinterpret_cast<ColorPickerContext*>(this->Context);
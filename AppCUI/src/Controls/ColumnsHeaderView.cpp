@@ -183,12 +183,12 @@ bool ColumnsHeaderView::TableBuilder::Finalize()
 }
 
 ColumnsHeaderView::ColumnsHeaderView(
-      string_view layout, std::initializer_list<ConstString> columnsList, ColumnsHeaderViewFlags flags)
+      const ConstLayout& layout, std::initializer_list<ConstString> columnsList, ColumnsHeaderViewFlags flags)
     : ColumnsHeaderView(new ColumnsHeaderViewControlContext(this, columnsList, flags), layout)
 {
 }
 // context MUST be a derivate of ColumnsHeaderViewControlContext
-ColumnsHeaderView::ColumnsHeaderView(void* context, string_view layout) : Control(context, "", layout, false)
+ColumnsHeaderView::ColumnsHeaderView(void* context, const ConstLayout& layout) : Control(context, "", layout, false)
 {
     ICH->CopyToClipboard.format = CopyClipboardFormat::TextWithTabs;
     ICH->CopyToClipboard.flags  = CopyClipboardFlags::None;
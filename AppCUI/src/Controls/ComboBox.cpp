@@ -191,7 +191,7 @@ ComboBox::~ComboBox()
 {
     DELETE_CONTROL_CONTEXT(ComboBoxControlContext);
 }
-ComboBox::ComboBox(string_view layout, const ConstString& text, char itemsSeparator)
+ComboBox::ComboBox(const ConstLayout& layout, const ConstString& text, char itemsSeparator)
     : Control(new ComboBoxControlContext(), "", layout, false)
 {
     auto Members                    = reinterpret_cast<ComboBoxControlContext*>(this->Context);
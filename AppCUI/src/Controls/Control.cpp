@@ -6,19 +6,33 @@ namespace AppCUI
 {
 #define CTRLC ((ControlContext*) Context)
 
-constexpr uint16 LAYOUT_FLAG_X      = 0x0001;
-constexpr uint16 LAYOUT_FLAG_Y      = 0x0002;
-constexpr uint16 LAYOUT_FLAG_LEFT   = 0x0004;
-constexpr uint16 LAYOUT_FLAG_RIGHT  = 0x0008;
-constexpr uint16 LAYOUT_FLAG_TOP    = 0x0010;
-constexpr uint16 LAYOUT_FLAG_BOTTOM = 0x0020;
-constexpr uint16 LAYOUT_FLAG_WIDTH  = 0x0040;
-constexpr uint16 LAYOUT_FLAG_HEIGHT = 0x0080;
-constexpr uint16 LAYOUT_FLAG_ALIGN  = 0x0100;
-constexpr uint16 LAYOUT_FLAG_DOCK   = 0x0200;
+// same bits as the ones a precompiled layout uses (so its field mask can be copied as it is)
+constexpr uint16 LAYOUT_FLAG_X      = PrecompiledLayout::FIELD_X;
+constexpr uint16 LAYOUT_FLAG_Y      = PrecompiledLayout::FIELD_Y;
+constexpr uint16 LAYOUT_FLAG_LEFT   = PrecompiledLayout::FIELD_LEFT;
+constexpr uint16 LAYOUT_FLAG_RIGHT  = PrecompiledLayout::FIELD_RIGHT;
+constexpr uint16 LAYOUT_FLAG_TOP    = PrecompiledLayout::FIELD_TOP;
+constexpr uint16 LAYOUT_FLAG_BOTTOM = PrecompiledLayout::FIELD_BOTTOM;
+constexpr uint16 LAYOUT_FLAG_WIDTH  = PrecompiledLayout::FIELD_WIDTH;
+constexpr uint16 LAYOUT_FLAG_HEIGHT = PrecompiledLayout::FIELD_HEIGHT;
+constexpr uint16 LAYOUT_FLAG_ALIGN  = PrecompiledLayout::FIELD_ALIGN;
+constexpr uint16 LAYOUT_FLAG_DOCK   = PrecompiledLayout::FIELD_DOCK;
 
 Control* currentControlBeingFocused = nullptr;
 
+inline void InvalidateHitTestMap()
+{
+    auto app = Application::GetApplication();
+    if (app)
+        app->HitTest.Invalidate();
+}
+inline void InvalidateHotKeyTables()
+{
+    auto app = Application::GetApplication();
+    if (app)
+        app->HotKeysVersion++;
+}
+
 // for gcc, building a field should look like var.field, not var.##field
 // http://gcc.gnu.org/onlinedocs/cpp/Concatenation.html
 #define SET_LAYOUT_INFO(flag, field)                                                                                   \
@@ -463,6 +477,25 @@ bool AnalyzeLayout(string_view layout, LayoutInformation& inf)
     return true;
 }
 
+inline LayoutValue ToLayoutValue(const PrecompiledLayout::Value& v)
+{
+    return { v.Number, v.IsPercentage ? LayoutValueType::Percentage : LayoutValueType::CharacterOffset };
+}
+void LoadPrecompiledLayout(const PrecompiledLayout& layout, LayoutInformation& inf)
+{
+    inf.flags    = layout.Fields;
+    inf.x        = ToLayoutValue(layout.X);
+    inf.y        = ToLayoutValue(layout.Y);
+    inf.a_left   = ToLayoutValue(layout.Left);
+    inf.a_right  = ToLayoutValue(layout.Right);
+    inf.a_top    = ToLayoutValue(layout.Top);
+    inf.a_bottom = ToLayoutValue(layout.Bottom);
+    inf.width    = ToLayoutValue(layout.Width);
+    inf.height   = ToLayoutValue(layout.Height);
+    inf.align    = layout.Align;
+    inf.dock     = layout.Dock;
+}
+
 ControlContext::ControlContext()
 {
     this->Controls            = nullptr;
@@ -491,6 +524,29 @@ ControlContext::ControlContext()
     this->ScrollBars.MaxVerticalValue              = 0;
     this->ScrollBars.OutsideControl                = false;
     this->handlers                                 = nullptr;
+    this->LayoutDirty.Self                         = false;
+    this->LayoutDirty.Children                     = false;
+    this->PaintProfile.Calls                       = 0;
+    this->PaintProfile.TotalTime                   = 0;
+    this->PaintProfile.MaxTime                     = 0;
+}
+void ControlContext::MarkLayoutDirty()
+{
+    this->LayoutDirty.Self = true;
+    // let the ancestors know that one of their descendants needs a new clip
+    // (stop as soon as one of them already knows it)
+    auto p = this->Parent;
+    while (p)
+    {
+        auto pMembers = reinterpret_cast<ControlContext*>(p->Context);
+        if ((pMembers == nullptr) || (pMembers->LayoutDirty.Children))
+            break;
+        pMembers->LayoutDirty.Children = true;
+        p                              = pMembers->Parent;
+    }
+    auto app = AppCUI::Application::GetApplication();
+    if (app)
+        app->RepaintStatus |= REPAINT_STATUS_COMPUTE_DIRTY_POSITION;
 }
 bool ControlContext::ProcessDockedLayout(LayoutInformation& inf)
 {
@@ -767,10 +823,15 @@ bool ControlContext::ProcessLTRBAnchors(LayoutInformation& inf)
 
     return true;
 }
-bool ControlContext::UpdateLayoutFormat(string_view format)
+bool ControlContext::UpdateLayoutFormat(const ConstLayout& format)
 {
     LayoutInformation inf;
-    CHECK(AnalyzeLayout(format, inf), false, "Fail to load format data !");
+    if (std::holds_alternative<PrecompiledLayout>(format))
+        LoadPrecompiledLayout(std::get<PrecompiledLayout>(format), inf);
+    else
+    {
+        CHECK(AnalyzeLayout(std::get<string_view>(format), inf), false, "Fail to load format data !");
+    }
 
     // check if layout params are OK
     // Step 1 ==> if dock option is present
@@ -1081,7 +1142,7 @@ Controls::Control::~Control()
 {
     DELETE_CONTROL_CONTEXT(ControlContext);
 }
-Controls::Control::Control(void* context, const ConstString& caption, string_view layout, bool computeHotKey)
+Controls::Control::Control(void* context, const ConstString& caption, const ConstLayout& layout, bool computeHotKey)
 {
     ASSERT(context, "Expecting a valid context in Control::Control() ctor");
     Application::Config* cfg = Application::GetAppConfig();
@@ -1162,7 +1223,10 @@ Reference<Control> Controls::Control::AddChildControl(unique_ptr<Control> ctrl)
     // Force a recompute layout on the entire app
     auto app = Application::GetApplication();
     if (app)
+    {
         app->RepaintStatus = REPAINT_STATUS_ALL;
+        app->HotKeysVersion++;
+    }
     return p_ctrl;
 }
 bool Controls::Control::RemoveControl(Control* control)
@@ -1217,6 +1281,8 @@ bool Controls::Control::RemoveControlByID(uint32 index)
     }
     CTRLC->ControlsCount--;
     CTRLC->CurrentControlIndex = 0;
+    InvalidateHitTestMap();
+    InvalidateHotKeyTables();
     return true;
 }
 int Controls::Control::GetX() const
@@ -1288,6 +1354,8 @@ void Controls::Control::SetEnabled(const bool value)
         CTRLC->Flags |= GATTR_ENABLE;
     else
         CTRLC->Flags -= ((CTRLC->Flags) & GATTR_ENABLE);
+    InvalidateHitTestMap();
+    InvalidateHotKeyTables();
 }
 void Controls::Control::SetVisible(const bool value)
 {
@@ -1295,6 +1363,8 @@ void Controls::Control::SetVisible(const bool value)
         CTRLC->Flags |= GATTR_VISIBLE;
     else
         CTRLC->Flags -= ((CTRLC->Flags) & GATTR_VISIBLE);
+    InvalidateHitTestMap();
+    InvalidateHotKeyTables();
 }
 
 bool Controls::Control::IsChecked() const
@@ -1384,9 +1454,10 @@ void Controls::Control::MoveTo(int newX, int newY)
         return;
     if ((newX == CTRLC->Layout.X) && (newY == CTRLC->Layout.Y))
         return;
-    CTRLC->Layout.X                                      = newX;
-    CTRLC->Layout.Y                                      = newY;
-    AppCUI::Application::GetApplication()->RepaintStatus = REPAINT_STATUS_ALL;
+    CTRLC->Layout.X = newX;
+    CTRLC->Layout.Y = newY;
+    CTRLC->MarkLayoutDirty();
+    AppCUI::Application::GetApplication()->RepaintStatus |= REPAINT_STATUS_DRAW;
 }
 bool Controls::Control::Resize(int newWidth, int newHeight)
 {
@@ -1426,7 +1497,7 @@ void Controls::Control::RecomputeLayout()
         CTRLC->Controls[tr]->RecomputeLayout();
     }
     OnAfterResize(CTRLC->Layout.Width, CTRLC->Layout.Height);
-    AppCUI::Application::GetApplication()->RepaintStatus = REPAINT_STATUS_COMPUTE_POSITION;
+    CTRLC->MarkLayoutDirty();
 }
 bool Controls::Control::SetText(const ConstString& caption, bool updateHotKey)
 {
@@ -1436,6 +1507,7 @@ bool Controls::Control::SetText(const ConstString& caption, bool updateHotKey)
     {
         if (CTRLC->Text.SetWithHotKey(caption, CTRLC->HotKeyOffset, CTRLC->HotKey, Key::Alt, NoColorPair) == false)
             return false;
+        InvalidateHotKeyTables();
     }
     else
     {
@@ -1543,6 +1615,7 @@ bool Controls::Control::SetHotKey(char16 hotKey)
 {
     CTRLC->HotKeyOffset = CharacterBuffer::INVALID_HOTKEY_OFFSET;
     CTRLC->HotKey       = Utils::KeyUtils::CreateHotKey(hotKey, Key::Alt);
+    InvalidateHotKeyTables();
     this->OnHotKeyChanged();
     return CTRLC->HotKey != Key::None;
 }
@@ -1556,6 +1629,7 @@ bool Controls::Control::SetMargins(int left, int top, int right, int bottom)
     CTRLC->Margins.Right  = right;
     CTRLC->Margins.Top    = top;
     CTRLC->Margins.Bottom = bottom;
+    CTRLC->MarkLayoutDirty();
     return true;
 }
 Input::Key Controls::Control::GetHotKey()
@@ -1566,6 +1640,7 @@ void Controls::Control::ClearHotKey()
 {
     CTRLC->HotKey       = Key::None;
     CTRLC->HotKeyOffset = CharacterBuffer::INVALID_HOTKEY_OFFSET;
+    InvalidateHotKeyTables();
 }
 uint32 Controls::Control::GetHotKeyTextOffset()
 {
@@ -1650,6 +1725,8 @@ bool Controls::Control::SetFocus()
     auto app = Application::GetApplication();
     app->RepaintStatus |= REPAINT_STATUS_DRAW;
     app->cmdBarUpdate = true;
+    // focus order decides which of the overlapping children gets the mouse first
+    app->HitTest.Invalidate();
     return true;
 }
 bool Controls::Control::ShowToolTip(const ConstString& caption)
@@ -7,164 +7,172 @@
 namespace AppCUI
 {
 //======[LABEL]======================================================================================
-POINTER<Label> Factory::Label::Create(const ConstString& caption, string_view layout)
+POINTER<Label> Factory::Label::Create(const ConstString& caption, const ConstLayout& layout)
 {
     return POINTER<Controls::Label>(new Controls::Label(caption, layout));
 }
-REFERENCE<Label> Factory::Label::Create(Control* parent, const ConstString& caption, string_view layout)
+REFERENCE<Label> Factory::Label::Create(Control* parent, const ConstString& caption, const ConstLayout& layout)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::Label>(Factory::Label::Create(caption, layout));
 }
-REFERENCE<Label> Factory::Label::Create(Control& parent, const ConstString& caption, string_view layout)
+REFERENCE<Label> Factory::Label::Create(Control& parent, const ConstString& caption, const ConstLayout& layout)
 {
     return parent.AddControl<Controls::Label>(Factory::Label::Create(caption, layout));
 }
 //======[BUTTON]=====================================================================================
 POINTER<Button> Factory::Button::Create(
-      const ConstString& caption, string_view layout, int controlID, Controls::ButtonFlags flags)
+      const ConstString& caption, const ConstLayout& layout, int controlID, Controls::ButtonFlags flags)
 {
     return POINTER<Controls::Button>(new Controls::Button(caption, layout, controlID, flags));
 }
 REFERENCE<Button> Factory::Button::Create(
-      Control* parent, const ConstString& caption, string_view layout, int controlID, Controls::ButtonFlags flags)
+      Control* parent,
+      const ConstString& caption,
+      const ConstLayout& layout,
+      int controlID,
+      Controls::ButtonFlags flags)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::Button>(Factory::Button::Create(caption, layout, controlID, flags));
 }
 REFERENCE<Button> Factory::Button::Create(
-      Control& parent, const ConstString& caption, string_view layout, int controlID, Controls::ButtonFlags flags)
+      Control& parent,
+      const ConstString& caption,
+      const ConstLayout& layout,
+      int controlID,
+      Controls::ButtonFlags flags)
 {
     return parent.AddControl<Controls::Button>(Factory::Button::Create(caption, layout, controlID, flags));
 }
 
 //======[PASSWORD]===================================================================================
-POINTER<Password> Factory::Password::Create(const ConstString& caption, string_view layout)
+POINTER<Password> Factory::Password::Create(const ConstString& caption, const ConstLayout& layout)
 {
     return POINTER<Controls::Password>(new Controls::Password(caption, layout));
 }
-REFERENCE<Password> Factory::Password::Create(Control* parent, const ConstString& caption, string_view layout)
+REFERENCE<Password> Factory::Password::Create(Control* parent, const ConstString& caption, const ConstLayout& layout)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::Password>(Factory::Password::Create(caption, layout));
 }
-REFERENCE<Password> Factory::Password::Create(Control& parent, const ConstString& caption, string_view layout)
+REFERENCE<Password> Factory::Password::Create(Control& parent, const ConstString& caption, const ConstLayout& layout)
 {
     return parent.AddControl<Controls::Password>(Factory::Password::Create(caption, layout));
 }
 
 //======[CHECKBOX]===================================================================================
-POINTER<CheckBox> Factory::CheckBox::Create(const ConstString& caption, string_view layout, int controlID)
+POINTER<CheckBox> Factory::CheckBox::Create(const ConstString& caption, const ConstLayout& layout, int controlID)
 {
     return POINTER<Controls::CheckBox>(new Controls::CheckBox(caption, layout, controlID));
 }
 REFERENCE<CheckBox> Factory::CheckBox::Create(
-      Control* parent, const ConstString& caption, string_view layout, int controlID)
+      Control* parent, const ConstString& caption, const ConstLayout& layout, int controlID)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::CheckBox>(Factory::CheckBox::Create(caption, layout, controlID));
 }
 REFERENCE<CheckBox> Factory::CheckBox::Create(
-      Control& parent, const ConstString& caption, string_view layout, int controlID)
+      Control& parent, const ConstString& caption, const ConstLayout& layout, int controlID)
 {
     return parent.AddControl<Controls::CheckBox>(Factory::CheckBox::Create(caption, layout, controlID));
 }
 
 //======[RADIOBOX]===================================================================================
 POINTER<RadioBox> Factory::RadioBox::Create(
-      const ConstString& caption, string_view layout, int groupID, int controlID, bool checked)
+      const ConstString& caption, const ConstLayout& layout, int groupID, int controlID, bool checked)
 {
     return POINTER<Controls::RadioBox>(new Controls::RadioBox(caption, layout, groupID, controlID, checked));
 }
 REFERENCE<RadioBox> Factory::RadioBox::Create(
-      Control* parent, const ConstString& caption, string_view layout, int groupID, int controlID, bool checked)
+      Control* parent, const ConstString& caption, const ConstLayout& layout, int groupID, int controlID, bool checked)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::RadioBox>(
           Factory::RadioBox::Create(caption, layout, groupID, controlID, checked));
 }
 REFERENCE<RadioBox> Factory::RadioBox::Create(
-      Control& parent, const ConstString& caption, string_view layout, int groupID, int controlID, bool checked)
+      Control& parent, const ConstString& caption, const ConstLayout& layout, int groupID, int controlID, bool checked)
 {
     return parent.AddControl<Controls::RadioBox>(
           Factory::RadioBox::Create(caption, layout, groupID, controlID, checked));
 }
 
 //======[SPLITTER]===================================================================================
-POINTER<Splitter> Factory::Splitter::Create(string_view layout, SplitterFlags flags)
+POINTER<Splitter> Factory::Splitter::Create(const ConstLayout& layout, SplitterFlags flags)
 {
     return POINTER<Controls::Splitter>(new Controls::Splitter(layout, flags));
 }
-REFERENCE<Splitter> Factory::Splitter::Create(Control* parent, string_view layout, SplitterFlags flags)
+REFERENCE<Splitter> Factory::Splitter::Create(Control* parent, const ConstLayout& layout, SplitterFlags flags)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::Splitter>(Factory::Splitter::Create(layout, flags));
 }
-REFERENCE<Splitter> Factory::Splitter::Create(Control& parent, string_view layout, SplitterFlags flags)
+REFERENCE<Splitter> Factory::Splitter::Create(Control& parent, const ConstLayout& layout, SplitterFlags flags)
 {
     return parent.AddControl<Controls::Splitter>(Factory::Splitter::Create(layout, flags));
 }
 
 //======[PANEL]======================================================================================
-POINTER<Panel> Factory::Panel::Create(const ConstString& caption, string_view layout)
+POINTER<Panel> Factory::Panel::Create(const ConstString& caption, const ConstLayout& layout)
 {
     return POINTER<Controls::Panel>(new Controls::Panel(caption, layout));
 }
-REFERENCE<Panel> Factory::Panel::Create(Control* parent, const ConstString& caption, string_view layout)
+REFERENCE<Panel> Factory::Panel::Create(Control* parent, const ConstString& caption, const ConstLayout& layout)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::Panel>(Factory::Panel::Create(caption, layout));
 }
-REFERENCE<Panel> Factory::Panel::Create(Control& parent, const ConstString& caption, string_view layout)
+REFERENCE<Panel> Factory::Panel::Create(Control& parent, const ConstString& caption, const ConstLayout& layout)
 {
     return parent.AddControl<Controls::Panel>(Factory::Panel::Create(caption, layout));
 }
-POINTER<Panel> Factory::Panel::Create(string_view layout)
+POINTER<Panel> Factory::Panel::Create(const ConstLayout& layout)
 {
     return POINTER<Controls::Panel>(new Controls::Panel("", layout));
 }
-REFERENCE<Panel> Factory::Panel::Create(Control* parent, string_view layout)
+REFERENCE<Panel> Factory::Panel::Create(Control* parent, const ConstLayout& layout)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::Panel>(Factory::Panel::Create(layout));
 }
-REFERENCE<Panel> Factory::Panel::Create(Control& parent, string_view layout)
+REFERENCE<Panel> Factory::Panel::Create(Control& parent, const ConstLayout& layout)
 {
     return parent.AddControl<Controls::Panel>(Factory::Panel::Create(layout));
 }
 
 //======[TEXTFIELD]==================================================================================
 REFERENCE<TextField> Factory::TextField::Create(
-      Controls::Control* parent, const ConstString& caption, string_view layout, Controls::TextFieldFlags flags)
+      Controls::Control* parent, const ConstString& caption, const ConstLayout& layout, Controls::TextFieldFlags flags)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::TextField>(Factory::TextField::Create(caption, layout, flags));
 }
 REFERENCE<TextField> Factory::TextField::Create(
-      Controls::Control& parent, const ConstString& caption, string_view layout, Controls::TextFieldFlags flags)
+      Controls::Control& parent, const ConstString& caption, const ConstLayout& layout, Controls::TextFieldFlags flags)
 {
     return parent.AddControl<Controls::TextField>(Factory::TextField::Create(caption, layout, flags));
 }
 POINTER<Controls::TextField> Factory::TextField::Create(
-      const ConstString& caption, string_view layout, Controls::TextFieldFlags flags)
+      const ConstString& caption, const ConstLayout& layout, Controls::TextFieldFlags flags)
 {
     return POINTER<Controls::TextField>(new Controls::TextField(caption, layout, flags));
 }
 
 //======[TEXTAREA]===================================================================================
 REFERENCE<TextArea> Factory::TextArea::Create(
-      Controls::Control* parent, const ConstString& caption, string_view layout, Controls::TextAreaFlags flags)
+      Controls::Control* parent, const ConstString& caption, const ConstLayout& layout, Controls::TextAreaFlags flags)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::TextArea>(Factory::TextArea::Create(caption, layout, flags));
 }
 REFERENCE<TextArea> Factory::TextArea::Create(
-      Controls::Control& parent, const ConstString& caption, string_view layout, Controls::TextAreaFlags flags)
+      Controls::Control& parent, const ConstString& caption, const ConstLayout& layout, Controls::TextAreaFlags flags)
 {
     return parent.AddControl<Controls::TextArea>(Factory::TextArea::Create(caption, layout, flags));
 }
 POINTER<Controls::TextArea> Factory::TextArea::Create(
-      const ConstString& caption, string_view layout, Controls::TextAreaFlags flags)
+      const ConstString& caption, const ConstLayout& layout, Controls::TextAreaFlags flags)
 {
     return POINTER<Controls::TextArea>(new Controls::TextArea(caption, layout, flags));
 }
@@ -186,17 +194,17 @@ POINTER<Controls::TabPage> Factory::TabPage::Create(const ConstString& caption)
 
 //======[TAB]========================================================================================
 REFERENCE<Tab> Factory::Tab::Create(
-      Controls::Control* parent, string_view layout, Controls::TabFlags flags, uint32 tabPageSize)
+      Controls::Control* parent, const ConstLayout& layout, Controls::TabFlags flags, uint32 tabPageSize)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::Tab>(Factory::Tab::Create(layout, flags, tabPageSize));
 }
 REFERENCE<Tab> Factory::Tab::Create(
-      Controls::Control& parent, string_view layout, Controls::TabFlags flags, uint32 tabPageSize)
+      Controls::Control& parent, const ConstLayout& layout, Controls::TabFlags flags, uint32 tabPageSize)
 {
     return parent.AddControl<Controls::Tab>(Factory::Tab::Create(layout, flags, tabPageSize));
 }
-POINTER<Tab> Factory::Tab::Create(string_view layout, Controls::TabFlags flags, uint32 tabPageSize)
+POINTER<Tab> Factory::Tab::Create(const ConstLayout& layout, Controls::TabFlags flags, uint32 tabPageSize)
 {
     return POINTER<Controls::Tab>(new Controls::Tab(layout, flags, tabPageSize));
 }
@@ -204,7 +212,7 @@ POINTER<Tab> Factory::Tab::Create(string_view layout, Controls::TabFlags flags,
 //======[CANVASVIEWER]===============================================================================
 REFERENCE<CanvasViewer> Factory::CanvasViewer::Create(
       Controls::Control* parent,
-      string_view layout,
+      const ConstLayout& layout,
       uint32 canvasWidth,
       uint32 canvasHeight,
       Controls::ViewerFlags flags)
@@ -215,7 +223,7 @@ REFERENCE<CanvasViewer> Factory::CanvasViewer::Create(
 }
 REFERENCE<CanvasViewer> Factory::CanvasViewer::Create(
       Controls::Control& parent,
-      string_view layout,
+      const ConstLayout& layout,
       uint32 canvasWidth,
       uint32 canvasHeight,
       Controls::ViewerFlags flags)
@@ -224,14 +232,14 @@ REFERENCE<CanvasViewer> Factory::CanvasViewer::Create(
           Factory::CanvasViewer::Create(layout, canvasWidth, canvasHeight, flags));
 }
 POINTER<Controls::CanvasViewer> Factory::CanvasViewer::Create(
-      string_view layout, uint32 canvasWidth, uint32 canvasHeight, Controls::ViewerFlags flags)
+      const ConstLayout& layout, uint32 canvasWidth, uint32 canvasHeight, Controls::ViewerFlags flags)
 {
     return POINTER<Controls::CanvasViewer>(new Controls::CanvasViewer("", layout, canvasWidth, canvasHeight, flags));
 }
 REFERENCE<CanvasViewer> Factory::CanvasViewer::Create(
       Controls::Control* parent,
       const ConstString& caption,
-      string_view layout,
+      const ConstLayout& layout,
       uint32 canvasWidth,
       uint32 canvasHeight,
       Controls::ViewerFlags flags)
@@ -243,7 +251,7 @@ REFERENCE<CanvasViewer> Factory::CanvasViewer::Create(
 REFERENCE<CanvasViewer> Factory::CanvasViewer::Create(
       Controls::Control& parent,
       const ConstString& caption,
-      string_view layout,
+      const ConstLayout& layout,
       uint32 canvasWidth,
       uint32 canvasHeight,
       Controls::ViewerFlags flags)
@@ -253,7 +261,7 @@ REFERENCE<CanvasViewer> Factory::CanvasViewer::Create(
 }
 POINTER<Controls::CanvasViewer> Factory::CanvasViewer::Create(
       const ConstString& caption,
-      string_view layout,
+      const ConstLayout& layout,
       uint32 canvasWidth,
       uint32 canvasHeight,
       Controls::ViewerFlags flags)
@@ -263,47 +271,80 @@ POINTER<Controls::CanvasViewer> Factory::CanvasViewer::Create(
 }
 
 //======[IMAGEVIEWER]================================================================================
-POINTER<Controls::ImageView> Factory::ImageView::Create(string_view layout, Controls::ViewerFlags flags)
+POINTER<Controls::ImageView> Factory::ImageView::Create(const ConstLayout& layout, Controls::ViewerFlags flags)
 {
     return POINTER<Controls::ImageView>(new Controls::ImageView("", layout, flags));
 }
 REFERENCE<ImageView> Factory::ImageView::Create(
-      Controls::Control* parent, string_view layout, Controls::ViewerFlags flags)
+      Controls::Control* parent, const ConstLayout& layout, Controls::ViewerFlags flags)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::ImageView>(Factory::ImageView::Create("", layout, flags));
 }
 REFERENCE<ImageView> Factory::ImageView::Create(
-      Controls::Control& parent, string_view layout, Controls::ViewerFlags flags)
+      Controls::Control& parent, const ConstLayout& layout, Controls::ViewerFlags flags)
 {
     return parent.AddControl<Controls::ImageView>(Factory::ImageView::Create("", layout, flags));
 }
 POINTER<Controls::ImageView> Factory::ImageView::Create(
-      const ConstString& caption, string_view layout, Controls::ViewerFlags flags)
+      const ConstString& caption, const ConstLayout& layout, Controls::ViewerFlags flags)
 {
     return POINTER<Controls::ImageView>(new Controls::ImageView(caption, layout, flags));
 }
 REFERENCE<ImageView> Factory::ImageView::Create(
-      Controls::Control* parent, const ConstString& caption, string_view layout, Controls::ViewerFlags flags)
+      Controls::Control* parent, const ConstString& caption, const ConstLayout& layout, Controls::ViewerFlags flags)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::ImageView>(Factory::ImageView::Create(caption, layout, flags));
 }
 REFERENCE<ImageView> Factory::ImageView::Create(
-      Controls::Control& parent, const ConstString& caption, string_view layout, Controls::ViewerFlags flags)
+      Controls::Control& parent, const ConstString& caption, const ConstLayout& layout, Controls::ViewerFlags flags)
 {
     return parent.AddControl<Controls::ImageView>(Factory::ImageView::Create(caption, layout, flags));
 }
 
+//======[VIDEOVIEW]==================================================================================
+POINTER<Controls::VideoView> Factory::VideoView::Create(const ConstLayout& layout, Controls::ViewerFlags flags)
+{
+    return POINTER<Controls::VideoView>(new Controls::VideoView("", layout, flags));
+}
+REFERENCE<VideoView> Factory::VideoView::Create(
+      Controls::Control* parent, const ConstLayout& layout, Controls::ViewerFlags flags)
+{
+    VALIDATE_PARENT;
+    return parent->AddControl<Controls::VideoView>(Factory::VideoView::Create("", layout, flags));
+}
+REFERENCE<VideoView> Factory::VideoView::Create(
+      Controls::Control& parent, const ConstLayout& layout, Controls::ViewerFlags flags)
+{
+    return parent.AddControl<Controls::VideoView>(Factory::VideoView::Create("", layout, flags));
+}
+POINTER<Controls::VideoView> Factory::VideoView::Create(
+      const ConstString& caption, const ConstLayout& layout, Controls::ViewerFlags flags)
+{
+    return POINTER<Controls::VideoView>(new Controls::VideoView(caption, layout, flags));
+}
+REFERENCE<VideoView> Factory::VideoView::Create(
+      Controls::Control* parent, const ConstString& caption, const ConstLayout& layout, Controls::ViewerFlags flags)
+{
+    VALIDATE_PARENT;
+    return parent->AddControl<Controls::VideoView>(Factory::VideoView::Create(caption, layout, flags));
+}
+REFERENCE<VideoView> Factory::VideoView::Create(
+      Controls::Control& parent, const ConstString& caption, const ConstLayout& layout, Controls::ViewerFlags flags)
+{
+    return parent.AddControl<Controls::VideoView>(Factory::VideoView::Create(caption, layout, flags));
+}
+
 //======[LISTVIEW]===================================================================================
 POINTER<Controls::ListView> Factory::ListView::Create(
-      string_view layout, std::initializer_list<ConstString> columns, Controls::ListViewFlags flags)
+      const ConstLayout& layout, std::initializer_list<ConstString> columns, Controls::ListViewFlags flags)
 {
     return POINTER<Controls::ListView>(new Controls::ListView(layout, columns, flags));
 }
 REFERENCE<ListView> Factory::ListView::Create(
       Controls::Control* parent,
-      string_view layout,
+      const ConstLayout& layout,
       std::initializer_list<ConstString> columns,
       Controls::ListViewFlags flags)
 {
@@ -312,7 +353,7 @@ REFERENCE<ListView> Factory::ListView::Create(
 }
 REFERENCE<ListView> Factory::ListView::Create(
       Controls::Control& parent,
-      string_view layout,
+      const ConstLayout& layout,
       std::initializer_list<ConstString> columns,
       Controls::ListViewFlags flags)
 {
@@ -320,38 +361,39 @@ REFERENCE<ListView> Factory::ListView::Create(
 }
 
 //======[COMBOBOX]===================================================================================
-POINTER<Controls::ComboBox> Factory::ComboBox::Create(string_view layout, const ConstString& text, char itemsSeparator)
+POINTER<Controls::ComboBox> Factory::ComboBox::Create(
+      const ConstLayout& layout, const ConstString& text, char itemsSeparator)
 {
     return POINTER<Controls::ComboBox>(new Controls::ComboBox(layout, text, itemsSeparator));
 }
 
 REFERENCE<ComboBox> Factory::ComboBox::Create(
-      Controls::Control* parent, string_view layout, const ConstString& text, char itemsSeparator)
+      Controls::Control* parent, const ConstLayout& layout, const ConstString& text, char itemsSeparator)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::ComboBox>(Factory::ComboBox::Create(layout, text, itemsSeparator));
 }
 REFERENCE<ComboBox> Factory::ComboBox::Create(
-      Controls::Control& parent, string_view layout, const ConstString& text, char itemsSeparator)
+      Controls::Control& parent, const ConstLayout& layout, const ConstString& text, char itemsSeparator)
 {
     return parent.AddControl<Controls::ComboBox>(Factory::ComboBox::Create(layout, text, itemsSeparator));
 }
 
 //======[NUMERICSELECTOR]============================================================================
 POINTER<Controls::NumericSelector> Factory::NumericSelector::Create(
-      const int64 minValue, const int64 maxValue, int64 value, string_view layout)
+      const int64 minValue, const int64 maxValue, int64 value, const ConstLayout& layout)
 {
     return POINTER<Controls::NumericSelector>(new Controls::NumericSelector(minValue, maxValue, value, layout));
 }
 REFERENCE<NumericSelector> Factory::NumericSelector::Create(
-      Controls::Control* parent, const int64 minValue, const int64 maxValue, int64 value, string_view layout)
+      Controls::Control* parent, const int64 minValue, const int64 maxValue, int64 value, const ConstLayout& layout)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::NumericSelector>(
           Factory::NumericSelector::Create(minValue, maxValue, value, layout));
 }
 REFERENCE<NumericSelector> Factory::NumericSelector::Create(
-      Controls::Control& parent, const int64 minValue, const int64 maxValue, int64 value, string_view layout)
+      Controls::Control& parent, const int64 minValue, const int64 maxValue, int64 value, const ConstLayout& layout)
 {
     return parent.AddControl<Controls::NumericSelector>(
           Factory::NumericSelector::Create(minValue, maxValue, value, layout));
@@ -359,7 +401,7 @@ REFERENCE<NumericSelector> Factory::NumericSelector::Create(
 
 //======[WINDOW]=====================================================================================
 POINTER<Controls::Window> Factory::Window::Create(
-      const ConstString& caption, string_view layout, Controls::WindowFlags flags)
+      const ConstString& caption, const ConstLayout& layout, Controls::WindowFlags flags)
 {
     return POINTER<Controls::Window>(new Controls::Window(caption, layout, flags));
 }
@@ -372,14 +414,14 @@ POINTER<Controls::Desktop> Factory::Desktop::Create()
 
 //======[TREE]=======================================================================================
 POINTER<Controls::TreeView> Factory::TreeView::Create(
-      string_view layout, std::initializer_list<ConstString> columns, TreeViewFlags flags)
+      const ConstLayout& layout, std::initializer_list<ConstString> columns, TreeViewFlags flags)
 {
     return POINTER<Controls::TreeView>(new Controls::TreeView(layout, columns, flags));
 }
 
 REFERENCE<TreeView> Factory::TreeView::Create(
       Controls::Control* parent,
-      string_view layout,
+      const ConstLayout& layout,
       std::initializer_list<ConstString> columns,
       const TreeViewFlags flags)
 {
@@ -389,7 +431,7 @@ REFERENCE<TreeView> Factory::TreeView::Create(
 
 REFERENCE<TreeView> Factory::TreeView::Create(
       Controls::Control& parent,
-      string_view layout,
+      const ConstLayout& layout,
       std::initializer_list<ConstString> columns,
       const TreeViewFlags flags)
 {
@@ -398,88 +440,96 @@ REFERENCE<TreeView> Factory::TreeView::Create(
 
 //======[GRID]=======================================================================================
 Pointer<Controls::Grid> Factory::Grid::Create(
-      string_view layout, uint32 columnsNo, uint32 rowsNo, Controls::GridFlags flags)
+      const ConstLayout& layout, uint32 columnsNo, uint32 rowsNo, Controls::GridFlags flags)
 {
     return POINTER<Controls::Grid>(new Controls::Grid(layout, columnsNo, rowsNo, flags));
 }
 
 Reference<Controls::Grid> Factory::Grid::Create(
-      Controls::Control* parent, string_view layout, uint32 columnsNo, uint32 rowsNo, Controls::GridFlags flags)
+      Controls::Control* parent, const ConstLayout& layout, uint32 columnsNo, uint32 rowsNo, Controls::GridFlags flags)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::Grid>(Factory::Grid::Create(layout, columnsNo, rowsNo, flags));
 }
 
 Reference<Controls::Grid> Factory::Grid::Create(
-      Controls::Control& parent, string_view layout, uint32 columnsNo, uint32 rowsNo, Controls::GridFlags flags)
+      Controls::Control& parent, const ConstLayout& layout, uint32 columnsNo, uint32 rowsNo, Controls::GridFlags flags)
 {
     return parent.AddControl<Controls::Grid>(Factory::Grid::Create(layout, columnsNo, rowsNo, flags));
 }
 
 //======[PROPERTYLIST]===============================================================================
 Pointer<Controls::PropertyList> Factory::PropertyList::Create(
-      string_view layout, Reference<PropertiesInterface> object, PropertyListFlags flags)
+      const ConstLayout& layout, Reference<PropertiesInterface> object, PropertyListFlags flags)
 {
     return POINTER<Controls::PropertyList>(new Controls::PropertyList(layout, object, flags));
 }
 Reference<Controls::PropertyList> Factory::PropertyList::Create(
-      Controls::Control* parent, string_view layout, Reference<PropertiesInterface> object, PropertyListFlags flags)
+      Controls::Control* parent,
+      const ConstLayout& layout,
+      Reference<PropertiesInterface> object,
+      PropertyListFlags flags)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::PropertyList>(Factory::PropertyList::Create(layout, object, flags));
 }
 Reference<Controls::PropertyList> Factory::PropertyList::Create(
-      Controls::Control& parent, string_view layout, Reference<PropertiesInterface> object, PropertyListFlags flags)
+      Controls::Control& parent,
+      const ConstLayout& layout,
+      Reference<PropertiesInterface> object,
+      PropertyListFlags flags)
 {
     return parent.AddControl<Controls::PropertyList>(Factory::PropertyList::Create(layout, object, flags));
 }
 
 //======[KEYSELECTOR]================================================================================
 Pointer<Controls::KeySelector> Factory::KeySelector::Create(
-      string_view layout, Input::Key keyCode, KeySelectorFlags flags)
+      const ConstLayout& layout, Input::Key keyCode, KeySelectorFlags flags)
 {
     return POINTER<Controls::KeySelector>(new Controls::KeySelector(layout, keyCode, flags));
 }
 Reference<Controls::KeySelector> Factory::KeySelector::Create(
-      Controls::Control* parent, string_view layout, Input::Key keyCode, KeySelectorFlags flags)
+      Controls::Control* parent, const ConstLayout& layout, Input::Key keyCode, KeySelectorFlags flags)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::KeySelector>(Factory::KeySelector::Create(layout, keyCode, flags));
 }
 Reference<Controls::KeySelector> Factory::KeySelector::Create(
-      Controls::Control& parent, string_view layout, Input::Key keyCode, KeySelectorFlags flags)
+      Controls::Control& parent, const ConstLayout& layout, Input::Key keyCode, KeySelectorFlags flags)
 {
     return parent.AddControl<Controls::KeySelector>(Factory::KeySelector::Create(layout, keyCode, flags));
 }
 
 //======[COLORPICKER]================================================================================
-Pointer<Controls::ColorPicker> Factory::ColorPicker::Create(string_view layout, Graphics::Color color)
+Pointer<Controls::ColorPicker> Factory::ColorPicker::Create(const ConstLayout& layout, Graphics::Color color)
 {
     return POINTER<Controls::ColorPicker>(new Controls::ColorPicker(layout, color));
 }
 Reference<Controls::ColorPicker> Factory::ColorPicker::Create(
-      Controls::Control* parent, string_view layout, Graphics::Color color)
+      Controls::Control* parent, const ConstLayout& layout, Graphics::Color color)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::ColorPicker>(Factory::ColorPicker::Create(layout, color));
 }
 Reference<Controls::ColorPicker> Factory::ColorPicker::Create(
-      Controls::Control& parent, string_view layout, Graphics::Color color)
+      Controls::Control& parent, const ConstLayout& layout, Graphics::Color color)
 {
     return parent.AddControl<Controls::ColorPicker>(Factory::ColorPicker::Create(layout, color));
 }
 
 //======[CHARACTERTABLE]=============================================================================
-Pointer<Controls::CharacterTable> Factory::CharacterTable::Create(string_view layout)
+Pointer<Controls::CharacterTable> Factory::CharacterTable::Create(const ConstLayout& layout)
 {
     return POINTER<Controls::CharacterTable>(new Controls::CharacterTable(layout));
 }
-Reference<Controls::CharacterTable> Factory::CharacterTable::Create(Controls::Control* parent, string_view layout)
+Reference<Controls::CharacterTable> Factory::CharacterTable::Create(
+      Controls::Control* parent, const ConstLayout& layout)
 {
     VALIDATE_PARENT;
     return parent->AddControl<Controls::CharacterTable>(Factory::CharacterTable::Create(layout));
 }
-Reference<Controls::CharacterTable> Factory::CharacterTable::Create(Controls::Control& parent, string_view layout)
+Reference<Controls::CharacterTable> Factory::CharacterTable::Create(
+      Controls::Control& parent, const ConstLayout& layout)
 {
     return parent.AddControl<Controls::CharacterTable>(Factory::CharacterTable::Create(layout));
 }
@@ -10,7 +10,7 @@ constexpr auto InvalidCellIndex = 0xFFFFFFFFU;
 constexpr auto minCellWidth  = 0x03U;
 constexpr auto minCellHeight = 0x02U;
 
-Grid::Grid(string_view layout, uint32 columnsNo, uint32 rowsNo, GridFlags flags)
+Grid::Grid(const ConstLayout& layout, uint32 columnsNo, uint32 rowsNo, GridFlags flags)
     : Control(new GridControlContext(), "", layout, false)
 {
     auto context              = reinterpret_cast<GridControlContext*>(Context);
@@ -1,10 +1,120 @@
 #include "ControlContext.hpp"
+#include <cmath>
 
-namespace AppCUI::Controls
+namespace AppCUI
 {
-ImageView::ImageView(const ConstString& caption, string_view layout, ViewerFlags flags)
-    : CanvasViewer(caption, layout, 16, 16, flags)
+constexpr double IMAGEVIEW_ZOOM_STEP = 1.25;
+constexpr double IMAGEVIEW_MIN_SCALE = 1.0 / 64.0;
+constexpr double IMAGEVIEW_MAX_SCALE = 16.0;
+constexpr uint32 IMAGEVIEW_MAX_LEVEL = 24;
+
+bool ImageViewControlContext::Render()
 {
+    auto sz = Graphics::ComputeRenderingSize(GetImageWidth(), GetImageHeight(), method, scale);
+    CHECK((sz.Width > 0) && (sz.Height > 0), false, "Invalid image size (0x0) --> nothing to render");
+    // the canvas only keeps the visible characters (a zoomed image can have billions of characters)
+    canvasIsViewport = true;
+    surfaceWidth     = sz.Width;
+    surfaceHeight    = sz.Height;
+    viewport.valid   = false;
+    MoveScrollTo(CanvasScrollX, CanvasScrollY);
+    return RenderViewport();
+}
+bool ImageViewControlContext::RenderViewport()
+{
+    int viewWidth  = Layout.Width;
+    int viewHeight = Layout.Height;
+    if (Flags && ViewerFlags::Border)
+    {
+        viewWidth -= 2;
+        viewHeight -= 2;
+    }
+    if ((viewWidth <= 0) || (viewHeight <= 0))
+        return true; // not visible
+    const int x       = -CanvasScrollX;
+    const int y       = -CanvasScrollY;
+    const uint32 w    = std::min<>((uint32) viewWidth, surfaceWidth);
+    const uint32 h    = std::min<>((uint32) viewHeight, surfaceHeight);
+    if ((viewport.valid) && (viewport.x == x) && (viewport.y == y) && (viewport.width == w) && (viewport.height == h))
+        return true; // already rendered
+
+    if (!tiled.IsValid())
+    {
+        // every visible character is averaged from the summed-area table (the scroll position is not updated
+        // when the view is resized --> the region is kept inside the image)
+        const uint32 column = std::min<>((uint32) std::max<>(x, 0), surfaceWidth - w);
+        const uint32 row    = std::min<>((uint32) std::max<>(y, 0), surfaceHeight - h);
+        CHECK(canvas.Resize(w, h), false, "Fail to set canvas size to %ux%u", w, h);
+        CHECK(Graphics::DrawImage(canvas, integral, 0, 0, surfaceWidth, surfaceHeight, column, row, w, h, method),
+              false,
+              "Fail to draw the visible region (%u,%u - %ux%u) of an image drawn on %ux%u characters",
+              column,
+              row,
+              w,
+              h,
+              surfaceWidth,
+              surfaceHeight);
+        viewport = { x, y, w, h, true };
+        return true;
+    }
+
+    // pixels of the image for every character (and for every box of pixels that is painted by a character)
+    const double pixelsPerColumn = ((double) tiled.GetWidth()) / surfaceWidth;
+    const double pixelsPerLine   = ((double) tiled.GetHeight()) / surfaceHeight;
+    double boxWidth              = pixelsPerColumn;
+    double boxHeight             = pixelsPerLine;
+    int shift                    = 0;
+    if (method == Graphics::ImageRenderingMethod::PixelTo16ColorsSmallBlock)
+        boxHeight /= 2.0;
+    else
+    {
+        boxWidth *= 2.0;
+        shift = x & 1; // two characters per box --> the region starts with the first character of a box
+    }
+
+    // the level with at least one pixel per box --> a zoomed out image only reads a few pixels from every tile
+    uint32 level = 0;
+    while ((level < IMAGEVIEW_MAX_LEVEL) && (((double) (2ULL << level)) <= std::min<>(boxWidth, boxHeight)))
+        level++;
+    const uint64 levelWidth  = tiled.GetLevelWidth(level);
+    const uint64 levelHeight = tiled.GetLevelHeight(level);
+    const uint64 step        = 1ULL << level;
+    const uint64 left        = std::min<uint64>(((uint64) ((x - shift) * pixelsPerColumn)) >> level, levelWidth - 1);
+    const uint64 top         = std::min<uint64>(((uint64) (y * pixelsPerLine)) >> level, levelHeight - 1);
+    uint64 right             = (((uint64) std::ceil((x + w) * pixelsPerColumn)) + step - 1) >> level;
+    uint64 bottom            = (((uint64) std::ceil((y + h) * pixelsPerLine)) + step - 1) >> level;
+    right                    = std::max<uint64>(std::min<uint64>(right, levelWidth), left + 1);
+    bottom                   = std::max<uint64>(std::min<uint64>(bottom, levelHeight), top + 1);
+
+    Graphics::Image region;
+    CHECK(tiled.GetRegion(
+                (uint32) left, (uint32) top, (uint32) (right - left), (uint32) (bottom - top), level, region),
+          false,
+          "Fail to read the visible region of the image");
+    CHECK(canvas.Resize(w, h), false, "Fail to set canvas size to %ux%u", w, h);
+    CHECK(canvas.DrawImage(region, -shift, 0, w + shift, h, method),
+          false,
+          "Fail to draw the visible region of the image (%ux%u pixels) on %ux%u characters",
+          region.GetWidth(),
+          region.GetHeight(),
+          w + shift,
+          h);
+    viewport = { x, y, w, h, true };
+    return true;
+}
+
+ImageView::ImageView(const ConstString& caption, const ConstLayout& layout, ViewerFlags flags)
+    : CanvasViewer(new ImageViewControlContext(), caption, layout, 16, 16, flags)
+{
+    auto Members        = reinterpret_cast<ImageViewControlContext*>(this->Context);
+    Members->method         = Graphics::ImageRenderingMethod::PixelTo16ColorsSmallBlock;
+    Members->scale          = 1.0;
+    Members->scaleToFit     = false;
+    Members->viewport.valid = false;
+}
+ImageView::~ImageView()
+{
+    DELETE_CONTROL_CONTEXT(ImageViewControlContext);
 }
 bool ImageView::SetImage(
       const Graphics::Image& img, Graphics::ImageRenderingMethod method, Graphics::ImageScaleMethod scale)
@@ -14,8 +124,112 @@ bool ImageView::SetImage(
     auto sz = c->ComputeRenderingSize(img, method, scale);
     CHECK((sz.Width > 0) && (sz.Height > 0), false, "Invalid image size (0x0) --> nothing to render");
     CHECK(c->Resize(sz.Width, sz.Height), false, "Fail to set canvas size to %ux%u", sz.Width, sz.Height);
-    CREATE_TYPECONTROL_CONTEXT(CanvasControlContext, Members, false);
+    CREATE_TYPECONTROL_CONTEXT(ImageViewControlContext, Members, false);
+    Members->integral.Clear(); // fixed scale --> the image can not be zoomed
+    Members->tiled.Close();
+    Members->canvasIsViewport = false;
+    Members->method     = method;
+    Members->scale      = 1.0 / static_cast<uint32>(scale);
+    Members->scaleToFit = false;
     Members->MoveScrollTo(0, 0);
     return c->DrawImage(img, 0, 0, method, scale);
 }
-} // namespace AppCUI::Controls
\ No newline at end of file
+bool ImageView::SetImage(const Graphics::Image& img, Graphics::ImageRenderingMethod method, double scale)
+{
+    CREATE_TYPECONTROL_CONTEXT(ImageViewControlContext, Members, false);
+    CHECK(scale > 0, false, "Invalid scale (%f) - it should be bigger than 0", scale);
+    CHECK(Members->integral.Create(img), false, "Fail to compute the summed-area table of the image");
+    Members->tiled.Close();
+    Members->method     = method;
+    Members->scale      = scale;
+    Members->scaleToFit = false;
+    Members->MoveScrollTo(0, 0);
+    return Members->Render();
+}
+bool ImageView::SetImage(Graphics::TiledImage&& img, Graphics::ImageRenderingMethod method, double scale)
+{
+    CREATE_TYPECONTROL_CONTEXT(ImageViewControlContext, Members, false);
+    CHECK(img.IsValid(), false, "Tiled image was not loaded (have you called Load or Create methods ?)");
+    CHECK(scale > 0, false, "Invalid scale (%f) - it should be bigger than 0", scale);
+    Members->integral.Clear();
+    Members->tiled      = std::move(img);
+    Members->method     = method;
+    Members->scale      = scale;
+    Members->scaleToFit = false;
+    Members->MoveScrollTo(0, 0);
+    return Members->Render();
+}
+bool ImageView::SetScale(double scale)
+{
+    CREATE_TYPECONTROL_CONTEXT(ImageViewControlContext, Members, false);
+    CHECK(Members->IsScalable(), false, "No image was set with an arbitrary scale (use SetImage(...,double))");
+    CHECK(scale > 0, false, "Invalid scale (%f) - it should be bigger than 0", scale);
+    Members->scale      = std::min<>(std::max<>(scale, IMAGEVIEW_MIN_SCALE), IMAGEVIEW_MAX_SCALE);
+    Members->scaleToFit = false;
+    return Members->Render();
+}
+bool ImageView::ScaleToFit()
+{
+    CREATE_TYPECONTROL_CONTEXT(ImageViewControlContext, Members, false);
+    CHECK(Members->IsScalable(), false, "No image was set with an arbitrary scale (use SetImage(...,double))");
+    Members->scaleToFit = true;
+
+    int viewWidth  = Members->Layout.Width;
+    int viewHeight = Members->Layout.Height;
+    if (Members->Flags && ViewerFlags::Border)
+    {
+        viewWidth -= 2;
+        viewHeight -= 2;
+    }
+    if ((viewWidth <= 0) || (viewHeight <= 0))
+        return true; // not visible yet --> the image will be rendered on the next resize
+
+    // one pixel per character (small blocks: two lines of pixels per character) or two characters per pixel
+    const double w = Members->GetImageWidth();
+    const double h = Members->GetImageHeight();
+    if (Members->method == Graphics::ImageRenderingMethod::PixelTo16ColorsSmallBlock)
+        Members->scale = std::min<>(viewWidth / w, (viewHeight * 2) / h);
+    else
+        Members->scale = std::min<>(viewWidth / (w * 2), viewHeight / h);
+    Members->MoveScrollTo(0, 0);
+    return Members->Render();
+}
+double ImageView::GetScale() const
+{
+    CREATE_TYPECONTROL_CONTEXT(ImageViewControlContext, Members, 1.0);
+    return Members->scale;
+}
+void ImageView::Paint(Graphics::Renderer& renderer)
+{
+    CREATE_TYPECONTROL_CONTEXT(ImageViewControlContext, Members, );
+    if (Members->canvasIsViewport)
+        Members->RenderViewport(); // the visible part of the image changes when scrolling or resizing
+    CanvasViewer::Paint(renderer);
+}
+bool ImageView::OnKeyEvent(Input::Key keyCode, char16 UnicodeChar)
+{
+    CREATE_TYPECONTROL_CONTEXT(ImageViewControlContext, Members, false);
+    if (Members->IsScalable())
+    {
+        switch (UnicodeChar)
+        {
+        case '+':
+            SetScale(Members->scale * IMAGEVIEW_ZOOM_STEP);
+            return true;
+        case '-':
+            SetScale(Members->scale / IMAGEVIEW_ZOOM_STEP);
+            return true;
+        case '*':
+            ScaleToFit();
+            return true;
+        }
+    }
+    return CanvasViewer::OnKeyEvent(keyCode, UnicodeChar);
+}
+void ImageView::OnAfterResize(int, int)
+{
+    CREATE_TYPECONTROL_CONTEXT(ImageViewControlContext, Members, );
+    if (Members->scaleToFit)
+        ScaleToFit();
+}
+} // namespace AppCUI
@@ -2,7 +2,7 @@
 
 namespace AppCUI::Controls
 {
-KeySelector::KeySelector(string_view layout, Input::Key keyCode, KeySelectorFlags flags)
+KeySelector::KeySelector(const ConstLayout& layout, Input::Key keyCode, KeySelectorFlags flags)
     : Control(new KeySelectorContext(), "", layout, false)
 {
     auto Members              = reinterpret_cast<KeySelectorContext*>(this->Context);
@@ -1212,7 +1212,7 @@ ListView::~ListView()
     DeleteAllItems();
     DELETE_CONTROL_CONTEXT(ListViewControlContext);
 }
-ListView::ListView(string_view layout, std::initializer_list<ConstString> columns, ListViewFlags flags)
+ListView::ListView(const ConstLayout& layout, std::initializer_list<ConstString> columns, ListViewFlags flags)
     : ColumnsHeaderView(new ListViewControlContext(this, columns, ListViewFlagsToColumnsHeaderViewFlags(flags)), layout)
 {
     auto Members              = reinterpret_cast<ListViewControlContext*>(this->Context);
@@ -15,6 +15,9 @@ using namespace Input;
           CTX->ItemsCount);
 constexpr uint32 NO_MENUITEM_SELECTED = 0xFFFFFFFFU;
 
+// any change to the items of any menu (including sub-menus) invalidates the shortcut tables
+static uint32 menuShortcutsVersion = 0;
+
 MenuItem::MenuItem()
 {
     Type         = MenuItemType::Line;
@@ -73,6 +76,8 @@ MenuContext::MenuContext()
     this->ItemsCount        = 0;
     this->ButtonUp          = MenuButtonState::Normal;
     this->ButtonDown        = MenuButtonState::Normal;
+    this->Shortcuts.Version = 0;
+    this->Shortcuts.Built   = false;
 }
 ItemHandle MenuContext::AddItem(unique_ptr<MenuItem> itm)
 {
@@ -85,6 +90,7 @@ ItemHandle MenuContext::AddItem(unique_ptr<MenuItem> itm)
     auto res                = ItemHandle{ (uint32) this->ItemsCount };
     Items[this->ItemsCount] = std::move(itm);
     this->ItemsCount++;
+    menuShortcutsVersion++;
     return res;
 }
 void MenuContext::Paint(Graphics::Renderer& renderer, bool activ)
@@ -571,7 +577,7 @@ bool MenuContext::OnKeyEvent(Input::Key keyCode)
     // no binding
     return false;
 }
-bool MenuContext::ProcessShortCut(Input::Key keyCode)
+void MenuContext::BuildShortcutsTable(MenuContext* root)
 {
     for (uint32 tr = 0; tr < this->ItemsCount; tr++)
     {
@@ -580,28 +586,37 @@ bool MenuContext::ProcessShortCut(Input::Key keyCode)
         if ((Items[tr]->Type == MenuItemType::Command) || (Items[tr]->Type == MenuItemType::Check) ||
             (Items[tr]->Type == MenuItemType::Radio))
         {
-            if (Items[tr]->ShortcutKey == keyCode)
-            {
-                if (Items[tr]->Type == MenuItemType::Check)
-                    this->SetChecked(tr, !Items[tr]->Checked);
-                if (Items[tr]->Type == MenuItemType::Radio)
-                    this->SetChecked(tr, true);
-                if (Items[tr]->CommandID >= 0)
-                {
-                    Application::GetApplication()->SendCommand(Items[tr]->CommandID);
-                }
-                return true; // key was processed
-            }
+            // first item (in menu order) that uses a shortcut owns it
+            if (Items[tr]->ShortcutKey != Key::None)
+                root->Shortcuts.Table.emplace(Items[tr]->ShortcutKey, std::pair<MenuContext*, uint32>(this, tr));
         }
         if ((Items[tr]->Type == MenuItemType::SubMenu) && (Items[tr]->SubMenu))
-        {
-            MenuContext* ctx = reinterpret_cast<MenuContext*>(Items[tr]->SubMenu->Context);
-            if (ctx->ProcessShortCut(keyCode))
-                return true;
-        }
+            reinterpret_cast<MenuContext*>(Items[tr]->SubMenu->Context)->BuildShortcutsTable(root);
     }
-    // if nothing matched - return false;
-    return false;
+}
+bool MenuContext::ProcessShortCut(Input::Key keyCode)
+{
+    if ((!this->Shortcuts.Built) || (this->Shortcuts.Version != menuShortcutsVersion))
+    {
+        this->Shortcuts.Table.clear();
+        BuildShortcutsTable(this);
+        this->Shortcuts.Version = menuShortcutsVersion;
+        this->Shortcuts.Built   = true;
+    }
+    auto it = this->Shortcuts.Table.find(keyCode);
+    if (it == this->Shortcuts.Table.end())
+        return false;
+    auto ctx = it->second.first;
+    auto idx = it->second.second;
+    if (ctx->Items[idx]->Type == MenuItemType::Check)
+        ctx->SetChecked(idx, !ctx->Items[idx]->Checked);
+    if (ctx->Items[idx]->Type == MenuItemType::Radio)
+        ctx->SetChecked(idx, true);
+    if (ctx->Items[idx]->CommandID >= 0)
+    {
+        Application::GetApplication()->SendCommand(ctx->Items[idx]->CommandID);
+    }
+    return true; // key was processed
 }
 
 void MenuContext::Show(
@@ -773,6 +788,7 @@ bool Menu::SetEnable(ItemHandle menuItem, bool status)
 {
     CHECK_VALID_ITEM(false);
     CTX->Items[(uint32) menuItem]->Enabled = status;
+    menuShortcutsVersion++;
     return true;
 }
 bool Menu::SetChecked(ItemHandle menuItem, bool status)
@@ -2,7 +2,7 @@
 
 namespace AppCUI
 {
-NumericSelector::NumericSelector(int64 minValue, int64 maxValue, int64 value, string_view layout)
+NumericSelector::NumericSelector(int64 minValue, int64 maxValue, int64 value, const ConstLayout& layout)
     : Control(new NumericSelectorControlContext(), "", layout, true)
 {
     auto cc              = reinterpret_cast<NumericSelectorControlContext*>(this->Context);
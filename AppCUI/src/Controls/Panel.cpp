@@ -4,7 +4,8 @@
 namespace AppCUI::Controls
 {
 constexpr uint32 PANEL_ATTR_BORDER = 1024;
-Panel::Panel(const ConstString& caption, string_view layout) : Control(new ControlContext(), caption, layout, false)
+Panel::Panel(const ConstString& caption, const ConstLayout& layout)
+    : Control(new ControlContext(), caption, layout, false)
 {
     auto Members = reinterpret_cast<ControlContext*>(this->Context);
     if (Members->Text.Len() == 0)
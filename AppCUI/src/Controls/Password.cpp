@@ -2,7 +2,7 @@
 
 namespace AppCUI::Controls
 {
-Password::Password(const ConstString& caption, string_view layout)
+Password::Password(const ConstString& caption, const ConstLayout& layout)
     : Control(new ControlContext(), caption, layout, false)
 {
     auto Members              = reinterpret_cast<ControlContext*>(this->Context);
@@ -88,7 +88,7 @@ class PropertyEditDialog : public Window
     bool isReadOnly;
 
     PropertyEditDialog(
-          string_view layout, const PropertyInfo& _prop, Reference<PropertiesInterface> _object, bool readOnly)
+          const ConstLayout& layout, const PropertyInfo& _prop, Reference<PropertiesInterface> _object, bool readOnly)
         : Window("Edit", layout, WindowFlags::NoCloseButton), prop(_prop), object(_object), isReadOnly(readOnly)
     {
         if (readOnly)
@@ -1912,7 +1912,7 @@ void PropertyListContext::Refilter()
     }
 }
 
-PropertyList::PropertyList(string_view layout, Reference<PropertiesInterface> obj, PropertyListFlags flags)
+PropertyList::PropertyList(const ConstLayout& layout, Reference<PropertiesInterface> obj, PropertyListFlags flags)
     : Control(new PropertyListContext(), "", layout, false)
 {
     auto* Members = (PropertyListContext*) this->Context;
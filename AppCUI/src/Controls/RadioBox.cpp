@@ -6,7 +6,7 @@ using namespace Controls;
 using namespace Graphics;
 using namespace Input;
 
-RadioBox::RadioBox(const ConstString& caption, string_view layout, int groupID, int controlID, bool checked)
+RadioBox::RadioBox(const ConstString& caption, const ConstLayout& layout, int groupID, int controlID, bool checked)
     : Control(new ControlContext(), caption, layout, true)
 {
     auto Members              = reinterpret_cast<ControlContext*>(this->Context);
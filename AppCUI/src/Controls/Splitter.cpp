@@ -104,7 +104,8 @@ Splitter::~Splitter()
 {
     DELETE_CONTROL_CONTEXT(SplitterControlContext);
 }
-Splitter::Splitter(string_view layout, SplitterFlags flags) : Control(new SplitterControlContext(), "", layout, false)
+Splitter::Splitter(const ConstLayout& layout, SplitterFlags flags)
+    : Control(new SplitterControlContext(), "", layout, false)
 {
     auto Members                    = reinterpret_cast<SplitterControlContext*>(this->Context);
     Members->Flags                  = GATTR_ENABLE | GATTR_VISIBLE | GATTR_TABSTOP | (uint32) flags;
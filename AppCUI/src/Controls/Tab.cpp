@@ -250,7 +250,7 @@ bool Tab_SetCurrentTabPageByIndex(Tab* t, uint32 index, bool forceFocus)
     if (Members->Flags && TabFlags::ListView)
     {
         Members->UpdateMargins();
-        AppCUI::Application::GetApplication()->RepaintStatus = REPAINT_STATUS_COMPUTE_POSITION;
+        Members->MarkLayoutDirty();
     }
     t->RaiseEvent(Event::TabChanged);
     return res;
@@ -267,7 +267,8 @@ bool TabPage::OnBeforeResize(int, int)
 {
     return true;
 }
-Tab::Tab(string_view layout, TabFlags flags, uint32 tabPageSize) : Control(new TabControlContext(), "", layout, false)
+Tab::Tab(const ConstLayout& layout, TabFlags flags, uint32 tabPageSize)
+    : Control(new TabControlContext(), "", layout, false)
 {
     tabPageSize = std::min<>(1000U, tabPageSize);
     tabPageSize = std::max<>(10U, tabPageSize);
@@ -333,7 +334,7 @@ void Tab::OnFocus()
     OnAfterResize(0, 0);
     CREATE_TYPECONTROL_CONTEXT(TabControlContext, Members, );
     Members->UpdateMargins();
-    AppCUI::Application::GetApplication()->RepaintStatus = REPAINT_STATUS_COMPUTE_POSITION;
+    Members->MarkLayoutDirty();
 }
 bool Tab::OnMouseLeave()
 {
@@ -24,7 +24,7 @@ ColumnsHeaderViewFlags TreeViewFlagsToColumnsHeaderViewFlags(TreeViewFlags flags
     return f;
 }
 
-TreeView::TreeView(string_view layout, std::initializer_list<ConstString> columns, TreeViewFlags flags)
+TreeView::TreeView(const ConstLayout& layout, std::initializer_list<ConstString> columns, TreeViewFlags flags)
     : ColumnsHeaderView(new TreeControlContext(this, columns, TreeViewFlagsToColumnsHeaderViewFlags(flags)), layout)
 {
     const auto cc        = reinterpret_cast<TreeControlContext*>(Context);
@@ -2,7 +2,7 @@
 
 namespace AppCUI::Controls
 {
-UserControl::UserControl(const ConstString& caption, string_view layout, UserControlFlags flags)
+UserControl::UserControl(const ConstString& caption, const ConstLayout& layout, UserControlFlags flags)
     : Control(new ControlContext(), caption, layout, false)
 {
     auto cc   = reinterpret_cast<ControlContext*>(this->Context);
@@ -23,7 +23,8 @@ UserControl::UserControl(const ConstString& caption, string_view layout, UserCon
     cc->ScrollBars.OutsideControl = ((flags & UserControlFlags::ScrollBarOutsideControl) != UserControlFlags::None);
 }
 
-UserControl::UserControl(string_view layout, UserControlFlags flags) : Control(new ControlContext(), "", layout, false)
+UserControl::UserControl(const ConstLayout& layout, UserControlFlags flags)
+    : Control(new ControlContext(), "", layout, false)
 {
     auto cc   = reinterpret_cast<ControlContext*>(this->Context);
     cc->Flags = GATTR_ENABLE | GATTR_VISIBLE | GATTR_TABSTOP;
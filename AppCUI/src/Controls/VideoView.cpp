@@ -0,0 +1,368 @@
+#include "ControlContext.hpp"
+
+namespace AppCUI
+{
+constexpr uint32 VIDEOVIEW_RING_FRAMES = 8;
+constexpr uint32 VIDEOVIEW_MAX_FPS     = 240;
+constexpr uint64 VIDEOVIEW_NO_END      = 0xFFFFFFFFFFFFFFFFULL;
+
+// a sequence of images that are converted to characters (on the decoding thread) only when they are played
+class ImageFramesSource : public Graphics::FrameSource
+{
+    std::vector<Graphics::Image> images;
+    Graphics::ImageRenderingMethod method;
+    Graphics::ImageScaleMethod scale;
+
+  public:
+    ImageFramesSource(
+          std::vector<Graphics::Image>&& frames,
+          Graphics::ImageRenderingMethod renderMethod,
+          Graphics::ImageScaleMethod scaleMethod)
+        : images(std::move(frames)), method(renderMethod), scale(scaleMethod)
+    {
+    }
+    uint32 GetFramesCount() override
+    {
+        return (uint32) images.size();
+    }
+    bool DrawFrame(uint32 index, Graphics::Canvas& frame) override
+    {
+        return Graphics::ConvertImageToCells(images[index], method, scale, frame);
+    }
+};
+
+VideoViewControlContext::~VideoViewControlContext()
+{
+    StopWorker();
+}
+bool VideoViewControlContext::Start(std::unique_ptr<Graphics::FrameSource> frameSource, uint32 fps)
+{
+    StopWorker();
+    this->source          = std::move(frameSource);
+    this->framesCount     = this->source->GetFramesCount();
+    this->framesPerSecond = fps;
+    this->ring            = std::make_unique<Frame[]>(VIDEOVIEW_RING_FRAMES);
+    this->readPos         = 0;
+    this->writePos        = 0;
+    this->stopWorker      = false;
+    this->playing         = false;
+    Reset();
+    this->worker = std::thread(&VideoViewControlContext::DecodeFrames, this);
+    return true;
+}
+void VideoViewControlContext::StopWorker()
+{
+    if (!this->worker.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->stopWorker = true;
+    }
+    this->frameConsumed.notify_one();
+    this->worker.join();
+}
+void VideoViewControlContext::Reset()
+{
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->generation++;
+        this->readPos        = this->writePos; // frames that are already decoded are discarded
+        this->nextPosition   = 0;
+        this->targetPosition = 0;
+        this->endPosition    = this->loop ? VIDEOVIEW_NO_END : this->framesCount - 1;
+        this->needKeyFrame   = true;
+    }
+    this->frameConsumed.notify_one();
+    this->startPosition     = 0;
+    this->presentedPosition = 0;
+    this->droppedFrames     = 0;
+    this->presentedAny      = false;
+}
+void VideoViewControlContext::DecodeFrames()
+{
+    const Frame* previous = nullptr; // changes are computed against the last decoded frame
+    std::unique_lock<std::mutex> guard(this->lock);
+    while (true)
+    {
+        this->frameConsumed.wait(guard, [this]() {
+            return (this->stopWorker) || ((this->writePos - this->readPos < VIDEOVIEW_RING_FRAMES) &&
+                                          (std::max<>(this->nextPosition, this->targetPosition) <= this->endPosition));
+        });
+        if (this->stopWorker)
+            return;
+        // frames that should have already been presented are not decoded at all
+        const auto position   = std::max<>(this->nextPosition, this->targetPosition);
+        const auto generation = this->generation;
+        auto& frame           = this->ring[this->writePos % VIDEOVIEW_RING_FRAMES];
+        auto keyFrame         = this->needKeyFrame || (previous == nullptr);
+        this->needKeyFrame    = false;
+        guard.unlock();
+
+        const auto decoded = this->source->DrawFrame((uint32) (position % this->framesCount), frame.cells);
+        const auto w       = frame.cells.GetWidth();
+        const auto h       = frame.cells.GetHeight();
+        if (decoded)
+        {
+            if ((!keyFrame) && ((previous->cells.GetWidth() != w) || (previous->cells.GetHeight() != h)))
+                keyFrame = true;
+            frame.changes.resize(h);
+            const auto* c = frame.cells.GetCharactersBuffer();
+            const auto* p = keyFrame ? nullptr : previous->cells.GetCharactersBuffer();
+            for (uint32 y = 0; y < h; y++, c += w)
+            {
+                uint32 left = 0, right = w;
+                if (p)
+                {
+                    while ((left < w) && (c[left].PackedValue == p[left].PackedValue))
+                        left++;
+                    while ((right > left) && (c[right - 1].PackedValue == p[right - 1].PackedValue))
+                        right--;
+                    p += w;
+                }
+                frame.changes[y] = { left, right };
+            }
+        }
+
+        guard.lock();
+        if (generation != this->generation)
+            continue; // stopped while decoding
+        this->nextPosition = position + 1;
+        if (!decoded)
+        {
+            LOG_ERROR("Fail to decode frame %u", (uint32) (position % this->framesCount));
+            continue;
+        }
+        frame.position = position;
+        frame.keyFrame = keyFrame;
+        previous       = &frame;
+        this->writePos++;
+    }
+}
+uint64 VideoViewControlContext::GetCurrentPosition() const
+{
+    if (!this->playing)
+        return this->startPosition;
+    const auto elapsed =
+          std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - this->startTime);
+    const auto position = this->startPosition + ((uint64) elapsed.count()) * this->framesPerSecond / 1000;
+    return std::min<>(position, this->endPosition);
+}
+bool VideoViewControlContext::Present()
+{
+    if (!this->source)
+        return false;
+    const auto due = GetCurrentPosition();
+    uint64 first, last;
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->targetPosition = due;
+        first                = this->readPos;
+        last                 = this->writePos;
+    }
+    this->frameConsumed.notify_one();
+    // frames in [first, last) are not modified by the decoding thread until readPos is moved past them
+    auto end = first;
+    while ((end < last) && (this->ring[end % VIDEOVIEW_RING_FRAMES].position <= due))
+        end++;
+    if (end == first)
+        return false; // too early for the next frame (or it was not decoded yet)
+
+    // the characters that changed in any of the skipped frames are copied from the last one
+    const auto& frame = this->ring[(end - 1) % VIDEOVIEW_RING_FRAMES];
+    const auto w      = frame.cells.GetWidth();
+    const auto h      = frame.cells.GetHeight();
+    auto fullCopy     = (w != canvas.GetWidth()) || (h != canvas.GetHeight());
+    if (fullCopy)
+    {
+        CHECK(canvas.Resize(w, h), false, "Fail to set canvas size to %ux%u", w, h);
+        MoveScrollTo(CanvasScrollX, CanvasScrollY);
+    }
+    // newest to oldest: every frame after a key frame has the same size as the last one
+    pendingChanges.assign(h, { w, 0 });
+    for (auto pos = end; (pos > first) && (!fullCopy); pos--)
+    {
+        const auto& f = this->ring[(pos - 1) % VIDEOVIEW_RING_FRAMES];
+        if (f.keyFrame)
+        {
+            fullCopy = true;
+            break;
+        }
+        for (uint32 y = 0; y < h; y++)
+        {
+            if (f.changes[y].left < f.changes[y].right)
+            {
+                pendingChanges[y].left  = std::min<>(pendingChanges[y].left, f.changes[y].left);
+                pendingChanges[y].right = std::max<>(pendingChanges[y].right, f.changes[y].right);
+            }
+        }
+    }
+    const auto* src = frame.cells.GetCharactersBuffer();
+    auto* dst       = canvas.GetCharactersBuffer();
+    size_t changed  = 0;
+    if (fullCopy)
+    {
+        changed = (size_t) w * h;
+        memcpy(dst, src, sizeof(Graphics::Character) * changed);
+    }
+    else
+    {
+        for (uint32 y = 0; y < h; y++, src += w, dst += w)
+        {
+            const auto& c = pendingChanges[y];
+            if (c.left < c.right)
+            {
+                memcpy(dst + c.left, src + c.left, sizeof(Graphics::Character) * (c.right - c.left));
+                changed += c.right - c.left;
+            }
+        }
+    }
+    if ((this->presentedAny) && (frame.position > this->presentedPosition + 1))
+        this->droppedFrames += frame.position - this->presentedPosition - 1;
+    this->presentedPosition = frame.position;
+    this->presentedAny      = true;
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->readPos = end;
+    }
+    this->frameConsumed.notify_one();
+
+    if ((this->playing) && (this->presentedPosition >= this->endPosition))
+    {
+        // last frame (no loop)
+        this->playing       = false;
+        this->startPosition = this->endPosition;
+    }
+    // nothing changed --> no need to repaint (and flush) the screen
+    return changed > 0;
+}
+
+VideoView::VideoView(const ConstString& caption, const ConstLayout& layout, ViewerFlags flags)
+    : CanvasViewer(new VideoViewControlContext(), caption, layout, 16, 16, flags)
+{
+    auto Members               = reinterpret_cast<VideoViewControlContext*>(this->Context);
+    Members->readPos           = 0;
+    Members->writePos          = 0;
+    Members->nextPosition      = 0;
+    Members->targetPosition    = 0;
+    Members->endPosition       = 0;
+    Members->generation        = 0;
+    Members->stopWorker        = false;
+    Members->needKeyFrame      = true;
+    Members->startPosition     = 0;
+    Members->presentedPosition = 0;
+    Members->droppedFrames     = 0;
+    Members->framesCount       = 0;
+    Members->framesPerSecond   = 0;
+    Members->playing           = false;
+    Members->loop              = false;
+    Members->presentedAny      = false;
+}
+VideoView::~VideoView()
+{
+    DELETE_CONTROL_CONTEXT(VideoViewControlContext);
+}
+bool VideoView::SetFrames(std::unique_ptr<Graphics::FrameSource> source, uint32 framesPerSecond)
+{
+    CREATE_TYPECONTROL_CONTEXT(VideoViewControlContext, Members, false);
+    CHECK(source, false, "Expecting a valid frame source !");
+    CHECK(source->GetFramesCount() > 0, false, "Frame source has no frames !");
+    CHECK((framesPerSecond > 0) && (framesPerSecond <= VIDEOVIEW_MAX_FPS),
+          false,
+          "Invalid frame rate (%u) - it should be between 1 and %u frames/second",
+          framesPerSecond,
+          VIDEOVIEW_MAX_FPS);
+    Members->MoveScrollTo(0, 0);
+    return Members->Start(std::move(source), framesPerSecond);
+}
+bool VideoView::SetFrames(
+      std::vector<Graphics::Image>&& images,
+      Graphics::ImageRenderingMethod method,
+      Graphics::ImageScaleMethod scale,
+      uint32 framesPerSecond)
+{
+    for (const auto& img : images)
+    {
+        CHECK(img.GetPixelsBuffer(), false, "Image was not instantiated yet (have you called Create methods ?)");
+    }
+    return SetFrames(std::make_unique<ImageFramesSource>(std::move(images), method, scale), framesPerSecond);
+}
+bool VideoView::Play()
+{
+    CREATE_TYPECONTROL_CONTEXT(VideoViewControlContext, Members, false);
+    CHECK(Members->source, false, "No frames were set (have you called SetFrames ?)");
+    if (Members->playing)
+        return true;
+    if ((!Members->loop) && (Members->startPosition >= Members->endPosition))
+        Members->Reset(); // the last frame was reached --> start again
+    Members->startTime = std::chrono::steady_clock::now();
+    Members->playing   = true;
+    return true;
+}
+void VideoView::Pause()
+{
+    CREATE_TYPECONTROL_CONTEXT(VideoViewControlContext, Members, );
+    Members->startPosition = Members->GetCurrentPosition();
+    Members->playing       = false;
+}
+void VideoView::Stop()
+{
+    CREATE_TYPECONTROL_CONTEXT(VideoViewControlContext, Members, );
+    Members->playing = false;
+    if (Members->source)
+        Members->Reset(); // the first frame is shown again
+}
+void VideoView::SetLoop(bool loop)
+{
+    CREATE_TYPECONTROL_CONTEXT(VideoViewControlContext, Members, );
+    if (Members->loop == loop)
+        return;
+    const auto position = Members->GetCurrentPosition();
+    Members->loop       = loop;
+    {
+        std::lock_guard<std::mutex> guard(Members->lock);
+        if (loop)
+            Members->endPosition = VIDEOVIEW_NO_END;
+        else if (Members->framesCount > 0)
+            Members->endPosition = (position / Members->framesCount + 1) * Members->framesCount - 1; // this cycle
+    }
+    Members->frameConsumed.notify_one();
+}
+bool VideoView::IsPlaying() const
+{
+    CREATE_TYPECONTROL_CONTEXT(VideoViewControlContext, Members, false);
+    return Members->playing;
+}
+uint32 VideoView::GetFramesCount() const
+{
+    CREATE_TYPECONTROL_CONTEXT(VideoViewControlContext, Members, 0);
+    return Members->framesCount;
+}
+uint32 VideoView::GetCurrentFrame() const
+{
+    CREATE_TYPECONTROL_CONTEXT(VideoViewControlContext, Members, 0);
+    return Members->presentedAny ? (uint32) (Members->presentedPosition % Members->framesCount) : 0;
+}
+uint64 VideoView::GetDroppedFramesCount() const
+{
+    CREATE_TYPECONTROL_CONTEXT(VideoViewControlContext, Members, 0);
+    return Members->droppedFrames;
+}
+bool VideoView::OnFrameUpdate()
+{
+    CREATE_TYPECONTROL_CONTEXT(VideoViewControlContext, Members, false);
+    return Members->Present();
+}
+bool VideoView::OnKeyEvent(Input::Key keyCode, char16 UnicodeChar)
+{
+    CREATE_TYPECONTROL_CONTEXT(VideoViewControlContext, Members, false);
+    if ((keyCode == Input::Key::Space) && (Members->source))
+    {
+        if (Members->playing)
+            Pause();
+        else
+            Play();
+        return true;
+    }
+    return CanvasViewer::OnKeyEvent(keyCode, UnicodeChar);
+}
+} // namespace AppCUI
@@ -226,25 +226,38 @@ Control* FindClosestControl(Control* parent, MoveDirection dir)
     // now we need to search the first child that is closest to childPos
     return FindClosestControl(parent, dir, currenChild);
 }
-bool ProcessHotKey(Control* ctrl, Input::Key KeyCode)
+void BuildHotKeyTable(Control* ctrl, std::unordered_map<Input::Key, Control*>& table)
 {
     if (ctrl == nullptr)
-        return false;
-    CREATE_CONTROL_CONTEXT(ctrl, Members, false);
+        return;
+    CREATE_CONTROL_CONTEXT(ctrl, Members, );
     if (((Members->Flags & (GATTR_VISIBLE | GATTR_ENABLE)) != (GATTR_VISIBLE | GATTR_ENABLE)))
-        return false;
+        return;
+    // children are checked first, and the first control that uses a hot key owns it
+    // (emplace will not overwrite an existing entry)
     for (uint32 tr = 0; tr < Members->ControlsCount; tr++)
+        BuildHotKeyTable(Members->Controls[tr], table);
+    if (Members->HotKey != Key::None)
+        table.emplace(Members->HotKey, ctrl);
+}
+bool ProcessHotKey(Window* win, WindowControlContext* Members, Input::Key KeyCode)
+{
+    // the table is rebuilt only if a hot key, a child or the state of a control has changed since its last use
+    const auto version = Application::GetApplication()->HotKeysVersion;
+    if ((!Members->HotKeys.Built) || (Members->HotKeys.Version != version))
     {
-        if (ProcessHotKey(Members->Controls[tr], KeyCode))
-            return true;
-    }
-    if (ctrl->GetHotKey() == KeyCode)
-    {
-        ctrl->SetFocus();
-        ctrl->OnHotKey();
-        return true;
+        Members->HotKeys.Table.clear();
+        BuildHotKeyTable(win, Members->HotKeys.Table);
+        Members->HotKeys.Version = version;
+        Members->HotKeys.Built   = true;
     }
-    return false;
+    auto it = Members->HotKeys.Table.find(KeyCode);
+    if (it == Members->HotKeys.Table.end())
+        return false;
+    auto ctrl = it->second;
+    ctrl->SetFocus();
+    ctrl->OnHotKey();
+    return true;
 }
 void UpdateWindowButtonPos(WindowBarItem* b, WindowControlBarLayoutData& layout, bool fromLeft)
 {
@@ -700,7 +713,7 @@ Window::~Window()
 {
     DELETE_CONTROL_CONTEXT(WindowControlContext);
 }
-Window::Window(const ConstString& caption, string_view layout, WindowFlags Flags)
+Window::Window(const ConstString& caption, const ConstLayout& layout, WindowFlags Flags)
     : Control(new WindowControlContext(), caption, layout, false)
 {
     auto Members              = reinterpret_cast<WindowControlContext*>(this->Context);
@@ -715,6 +728,8 @@ Window::Window(const ConstString& caption, string_view layout, WindowFlags Flags
 
     Members->Maximized                       = false;
     Members->ResizeMoveMode                  = false;
+    Members->HotKeys.Version                 = 0;
+    Members->HotKeys.Built                   = false;
     Members->dragStatus                      = WindowDragStatus::None;
     Members->DialogResult                    = -1;
     Members->ControlBar.Current              = NO_CONTROLBAR_ITEM;
@@ -1013,7 +1028,7 @@ bool Window::MaximizeRestore()
         Members->Maximized = false;
     }
     UpdateWindowsButtonsPoz(Members);
-    AppCUI::Application::GetApplication()->RepaintStatus = REPAINT_STATUS_COMPUTE_POSITION;
+    // MoveTo/Resize have already marked this window's subtree for a layout update
     return true;
 }
 bool Window::CenterScreen()
@@ -1369,7 +1384,7 @@ bool Window::OnKeyEvent(Input::Key KeyCode, char16)
         // check cntrols hot keys
         if ((((uint32) KeyCode) & (uint32) (Key::Shift | Key::Alt | Key::Ctrl)) == ((uint32) Key::Alt))
         {
-            if (ProcessHotKey(this, KeyCode))
+            if (ProcessHotKey(this, Members, KeyCode))
                 return true;
             auto* b = Members->ControlBar.Items;
             auto* e = b + Members->ControlBar.Count;
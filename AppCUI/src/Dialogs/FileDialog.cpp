@@ -1,7 +1,11 @@
-#include "AppCUI.hpp"
+#include "Internal.hpp"
 
 #include <set>
 #include <stack>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace AppCUI
 {
@@ -13,6 +17,12 @@ using namespace std::literals;
 
 constexpr uint32 ALL_FILES_INDEX = 0xFFFFFFFFU;
 
+constexpr uint32 LISTING_FIRST_BATCH     = 64;    // about a screen of entries
+constexpr uint32 LISTING_BATCH           = 4096;  // entries sent to the UI thread at once
+constexpr uint32 LISTING_LIVE_SORT_LIMIT = 20000; // larger lists are only sorted after the whole directory was read
+constexpr auto LISTING_FIRST_BATCH_WAIT  = std::chrono::milliseconds(100);
+constexpr auto LISTING_PUBLISH_INTERVAL  = std::chrono::milliseconds(100);
+
 void ConvertSizeToString(uint64 size, char result[32])
 {
     result[31] = 0;
@@ -76,6 +86,129 @@ vector<u16string_view> splitSV(u16string_view strv, u16string_view delims = u" "
     return output;
 }
 
+// entries of a directory - read on a worker thread and added to the list view (in batches) by the UI thread
+// the worker owns a reference to this object --> changing the path does not have to wait for it to stop (a stopped
+// worker is joined once it finishes, or when the dialog is closed)
+struct DirectoryListing
+{
+    struct Item
+    {
+        std::u16string name;
+        char size[32];
+        char modified[32];
+        bool isFolder;
+    };
+    std::mutex lock;
+    std::condition_variable changed;
+    vector<Item> items; // read, but not added to the list view yet
+    std::atomic<bool> cancelled;
+    bool finished, failed;
+
+    DirectoryListing() : cancelled(false), finished(false), failed(false)
+    {
+    }
+    void Publish(vector<Item>& batch, bool last)
+    {
+        {
+            std::lock_guard<std::mutex> guard(this->lock);
+            if (this->items.empty())
+                std::swap(this->items, batch);
+            else
+                this->items.insert(
+                      this->items.end(), std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+            this->finished = last;
+        }
+        batch.clear();
+        this->changed.notify_all();
+    }
+};
+
+bool IsExtensionAccepted(const std::u16string& name, const std::set<uint32>& filter)
+{
+    const auto pos = name.rfind(u'.');
+    if ((pos == std::u16string::npos) || (pos == 0))
+        return filter.contains(__compute_hash__(name.data(), name.data())); // no extension
+    return filter.contains(__compute_hash__(name.data() + pos + 1, name.data() + name.size()));
+}
+
+void ReadDirectory(std::shared_ptr<DirectoryListing> listing, std::filesystem::path path, std::set<uint32> filter)
+{
+    DateTime dt;
+    vector<DirectoryListing::Item> batch;
+    uint32 batchSize = LISTING_FIRST_BATCH;
+    auto lastPublish = std::chrono::steady_clock::now();
+    auto addEntry    = [&](const DirectoryEntry& entry)
+    {
+        if ((!entry.IsFolder) && (!filter.empty()) && (!IsExtensionAccepted(entry.Name, filter)))
+            return;
+        auto& item    = batch.emplace_back();
+        item.name     = entry.Name;
+        item.isFolder = entry.IsFolder;
+        if (entry.IsFolder)
+            Utils::String::Set(item.size, "Folder", 32, 6);
+        else
+            ConvertSizeToString(entry.Size, item.size);
+        if (entry.ModifiedTime)
+            dt.CreateFromTimestamp(entry.ModifiedTime);
+        else
+            dt.Reset();
+        const auto modified = dt.GetStringRepresentation();
+        Utils::String::Set(item.modified, modified.data(), 32, (uint32) modified.size());
+
+        const auto now = std::chrono::steady_clock::now();
+        if ((batch.size() >= batchSize) || (now - lastPublish >= LISTING_PUBLISH_INTERVAL))
+        {
+            listing->Publish(batch, false);
+            batchSize   = LISTING_BATCH;
+            lastPublish = now;
+        }
+    };
+
+    // directories that were listed before (and did not change since then) are not read again
+    auto cached = DirectoryCache::Find(path);
+    if (cached)
+    {
+        for (auto& entry : *cached)
+        {
+            if (listing->cancelled)
+                break;
+            addEntry(entry);
+        }
+        listing->Publish(batch, true);
+        return;
+    }
+
+    const auto ticket = DirectoryCache::BeginRead(path);
+    DirectoryReader reader;
+    if (!reader.Open(path))
+    {
+        listing->failed = true;
+        listing->Publish(batch, true);
+        return;
+    }
+    // all entries are cached (a different filter does not require another read) --> the attributes of every entry
+    // are read, unless the directory can not be cached
+    const auto cacheable = ticket != DirectoryCache::INVALID_TICKET;
+    auto entries         = std::make_shared<DirectoryEntries>();
+    DirectoryReader::Entry e;
+    DirectoryEntry entry;
+    while ((!listing->cancelled) && (reader.Next(e)))
+    {
+        // the type of most entries is known without reading their attributes --> files that are filtered out by
+        // their extension are skipped without any other system call
+        if ((!cacheable) && (e.Type == DirectoryReader::EntryType::File) && (!filter.empty()) &&
+            (!IsExtensionAccepted(e.Name, filter)))
+            continue;
+        reader.ReadEntry(e, entry);
+        addEntry(entry);
+        if (cacheable)
+            entries->push_back(std::move(entry));
+    }
+    if ((cacheable) && (!listing->cancelled))
+        DirectoryCache::Store(path, ticket, std::move(entries));
+    listing->Publish(batch, true);
+}
+
 class FileDialogWindow : public Window
 {
   public:
@@ -84,8 +217,10 @@ class FileDialogWindow : public Window
           const ConstString& fileName,
           const ConstString& extensionsFilter,
           const std::filesystem::path& _path);
+    ~FileDialogWindow();
 
     bool OnEvent(Reference<Control> sender, Event eventType, int controlID) override;
+    bool OnFrameUpdate() override;
     std::filesystem::path GetResultedPath() const;
 
   protected:
@@ -105,8 +240,17 @@ class FileDialogWindow : public Window
     const std::set<uint32>* extFilter;
     std::filesystem::path resultedPath;
     std::filesystem::path currentPath;
+    std::shared_ptr<DirectoryListing> listing;
+    std::thread worker; // reads the entries of "listing"
+    struct StoppedWorker
+    {
+        std::shared_ptr<DirectoryListing> listing;
+        std::thread worker;
+    };
+    vector<StoppedWorker> stoppedWorkers; // the path was changed before they finished
 
     bool openDialog;
+    bool listingInBackground;
 
     void LoadAllSpecialLocations();
     bool ProcessExtensionFilter(const ConstString& extensionsFilter);
@@ -116,6 +260,10 @@ class FileDialogWindow : public Window
 
     void UpdateCurrentPath(const std::filesystem::path& newPath);
     void ReloadCurrentPath();
+    bool AddListedItems();
+    void ReleaseListing();
+    void StopListing();
+    void JoinStoppedWorkers(bool wait);
 
     void ProcessTextFieldInput();
     void FileListItemClicked();
@@ -145,7 +293,8 @@ FileDialogWindow::FileDialogWindow(
       const ConstString& fileName,
       const ConstString& extensionsFilter,
       const std::filesystem::path& specifiedPath)
-    : Window(open ? "Open" : "Save", "w:78,h:23,d:c", WindowFlags::None), extFilter(nullptr), openDialog(open)
+    : Window(open ? "Open" : "Save", "w:78,h:23,d:c", WindowFlags::None), extFilter(nullptr), openDialog(open),
+      listingInBackground(false)
 {
     const std::filesystem::path initialPath = CanonizePath(specifiedPath.empty() ? "." : specifiedPath);
 
@@ -223,6 +372,13 @@ FileDialogWindow::FileDialogWindow(
     txName->SetFocus();
 }
 
+FileDialogWindow::~FileDialogWindow()
+{
+    // the workers use the directory cache --> none of them can outlive the dialog
+    StopListing();
+    JoinStoppedWorkers(true);
+}
+
 void FileDialogWindow::LoadAllSpecialLocations()
 {
     SpecialFolderMap specialFoldersMap;
@@ -416,6 +572,7 @@ void FileDialogWindow::UpdateCurrentExtensionFilter()
 
 void FileDialogWindow::ReloadCurrentPath()
 {
+    StopListing();
     files->DeleteAllItems();
 
     if (currentPath != currentPath.root_path())
@@ -423,59 +580,108 @@ void FileDialogWindow::ReloadCurrentPath()
         files->AddItem({ "..", "UP-DIR" }).SetData(0);
     }
 
-    char size[32];
-    AppCUI::OS::DateTime dt;
-    try
+    this->listing = std::make_shared<DirectoryListing>();
+    this->worker  = std::thread(
+          ReadDirectory, this->listing, currentPath, extFilter ? *extFilter : std::set<uint32>());
+    {
+        // a small directory (or the first screen of a large one) is shown right away
+        std::unique_lock<std::mutex> lock(this->listing->lock);
+        this->listing->changed.wait_for(lock, LISTING_FIRST_BATCH_WAIT, [this]() {
+            return (this->listing->finished) || (this->listing->items.size() >= LISTING_FIRST_BATCH);
+        });
+    }
+    AddListedItems();
+    if (this->listing)
+    {
+        // the rest of the entries are added on frame updates
+        Application::GetApplication()->terminal->FrameUpdateRequests++;
+        this->listingInBackground = true;
+    }
+}
+
+bool FileDialogWindow::AddListedItems()
+{
+    vector<DirectoryListing::Item> items;
+    bool finished, failed;
     {
-        for (const auto& fileEntry : std::filesystem::directory_iterator(currentPath))
+        std::lock_guard<std::mutex> guard(this->listing->lock);
+        std::swap(items, this->listing->items);
+        finished = this->listing->finished;
+        failed   = this->listing->failed;
+    }
+    for (const auto& entry : items)
+    {
+        auto item = this->files->AddItem({ entry.name, entry.size, entry.modified });
+        if (entry.isFolder)
         {
-            if (fileEntry.is_directory())
-            {
-                Utils::String::Set(size, "Folder", 32, 6);
-            }
-            else
-            {
-                // check filter first
-                if (extFilter)
-                {
-                    // a filter is set - let's check the extention
-                    auto ext16          = fileEntry.path().extension().u16string();
-                    auto ext16Start     = ext16.data();
-                    const auto ext16End = ext16.data() + ext16.size();
-
-                    if (ext16.length() > 1 && ext16[0] == '.')
-                    {
-                        ext16Start++;
-                    }
-                    if (!extFilter->contains(__compute_hash__(ext16Start, ext16End)))
-                    {
-                        continue; // extension is filtered
-                    }
-                }
-                ConvertSizeToString((uint64) fileEntry.file_size(), size);
-            }
-
-            dt.CreateFrom(fileEntry);
-            auto item =
-                  this->files->AddItem({ fileEntry.path().filename().u16string(), size, dt.GetStringRepresentation() });
-            if (fileEntry.is_directory())
-            {
-                item.SetType(ListViewItem::Type::Highlighted);
-                item.SetData(1);
-            }
-            else
-            {
-                item.SetType(ListViewItem::Type::GrayedOut);
-                item.SetData(2);
-            }
+            item.SetType(ListViewItem::Type::Highlighted);
+            item.SetData(1);
+        }
+        else
+        {
+            item.SetType(ListViewItem::Type::GrayedOut);
+            item.SetData(2);
         }
     }
-    catch (...)
+    if ((finished) || ((!items.empty()) && (files->GetItemsCount() <= LISTING_LIVE_SORT_LIMIT)))
+        files->Sort();
+    if (finished)
     {
-        MessageBox::ShowError("Error", u"Unable to read location: "s + currentPath.u16string());
+        ReleaseListing();
+        if (failed)
+            MessageBox::ShowError("Error", u"Unable to read location: "s + currentPath.u16string());
     }
+    return (finished) || (!items.empty());
+}
+
+void FileDialogWindow::ReleaseListing()
+{
+    // the worker is done (it published its last batch) or it was moved to the stopped workers
+    if (this->worker.joinable())
+        this->worker.join();
+    this->listing.reset();
+    if (this->listingInBackground)
+    {
+        Application::GetApplication()->terminal->FrameUpdateRequests--;
+        this->listingInBackground = false;
+    }
+}
+
+void FileDialogWindow::StopListing()
+{
+    if (!this->listing)
+        return;
+    this->listing->cancelled = true;
+    JoinStoppedWorkers(false);
+    this->stoppedWorkers.push_back({ this->listing, std::move(this->worker) });
+    ReleaseListing();
+}
+
+void FileDialogWindow::JoinStoppedWorkers(bool wait)
+{
+    for (auto it = this->stoppedWorkers.begin(); it != this->stoppedWorkers.end();)
+    {
+        bool finished = wait;
+        if (!finished)
+        {
+            std::lock_guard<std::mutex> guard(it->listing->lock);
+            finished = it->listing->finished;
+        }
+        if (finished)
+        {
+            it->worker.join();
+            it = this->stoppedWorkers.erase(it);
+        }
+        else
+            it++;
+    }
+}
 
-    files->Sort();
+bool FileDialogWindow::OnFrameUpdate()
+{
+    if (!this->listing)
+        return false;
+    return AddListedItems();
 }
 
 void FileDialogWindow::UpdateCurrentPath(const std::filesystem::path& newPath)
@@ -1,4 +1,5 @@
 #include "ImageLoader.hpp"
+#include "Internal.hpp"
 
 namespace AppCUI::Graphics
 {
@@ -270,4 +271,99 @@ bool LoadBMPToImage(Image& img, const uint8* buffer, uint32 size)
     // all good
     return LoadDIBToImage(img, buffer + sizeof(BMP_Header), size - (uint32) sizeof(BMP_Header), false);
 }
+
+class BitmapTileSource : public TileSource
+{
+    OS::MappedFile file;
+    const uint8* pixels; // first line of pixels from the file
+    uint64 lineSize;
+    uint32 bytesPerPixel;
+    bool bottomUp;
+    Pixel colorTable[256];
+
+  public:
+    bool Open(const std::filesystem::path& path);
+    void ReadPixels(uint32 x, uint32 y, uint32 count, uint32 lines, uint32 step, Pixel* output, uint32 stride) override;
+};
+bool BitmapTileSource::Open(const std::filesystem::path& path)
+{
+    const auto view = OS::MapWholeFile(this->file, path);
+    if (!view.IsValid())
+        return false;
+    // the tiles are read in any order
+    this->file.SetAccessPattern(OS::AccessPattern::Random);
+    const auto* data = view.GetData();
+    const auto size  = (uint64) view.GetLength();
+    if ((size < sizeof(BMP_Header) + sizeof(BMP_InfoHeader)) ||
+        (reinterpret_cast<const BMP_Header*>(data)->magic != BITMAP_WINDOWS_MAGIC))
+        return false; // not a bitmap
+    auto* h  = reinterpret_cast<const BMP_Header*>(data);
+    auto* ih = reinterpret_cast<const BMP_InfoHeader*>(data + sizeof(BMP_Header));
+    // BITMAPINFOHEADER or one of its extensions (V4/V5 headers have the same first 40 bytes)
+    if ((ih->sizeOfHeader < 40) || (ih->comppresionMethod != BITMAP_COMPRESSION_METHID_BI_RGB) || (ih->width <= 0) ||
+        (ih->height == 0))
+        return false;
+    if ((ih->bitsPerPixel != 8) && (ih->bitsPerPixel != 24) && (ih->bitsPerPixel != 32))
+        return false; // the rest of the formats are loaded in memory
+    this->width         = (uint32) ih->width;
+    this->height        = ih->height > 0 ? (uint32) ih->height : (uint32) (-((int64) ih->height));
+    this->bytesPerPixel = ih->bitsPerPixel / 8;
+    this->bottomUp      = ih->height > 0;
+    this->lineSize      = ((((uint64) this->width) * ih->bitsPerPixel + 31) / 32) * 4;
+    CHECK(h->pixelOffset + this->lineSize * this->height <= size,
+          false,
+          "Bitmap is truncated (%llu bytes are needed for %ux%u pixels)",
+          (unsigned long long) (h->pixelOffset + this->lineSize * this->height),
+          this->width,
+          this->height);
+    this->pixels = data + h->pixelOffset;
+
+    if (this->bytesPerPixel == 1)
+    {
+        const uint64 tableOffset = sizeof(BMP_Header) + (uint64) ih->sizeOfHeader;
+        uint64 colors            = ih->numberOfColors == 0 ? 256 : std::min<uint64>(ih->numberOfColors, 256);
+        colors                   = std::min<uint64>(colors, (size - std::min<uint64>(tableOffset, size)) / 4);
+        for (uint32 tr = 0; tr < 256; tr++)
+        {
+            if (tr < colors)
+            {
+                const auto* c   = data + tableOffset + tr * 4;
+                colorTable[tr] = Pixel(c[2], c[1], c[0]);
+            }
+            else
+                colorTable[tr] = Pixel(0, 0, 0);
+        }
+    }
+    return true;
+}
+void BitmapTileSource::ReadPixels(
+      uint32 x, uint32 y, uint32 count, uint32 lines, uint32 step, Pixel* output, uint32 stride)
+{
+    const uint64 pixelStep = (uint64) step * this->bytesPerPixel;
+    for (uint32 j = 0; j < lines; j++, output += stride)
+    {
+        const uint64 line = (uint64) y + (uint64) j * step;
+        const auto* p     = this->pixels + this->lineSize * (this->bottomUp ? this->height - 1 - line : line) +
+                        (uint64) x * this->bytesPerPixel;
+        switch (this->bytesPerPixel)
+        {
+        case 1:
+            for (uint32 i = 0; i < count; i++, p += pixelStep)
+                output[i] = colorTable[*p];
+            break;
+        default:
+            // 24 and 32 bits (BGR or BGRX)
+            for (uint32 i = 0; i < count; i++, p += pixelStep)
+                output[i] = Pixel(p[2], p[1], p[0]);
+            break;
+        }
+    }
+}
+std::unique_ptr<TileSource> CreateBitmapTileSource(const std::filesystem::path& path)
+{
+    auto source = std::make_unique<BitmapTileSource>();
+    if (!source->Open(path))
+        return nullptr;
+    return source;
+}
 } // namespace AppCUI::Graphics
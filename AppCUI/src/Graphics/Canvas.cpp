@@ -2,6 +2,9 @@
 
 namespace AppCUI::Graphics
 {
+// characters are indexed with 32 bits values (y * width + x)
+constexpr uint64 MAX_CANVAS_CHARACTERS = 0xFFFFFFFFULL;
+
 Canvas::Canvas()
 {
 }
@@ -12,13 +15,14 @@ bool Canvas::Create(uint32 width, uint32 height, int fillCharacter, ColorPair co
 {
     CHECK(width > 0, false, "Width must be greater than 0.");
     CHECK(height > 0, false, "Height must be greater than 0.");
-    if ((width == this->Width) && (height = this->Height))
+    CHECK(((uint64) width) * height <= MAX_CANVAS_CHARACTERS, false, "Canvas too large (%u x %u)", width, height);
+    if ((width == this->Width) && (height == this->Height))
     {
         // no re-allocation required
         CHECK(Clear(fillCharacter, color), false, "");
         return true;
     }
-    Character* tmp = new Character[width * height];
+    Character* tmp = new Character[((size_t) width) * height];
     CHECK(tmp, false, "Fail to allocate %d x %d characters", width, height);
     // all good --> associate the rows to the screen
     Character** ofs_tmp = new Character*[height];
@@ -43,9 +47,10 @@ bool Canvas::Resize(uint32 width, uint32 height, int fillCharacter, ColorPair co
         return Create(width, height, fillCharacter, color);
     CHECK(width > 0, false, "Width must be greater than 0.");
     CHECK(height > 0, false, "Height must be greater than 0.");
+    CHECK(((uint64) width) * height <= MAX_CANVAS_CHARACTERS, false, "Canvas too large (%u x %u)", width, height);
     if ((width == this->Width) && (height == this->Height))
         return true; // nothing to resize
-    Character* tmp = new Character[width * height];
+    Character* tmp = new Character[((size_t) width) * height];
     CHECK(tmp, false, "Fail to allocate %d x %d characters", width, height);
     Character** ofs_tmp = new Character*[height];
     CHECK(ofs_tmp, false, "Fail to allocate offset row vector of %d elements", height);
@@ -1,5 +1,7 @@
 #include "ImageLoader.hpp"
 
+#include <atomic>
+
 namespace AppCUI::Graphics
 {
 constexpr uint32 IMAGE_PNG_MAGIC = 0x474E5089;
@@ -42,6 +44,15 @@ static const Pixel Image_ConsoleColors[16] = {
 #define VALIDATE_CONSOLE_INDEX                                                                                         \
     CHECK(((uint32) color) < 16, false, "Invalid console color index (should be between 0 and 15)");
 
+// generations are unique for all images (an image that is destroyed and one that is created at the same address
+// can not be confused)
+static std::atomic<uint64> Image_LastGeneration = 0;
+
+static uint64 Image_NextGeneration()
+{
+    return ++Image_LastGeneration;
+}
+
 uint8 Image_CharToIndex[256] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0,    0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
@@ -61,9 +72,10 @@ uint8 Image_CharToIndex[256] = {
 
 Image::Image()
 {
-    this->width  = 0;
-    this->height = 0;
-    this->pixels = nullptr;
+    this->width      = 0;
+    this->height     = 0;
+    this->pixels     = nullptr;
+    this->generation = 0;
 }
 Image::~Image()
 {
@@ -87,6 +99,7 @@ Image::Image(const Image& img)
         this->width = this->height = 0;
         this->pixels               = nullptr;
     }
+    this->generation = Image_NextGeneration();
 }
 
 Image& Image::operator=(const Image& img)
@@ -103,6 +116,7 @@ Image& Image::operator=(const Image& img)
         this->pixels = new Pixel[(size_t) img.width * (size_t) img.height];
         memcpy(this->pixels, img.pixels, (size_t) img.width * (size_t) img.height * sizeof(Pixel));
     }
+    this->generation = Image_NextGeneration();
     return *this;
 }
 
@@ -125,8 +139,9 @@ bool Image::Create(uint32 imageWidth, uint32 imageHeight)
         s->ColorValue = 0;
         s++;
     }
-    this->width  = imageWidth;
-    this->height = imageHeight;
+    this->width      = imageWidth;
+    this->height     = imageHeight;
+    this->generation = Image_NextGeneration();
     return true;
 }
 bool Image::Create(uint32 imageWidth, uint32 imageHeight, string_view image)
@@ -148,7 +163,8 @@ bool Image::Create(uint32 imageWidth, uint32 imageHeight, string_view image)
 bool Image::SetPixel(uint32 x, uint32 y, Pixel color)
 {
     CHECK_INDEX(false);
-    *pixel = color;
+    *pixel           = color;
+    this->generation = Image_NextGeneration();
     return true;
 }
 
@@ -156,7 +172,10 @@ bool Image::SetPixel(uint32 x, uint32 y, const Color color)
 {
     CHECK_INDEX(false);
     if (((uint32) color) < 16)
-        *pixel = Image_ConsoleColors[(uint32) color];
+    {
+        *pixel           = Image_ConsoleColors[(uint32) color];
+        this->generation = Image_NextGeneration();
+    }
     return true;
 }
 
@@ -170,8 +189,15 @@ bool Image::Clear(Pixel color)
         (*s) = color;
         s++;
     }
+    this->generation = Image_NextGeneration();
     return true;
 }
+Pixel* Image::GetPixelsBuffer()
+{
+    if (this->pixels)
+        this->generation = Image_NextGeneration();
+    return this->pixels;
+}
 bool Image::Clear(const Color color)
 {
     VALIDATE_CONSOLE_INDEX;
@@ -229,6 +255,14 @@ Pixel Image::ComputeSquareAverageColor(uint32 x, uint32 y, uint32 sz) const
 }
 bool Image::Load(const std::filesystem::path& path)
 {
+    // PNG images are decoded while the file is read (the content of the file is never kept in memory)
+    OS::File f;
+    CHECK(f.OpenRead(path), false, "Fail to open: %s", path.string().c_str());
+    uint32 magic32 = 0;
+    if ((f.Read(magic32)) && (magic32 == IMAGE_PNG_MAGIC) && (f.SetCurrentPos(0)))
+        return LoadPNGToImage(*this, f);
+    f.Close();
+
     auto buf = OS::File::ReadContent(path);
     return Create((const uint8*) buf.GetData(), (uint32) buf.GetLength());
 }
@@ -0,0 +1,84 @@
+#include "Internal.hpp"
+
+namespace AppCUI::Graphics
+{
+// the sums are kept modulo 2^32 --> the difference for a rectangle is exact as long as the real sum fits in 32 bits
+constexpr uint64 MAX_EXACT_RECTANGLE_AREA = 0xFFFFFFFFULL / 255ULL;
+
+bool ImageIntegral::Create(const Image& img)
+{
+    const auto w = img.GetWidth();
+    const auto h = img.GetHeight();
+    CHECK(img.GetPixelsBuffer(), false, "Image was not instantiated yet (have you called Create methods ?)");
+    CHECK((w > 0) && (h > 0), false, "Invalid image size (%ux%u)", w, h);
+
+    const size_t stride = (size_t) w + 1;
+    this->sums.assign(stride * ((size_t) h + 1), Sum{ 0, 0, 0 });
+    this->width  = w;
+    this->height = h;
+
+    const Pixel* p = img.GetPixelsBuffer();
+    for (uint32 y = 0; y < h; y++)
+    {
+        const Sum* prev = this->sums.data() + stride * y;
+        Sum* cur        = this->sums.data() + stride * (y + 1);
+        uint32 r = 0, g = 0, b = 0;
+        for (uint32 x = 1; x <= w; x++, p++)
+        {
+            r += p->Red;
+            g += p->Green;
+            b += p->Blue;
+            cur[x].Red   = prev[x].Red + r;
+            cur[x].Green = prev[x].Green + g;
+            cur[x].Blue  = prev[x].Blue + b;
+        }
+    }
+    return true;
+}
+void ImageIntegral::Clear()
+{
+    this->sums.clear();
+    this->sums.shrink_to_fit();
+    this->width  = 0;
+    this->height = 0;
+}
+void ImageIntegral::AddRectangle(uint32 left, uint32 top, uint32 right, uint32 bottom, uint64* result) const
+{
+    const size_t stride = (size_t) this->width + 1;
+    const Sum& a        = this->sums[stride * bottom + right];
+    const Sum& b        = this->sums[stride * top + right];
+    const Sum& c        = this->sums[stride * bottom + left];
+    const Sum& d        = this->sums[stride * top + left];
+    result[0] += (uint32) (a.Red - b.Red - c.Red + d.Red);
+    result[1] += (uint32) (a.Green - b.Green - c.Green + d.Green);
+    result[2] += (uint32) (a.Blue - b.Blue - c.Blue + d.Blue);
+}
+Pixel ImageIntegral::ComputeAverageColor(uint32 left, uint32 top, uint32 right, uint32 bottom) const
+{
+    right  = std::min<>(right, this->width);
+    bottom = std::min<>(bottom, this->height);
+    if ((left >= right) || (top >= bottom))
+        return Pixel(0U); // nothing to compute
+
+    uint64 sum[3]     = { 0, 0, 0 };
+    const uint64 area = ((uint64) (right - left)) * ((uint64) (bottom - top));
+    if (area <= MAX_EXACT_RECTANGLE_AREA)
+    {
+        AddRectangle(left, top, right, bottom, sum);
+    }
+    else
+    {
+        // very large rectangle --> split it in stripes that can be computed exactly
+        const uint32 columns = (uint32) std::min<uint64>(right - left, MAX_EXACT_RECTANGLE_AREA);
+        const uint32 lines   = (uint32) std::max<uint64>(MAX_EXACT_RECTANGLE_AREA / columns, 1);
+        for (uint32 y = top; y < bottom; y += std::min<>(lines, bottom - y))
+        {
+            for (uint32 x = left; x < right; x += std::min<>(columns, right - x))
+            {
+                AddRectangle(x, y, x + std::min<>(columns, right - x), y + std::min<>(lines, bottom - y), sum);
+            }
+        }
+    }
+    return Pixel((uint8) (sum[0] / area), (uint8) (sum[1] / area), (uint8) (sum[2] / area));
+}
+} // namespace AppCUI::Graphics
@@ -9,5 +9,6 @@ namespace Graphics
     bool LoadDIBToImage(Image& img, const uint8* buffer, uint32 size, bool isIcon);
     bool LoadBMPToImage(Image& img, const uint8* buffer, uint32 size);
     bool LoadPNGToImage(Image& img, const uint8* buffer, uint32 size);
+    bool LoadPNGToImage(Image& img, OS::DataObject& obj);
 } // namespace Graphics
 } // namespace AppCUI
@@ -1,48 +1,137 @@
 #include "ImageLoader.hpp"
 
-#include <lodepng.h>
+#include <png.h>
+#include <string.h>
 
 namespace AppCUI::Graphics
 {
-bool LoadPNGToImage(Image& img, const uint8* imageBuffer, uint32 size)
+constexpr uint32 PNG_FILE_READ_BUFFER_SIZE = 0x8000;
+
+struct PNGMemoryReader
 {
-    uint32 resultedWidth  = 0;
-    uint32 resultedHeight = 0;
-    uint8* temp           = nullptr;
+    const uint8* buffer;
+    size_t size;
+    size_t pos;
+};
+struct PNGFileReader
+{
+    OS::DataObject* obj;
+    uint32 pos;
+    uint32 size;
+    uint8 buffer[PNG_FILE_READ_BUFFER_SIZE];
+};
 
-    if (lodepng_decode_memory(
-              &temp, &resultedWidth, &resultedHeight, imageBuffer, size, LodePNGColorType::LCT_RGBA, 8) == 0)
+static void PNGError(png_structp png, png_const_charp message)
+{
+    LOG_ERROR("PNG decoder: %s", message);
+    png_longjmp(png, 1);
+}
+static void PNGWarning(png_structp, png_const_charp)
+{
+    // warnings are ignored (the default handler writes them to stderr)
+}
+static void PNGReadFromMemory(png_structp png, png_bytep data, png_size_t length)
+{
+    auto* r = reinterpret_cast<PNGMemoryReader*>(png_get_io_ptr(png));
+    if (length > r->size - r->pos)
+        png_error(png, "Unexpected end of PNG buffer");
+    memcpy(data, r->buffer + r->pos, length);
+    r->pos += length;
+}
+static void PNGReadFromFile(png_structp png, png_bytep data, png_size_t length)
+{
+    // libpng asks for very small pieces (chunk headers and CRCs) --> reads are buffered
+    auto* r = reinterpret_cast<PNGFileReader*>(png_get_io_ptr(png));
+    while (length > 0)
     {
-        if (temp != nullptr)
+        if (r->pos == r->size)
         {
-            CHECK(img.Create(resultedWidth, resultedHeight),
-                  false,
-                  "Fail to create a %ux%u size image",
-                  resultedWidth,
-                  resultedHeight);
-
-            // data is allocated with malloc --> so for the moment we need to copy it into a buffer allocated with
-            auto* p = img.GetPixelsBuffer();
-            auto e  = temp + ((size_t) resultedWidth * (size_t) resultedHeight) * sizeof(Pixel);
-            auto* c = temp;
-            while (c < e)
+            if (length >= PNG_FILE_READ_BUFFER_SIZE)
             {
-                p->Red   = *c++;
-                p->Green = *c++;
-                p->Blue  = *c++;
-                p->Alpha = *c++;
-                p++;
+                // large read --> straight into libpng buffer
+                const auto sz = (uint32) std::min<png_size_t>(length, 0x7FFFFFFF);
+                if (!r->obj->Read(data, sz))
+                    png_error(png, "Fail to read from PNG file");
+                data += sz;
+                length -= sz;
+                continue;
             }
-            free(temp);
-            return true;
+            uint32 bytesRead = 0;
+            if ((!r->obj->Read(r->buffer, PNG_FILE_READ_BUFFER_SIZE, bytesRead)) || (bytesRead == 0))
+                png_error(png, "Unexpected end of PNG file");
+            r->pos  = 0;
+            r->size = bytesRead;
         }
-        RETURNERROR(false, "No bytes were allocated when decoding PNG !");
+        const auto sz = (uint32) std::min<png_size_t>(length, r->size - r->pos);
+        memcpy(data, r->buffer + r->pos, sz);
+        r->pos += sz;
+        data += sz;
+        length -= sz;
+    }
+}
+
+// Decodes the PNG rows straight into the image pixels buffer. libpng converts every color type to 8 bits
+// BGRA (the native Pixel layout) while unfiltering each row, so there is no intermediate RGBA image and no
+// second pass to swap the color channels. Besides the image itself, only a couple of rows and the inflate
+// window are allocated.
+static bool DecodePNG(Image& img, png_rw_ptr readFunction, void* source)
+{
+    png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, PNGError, PNGWarning);
+    CHECK(png, false, "Fail to create a PNG decoder");
+    png_infop info = png_create_info_struct(png);
+    if (info == nullptr)
+    {
+        png_destroy_read_struct(&png, nullptr, nullptr);
+        RETURNERROR(false, "Fail to create PNG info structure");
+    }
+    // no object with a destructor must live in this function (png_error jumps back here)
+    if (setjmp(png_jmpbuf(png)))
+    {
+        png_destroy_read_struct(&png, &info, nullptr);
+        RETURNERROR(false, "Fail to decode PNG image !");
     }
-    else
+    png_set_read_fn(png, source, readFunction);
+    png_read_info(png, info);
+
+    png_set_expand(png);    // palette --> RGB, gray with less than 8 bits --> 8 bits, tRNS chunk --> alpha channel
+    png_set_strip_16(png);  // 16 bits per channel --> 8 bits (the most significant byte is kept)
+    png_set_gray_to_rgb(png);
+    png_set_add_alpha(png, 0xFF, PNG_FILLER_AFTER); // only for color types without alpha
+    png_set_bgr(png);
+    const auto passes = png_set_interlace_handling(png);
+    png_read_update_info(png, info);
+
+    const uint32 w = png_get_image_width(png, info);
+    const uint32 h = png_get_image_height(png, info);
+    if (png_get_rowbytes(png, info) != ((size_t) w) * sizeof(Pixel))
+        png_error(png, "Unexpected row size after color conversion");
+    if (((uint64) w) * ((uint64) h) > 0xFFFFFFFFULL)
+        png_error(png, "Image is too large");
+    if (!img.Create(w, h))
+        png_error(png, "Fail to create image");
+
+    // interlaced images: every pass updates (in place) the rows that were already decoded
+    auto* pixels = img.GetPixelsBuffer();
+    for (int pass = 0; pass < passes; pass++)
     {
-        if (temp)
-            free(temp);
-        RETURNERROR(false, "Fail to decode PNG buffer !");
+        for (uint32 y = 0; y < h; y++)
+            png_read_row(png, reinterpret_cast<png_bytep>(pixels + ((size_t) y) * w), nullptr);
     }
+    png_read_end(png, nullptr);
+    png_destroy_read_struct(&png, &info, nullptr);
+    return true;
+}
+
+bool LoadPNGToImage(Image& img, const uint8* imageBuffer, uint32 size)
+{
+    PNGMemoryReader reader{ imageBuffer, size, 0 };
+    return DecodePNG(img, PNGReadFromMemory, &reader);
+}
+bool LoadPNGToImage(Image& img, OS::DataObject& obj)
+{
+    auto reader = std::make_unique<PNGFileReader>();
+    reader->obj = &obj;
+    reader->pos = reader->size = 0;
+    return DecodePNG(img, PNGReadFromFile, reader.get());
 }
 } // namespace AppCUI::Graphics
@@ -1,4 +1,14 @@
 #include "Internal.hpp"
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#    include <emmintrin.h>
+#    define APPCUI_CELL_KERNELS_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define APPCUI_CELL_KERNELS_NEON
+#endif
 
 namespace AppCUI::Graphics
 {
@@ -99,6 +109,154 @@ LineTypeChars* LineSpecialChars = nullptr;
 #define NO_TRANSPARENCY(color)                                                                                         \
     ((color.Foreground != Graphics::Color::Transparent) && (color.Background != Graphics::Color::Transparent))
 
+// Cell kernels
+// A Character is 4 bytes wide (Code + Foreground + Background) and can be processed as an uint32 lane (PackedValue).
+// Opaque fills broadcast one 4-byte pattern, while transparent fills/copies use a per-lane mask that selects which
+// bytes (code, foreground or background) come from the new value and which ones are kept from the destination.
+namespace CellKernels
+{
+    inline uint32 MakeMask(bool code, bool foreground, bool background)
+    {
+        Character m;
+        m.PackedValue      = 0;
+        m.Code             = code ? 0xFFFF : 0;
+        m.Color.Foreground = static_cast<Color>(foreground ? 0xFF : 0);
+        m.Color.Background = static_cast<Color>(background ? 0xFF : 0);
+        return m.PackedValue;
+    }
+    inline uint32 MakeValue(int charCode, ColorPair color)
+    {
+        Character v;
+        v.Code  = charCode >= 0 ? (char16) charCode : 0;
+        v.Color = color;
+        return v.PackedValue;
+    }
+    // mask of the bytes that SET_CHARACTER_EX would write for (charCode, color)
+    inline uint32 MakeWriteMask(int charCode, ColorPair color)
+    {
+        return MakeMask(
+              charCode >= 0,
+              color.Foreground != Graphics::Color::Transparent,
+              color.Background != Graphics::Color::Transparent);
+    }
+    // d[i] = value
+    inline void Fill(Character* d, size_t count, uint32 value)
+    {
+#if defined(APPCUI_CELL_KERNELS_SSE2)
+        const __m128i v = _mm_set1_epi32((int) value);
+        for (; count >= 8; count -= 8, d += 8)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(d), v);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(d + 4), v);
+        }
+        if (count >= 4)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(d), v);
+            d += 4;
+            count -= 4;
+        }
+#elif defined(APPCUI_CELL_KERNELS_NEON)
+        const uint32x4_t v = vdupq_n_u32(value);
+        for (; count >= 4; count -= 4, d += 4)
+            vst1q_u32(reinterpret_cast<uint32_t*>(d), v);
+#endif
+        for (; count > 0; count--, d++)
+            d->PackedValue = value;
+    }
+    // d[i] = (d[i] & ~mask) | (value & mask)
+    inline void Blend(Character* d, size_t count, uint32 value, uint32 mask)
+    {
+        value &= mask;
+#if defined(APPCUI_CELL_KERNELS_SSE2)
+        const __m128i v = _mm_set1_epi32((int) value);
+        const __m128i m = _mm_set1_epi32((int) mask);
+        for (; count >= 4; count -= 4, d += 4)
+        {
+            auto p = reinterpret_cast<__m128i*>(d);
+            _mm_storeu_si128(p, _mm_or_si128(_mm_andnot_si128(m, _mm_loadu_si128(p)), v));
+        }
+#elif defined(APPCUI_CELL_KERNELS_NEON)
+        const uint32x4_t v = vdupq_n_u32(value);
+        const uint32x4_t m = vdupq_n_u32(mask);
+        for (; count >= 4; count -= 4, d += 4)
+        {
+            auto p = reinterpret_cast<uint32_t*>(d);
+            vst1q_u32(p, vorrq_u32(vbicq_u32(vld1q_u32(p), m), v));
+        }
+#endif
+        for (; count > 0; count--, d++)
+            d->PackedValue = (d->PackedValue & (~mask)) | value;
+    }
+    // d[i] = (d[i] & ~(srcMask | valueMask)) | (s[i] & srcMask) | (value & valueMask)
+    inline void CopyBlend(
+          Character* d, const Character* s, size_t count, uint32 srcMask, uint32 value, uint32 valueMask)
+    {
+        const uint32 keep = ~(srcMask | valueMask);
+        value &= valueMask;
+#if defined(APPCUI_CELL_KERNELS_SSE2)
+        const __m128i v  = _mm_set1_epi32((int) value);
+        const __m128i sm = _mm_set1_epi32((int) srcMask);
+        const __m128i km = _mm_set1_epi32((int) keep);
+        for (; count >= 4; count -= 4, d += 4, s += 4)
+        {
+            auto p          = reinterpret_cast<__m128i*>(d);
+            const __m128i r = _mm_or_si128(
+                  _mm_and_si128(_mm_loadu_si128(p), km),
+                  _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s)), sm));
+            _mm_storeu_si128(p, _mm_or_si128(r, v));
+        }
+#elif defined(APPCUI_CELL_KERNELS_NEON)
+        const uint32x4_t v  = vdupq_n_u32(value);
+        const uint32x4_t sm = vdupq_n_u32(srcMask);
+        const uint32x4_t km = vdupq_n_u32(keep);
+        for (; count >= 4; count -= 4, d += 4, s += 4)
+        {
+            auto p             = reinterpret_cast<uint32_t*>(d);
+            const uint32x4_t r = vorrq_u32(
+                  vandq_u32(vld1q_u32(p), km), vandq_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(s)), sm));
+            vst1q_u32(p, vorrq_u32(r, v));
+        }
+#endif
+        for (; count > 0; count--, d++, s++)
+            d->PackedValue = (d->PackedValue & keep) | (s->PackedValue & srcMask) | value;
+    }
+    // copies s over d, except for the foreground/background bytes of s that are Color::Transparent
+    inline void CopyTransparent(Character* d, const Character* s, size_t count)
+    {
+#if defined(APPCUI_CELL_KERNELS_SSE2) || defined(APPCUI_CELL_KERNELS_NEON)
+        const uint32 colorMask   = MakeMask(false, true, true);
+        const uint32 transparent = MakeValue(0, ColorPair{ Color::Transparent, Color::Transparent });
+#endif
+#if defined(APPCUI_CELL_KERNELS_SSE2)
+        const __m128i cm = _mm_set1_epi32((int) colorMask);
+        const __m128i tr = _mm_set1_epi32((int) transparent);
+        for (; count >= 4; count -= 4, d += 4, s += 4)
+        {
+            auto p           = reinterpret_cast<__m128i*>(d);
+            const __m128i sv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+            // 0xFF for every color byte of the source that is transparent (those bytes are kept from destination)
+            const __m128i keep = _mm_and_si128(_mm_cmpeq_epi8(sv, tr), cm);
+            _mm_storeu_si128(p, _mm_or_si128(_mm_and_si128(keep, _mm_loadu_si128(p)), _mm_andnot_si128(keep, sv)));
+        }
+#elif defined(APPCUI_CELL_KERNELS_NEON)
+        const uint32x4_t cm = vdupq_n_u32(colorMask);
+        const uint8x16_t tr = vreinterpretq_u8_u32(vdupq_n_u32(transparent));
+        for (; count >= 4; count -= 4, d += 4, s += 4)
+        {
+            auto p              = reinterpret_cast<uint32_t*>(d);
+            const uint32x4_t sv = vld1q_u32(reinterpret_cast<const uint32_t*>(s));
+            const uint32x4_t keep =
+                  vandq_u32(vreinterpretq_u32_u8(vceqq_u8(vreinterpretq_u8_u32(sv), tr)), cm);
+            vst1q_u32(p, vbslq_u32(keep, vld1q_u32(p), sv));
+        }
+#endif
+        for (; count > 0; count--, d++, s++)
+        {
+            SET_CHARACTER_EX(d, s->Code, s->Color);
+        }
+    }
+} // namespace CellKernels
+
 using namespace Graphics;
 
 #define TRANSLATE_X_COORDONATE(x) x += this->TranslateX;
@@ -176,35 +334,24 @@ inline void RenderSingleLineString<CharacterView>(
       const CharacterView& text, DrawTextInfo& dti, const WriteTextParams& params)
 {
     const Character* ch = text.data() + dti.TextStart;
-    if ((params.Flags & WriteTextFlags::OverwriteColors) != WriteTextFlags::None)
+    if (dti.Start < dti.End)
     {
-        if (NO_TRANSPARENCY(params.Color))
+        const size_t count = dti.End - dti.Start;
+        if ((params.Flags & WriteTextFlags::OverwriteColors) != WriteTextFlags::None)
         {
-            while (dti.Start < dti.End)
-            {
-                SET_CHARACTER(dti.Start, ch->Code, params.Color);
-                dti.Start++;
-                ch++;
-            }
+            CellKernels::CopyBlend(
+                  dti.Start,
+                  ch,
+                  count,
+                  CellKernels::MakeMask(true, false, false),
+                  CellKernels::MakeValue(0, params.Color),
+                  CellKernels::MakeWriteMask(-1, params.Color));
         }
         else
         {
-            while (dti.Start < dti.End)
-            {
-                SET_CHARACTER_EX(dti.Start, ch->Code, params.Color);
-                dti.Start++;
-                ch++;
-            }
-        }
-    }
-    else
-    {
-        while (dti.Start < dti.End)
-        {
-            SET_CHARACTER_EX(dti.Start, ch->Code, ch->Color);
-            dti.Start++;
-            ch++;
+            CellKernels::CopyTransparent(dti.Start, ch, count);
         }
+        dti.Start = dti.End;
     }
     if (dti.HotKey)
     {
@@ -489,11 +636,7 @@ bool Renderer::_ClearEntireSurface(int character, ColorPair color)
     tmp.Code = 32;
     if ((character >= 0) && (character <= 0xFFFF))
         tmp.Code = (uint16) (character & 0xFFFF);
-    while (s < e)
-    {
-        s->PackedValue = tmp.PackedValue;
-        s++;
-    }
+    CellKernels::Fill(s, e - s, tmp.PackedValue);
     return true;
 }
 bool Renderer::Clear(int charCode, ColorPair color)
@@ -532,23 +675,13 @@ bool Renderer::FillHorizontalLine(int left, int y, int right, int charCode, Colo
         return false;
     Character* p = this->OffsetRows[y] + left;
     if ((charCode >= 0) && (NO_TRANSPARENCY(color)))
-    {
-        while (left <= right)
-        {
-            SET_CHARACTER(p, charCode, color);
-            left++;
-            p++;
-        }
-    }
+        CellKernels::Fill(p, (right - left) + 1, CellKernels::MakeValue(charCode, color));
     else
-    {
-        while (left <= right)
-        {
-            SET_CHARACTER_EX(p, charCode, color);
-            left++;
-            p++;
-        }
-    }
+        CellKernels::Blend(
+              p,
+              (right - left) + 1,
+              CellKernels::MakeValue(charCode, color),
+              CellKernels::MakeWriteMask(charCode, color));
     return true;
 }
 bool Renderer::FillHorizontalLineWithSpecialChar(int left, int y, int right, SpecialChars charID, ColorPair color)
@@ -632,30 +765,20 @@ bool Renderer::FillRect(int left, int top, int right, int bottom, int charCode,
 
     if ((left > right) || (top > bottom))
         return false;
-    Character* p;
-    Character** row = this->OffsetRows;
+    Character** row    = this->OffsetRows;
+    const size_t count = (right - left) + 1;
+    const uint32 value = CellKernels::MakeValue(charCode, color);
     row += top;
     if ((charCode >= 0) && (NO_TRANSPARENCY(color)))
     {
         for (int y = top; y <= bottom; y++, row++)
-        {
-            p = (*row) + left;
-            for (int x = left; x <= right; x++, p++)
-            {
-                SET_CHARACTER(p, charCode, color);
-            }
-        }
+            CellKernels::Fill((*row) + left, count, value);
     }
     else
     {
+        const uint32 mask = CellKernels::MakeWriteMask(charCode, color);
         for (int y = top; y <= bottom; y++, row++)
-        {
-            p = (*row) + left;
-            for (int x = left; x <= right; x++, p++)
-            {
-                SET_CHARACTER_EX(p, charCode, color);
-            }
-        }
+            CellKernels::Blend((*row) + left, count, value, mask);
     }
     return true;
 }
@@ -903,45 +1026,22 @@ bool Renderer::DrawCanvas(int x, int y, const Canvas& canvas, const ColorPair ov
     }
     else
     {
-        // write character by character, changing the color
-        if ((overwriteColor.Background != Color::Transparent) && (overwriteColor.Foreground != Color::Transparent))
-        {
-            while (canvas_height > 0)
-            {
-                Character* d = this->OffsetRows[y] + x;
-                Character* s = canvas.OffsetRows[canvas_top] + canvas_left;
-                uint32 count = canvas_width;
-                while (count)
-                {
-                    SET_CHARACTER(d, s->Code, overwriteColor);
-                    d++;
-                    s++;
-                    count--;
-                }
-                canvas_top++;
-                y++;
-                canvas_height--;
-            }
-        }
-        else
+        // copy the characters from the canvas and overwrite the colors (the transparent ones are kept)
+        const uint32 codeMask  = CellKernels::MakeMask(true, false, false);
+        const uint32 value     = CellKernels::MakeValue(0, overwriteColor);
+        const uint32 colorMask = CellKernels::MakeWriteMask(-1, overwriteColor);
+        while (canvas_height > 0)
         {
-            while (canvas_height > 0)
-            {
-                Character* d = this->OffsetRows[y] + x;
-                Character* s = canvas.OffsetRows[canvas_top] + canvas_left;
-                uint32 count = canvas_width;
-                while (count)
-                {
-                    SET_CHARACTER_EX(d, s->Code, overwriteColor);
-                    d++;
-                    s++;
-                    count--;
-                }
-
-                canvas_top++;
-                y++;
-                canvas_height--;
-            }
+            CellKernels::CopyBlend(
+                  this->OffsetRows[y] + x,
+                  canvas.OffsetRows[canvas_top] + canvas_left,
+                  canvas_width,
+                  codeMask,
+                  value,
+                  colorMask);
+            canvas_top++;
+            y++;
+            canvas_height--;
         }
     }
     return true;
@@ -1338,13 +1438,7 @@ bool Renderer::WriteSingleLineCharacterBuffer(int x, int y, CharacterView charVi
     }
     else
     {
-        auto p = this->OffsetRows[y] + x;
-        while (buf < end)
-        {
-            SET_CHARACTER_EX(p, buf->Code, buf->Color);
-            buf++;
-            p++;
-        }
+        CellKernels::CopyTransparent(this->OffsetRows[y] + x, buf, sz);
     }
 
     return true;
@@ -1490,80 +1584,462 @@ void PixelToGrayScaleCharacter(Pixel colorRGB, ColorPair& c, SpecialChars& ch)
     else
         ch = SpecialChars::Block100;
 }
-void Paint_SmallBlocks(Renderer& r, const Graphics::Image& img, int x, int y, uint32 rap)
+namespace ImageCells
 {
-    const auto w     = img.GetWidth();
-    const auto h     = img.GetHeight();
-    const auto xStep = rap;
-    const auto yStep = rap * 2;
-    int px           = 0;
-    ColorPair cp     = NoColorPair;
-    for (uint32 img_y = 0; img_y < h; img_y += yStep, y++)
-    {
-        px = x;
-        for (uint32 img_x = 0; img_x < w; img_x += xStep, px++)
-        {
-            if (rap == 1)
-                cp = { RGB_to_16Color(img.GetPixel(img_x, img_y)), RGB_to_16Color(img.GetPixel(img_x, img_y + 1)) };
-            else
-                cp = { RGB_to_16Color(img.ComputeSquareAverageColor(img_x, img_y, rap)),
-                       RGB_to_16Color(img.ComputeSquareAverageColor(img_x, img_y + rap, rap)) };
+    // below this size starting the threads costs more than it saves
+    constexpr uint32 MIN_PIXELS_FOR_WORKER_THREADS = 256 * 1024;
+    constexpr uint32 MIN_CELLS_FOR_WORKER_THREADS  = 8 * 1024;
+    constexpr uint32 MIN_CELL_ROWS_PER_THREAD      = 4;
+    constexpr uint32 MAX_WORKER_THREADS            = 16;
+    constexpr uint32 CACHE_ENTRIES                 = 4;
+    constexpr uint32 MAX_PACKED_LINES              = 8224; // 8224 * 255 < 2^21
+
+    struct Key
+    {
+        uint64 generation; // unique for an image and its pixels (see Image::GetGeneration)
+        uint32 width, height;
+        ImageRenderingMethod method;
+        uint32 rap;                     // 0 for an image stretched to cellsWidth x cellsHeight
+        uint32 cellsWidth, cellsHeight; // 0 for a fixed scale (rap)
+        const int* specialCharacters;
+
+        inline bool operator==(const Key& k) const
+        {
+            return (generation == k.generation) && (width == k.width) && (height == k.height) &&
+                   (method == k.method) && (rap == k.rap) && (cellsWidth == k.cellsWidth) &&
+                   (cellsHeight == k.cellsHeight) && (specialCharacters == k.specialCharacters);
+        }
+    };
+    struct Entry
+    {
+        Key key;
+        uint64 lastUse;
+        Canvas cells;
+    };
+    // DrawImage is called from the UI thread only --> no locking needed
+    Entry cache[CACHE_ENTRIES] = {};
+    uint64 useCounter          = 0;
+
+    // Every character is painted from one box of pixels (two boxes - upper and lower half - for small blocks).
+    // A box line of the image is [top, bottom) x [left, right) for every box of that line.
+    struct BoxLayout
+    {
+        std::vector<uint32> left, right;
+        std::vector<uint32> top, bottom;
+        uint32 cellsWidth, cellsHeight;
+    };
+    struct Source
+    {
+        const Image* image;            // boxes are averaged from the pixels of this image ...
+        const ImageIntegral* integral; // ... or from a summed-area table
+        uint32 width, height;
+    };
+
+    bool IsSupported(ImageRenderingMethod method)
+    {
+        switch (method)
+        {
+        case ImageRenderingMethod::PixelTo16ColorsSmallBlock:
+        case ImageRenderingMethod::PixelTo64ColorsLargeBlock:
+        case ImageRenderingMethod::GrayScale:
+            return true;
+        case ImageRenderingMethod::AsciiArt:
+            NOT_IMPLEMENTED(false);
+        default:
+            RETURNERROR(false, "Unknwon rendering method (%u) ", static_cast<uint32>(method));
+        }
+    }
+
+    // fixed scale --> every box has (rap x rap) pixels, the boxes on the right / bottom edge are clipped
+    void ComputeFixedLayout(BoxLayout& l, uint32 w, uint32 h, ImageRenderingMethod method, uint32 rap)
+    {
+        const auto boxesX = (w + rap - 1) / rap;
+        uint32 boxesY;
+        if (method == ImageRenderingMethod::PixelTo16ColorsSmallBlock)
+        {
+            l.cellsWidth  = boxesX;
+            l.cellsHeight = (h + rap * 2 - 1) / (rap * 2);
+            boxesY        = l.cellsHeight * 2;
+        }
+        else
+        {
+            l.cellsWidth  = boxesX * 2;
+            l.cellsHeight = (h + rap - 1) / rap;
+            boxesY        = l.cellsHeight;
+        }
+        l.left.resize(boxesX);
+        l.right.resize(boxesX);
+        for (uint32 tr = 0; tr < boxesX; tr++)
+        {
+            l.left[tr]  = tr * rap;
+            l.right[tr] = std::min<>(l.left[tr] + rap, w);
+        }
+        // the lower half of the last line of small blocks can be outside the image (painted black)
+        l.top.resize(boxesY);
+        l.bottom.resize(boxesY);
+        for (uint32 tr = 0; tr < boxesY; tr++)
+        {
+            l.top[tr]    = tr * rap;
+            l.bottom[tr] = std::min<>(l.top[tr] + rap, h);
+        }
+    }
+    // splits [0, size) in "count" consecutive intervals and keeps "n" of them, starting with interval "first"
+    // (when upscaling, consecutive intervals share the same pixel)
+    void SplitInterval(
+          uint32 size, uint32 count, uint32 first, uint32 n, std::vector<uint32>& start, std::vector<uint32>& end)
+    {
+        start.resize(n);
+        end.resize(n);
+        for (uint32 tr = 0; tr < n; tr++)
+        {
+            const uint64 idx = (uint64) first + tr;
+            start[tr]        = (uint32) ((idx * size) / count);
+            end[tr]          = std::max<>((uint32) (((idx + 1) * size) / count), start[tr] + 1);
+        }
+    }
+    // arbitrary scale --> the image is stretched over (cellsWidth x cellsHeight) characters, but only the boxes
+    // of the characters [column, column + regionWidth) x [row, row + regionHeight) are kept (for large blocks
+    // the column must be the first character of a box)
+    void ComputeStretchedLayout(
+          BoxLayout& l,
+          uint32 w,
+          uint32 h,
+          ImageRenderingMethod method,
+          uint32 cellsWidth,
+          uint32 cellsHeight,
+          uint32 column,
+          uint32 row,
+          uint32 regionWidth,
+          uint32 regionHeight)
+    {
+        l.cellsWidth  = regionWidth;
+        l.cellsHeight = regionHeight;
+        if (method == ImageRenderingMethod::PixelTo16ColorsSmallBlock)
+        {
+            SplitInterval(w, cellsWidth, column, regionWidth, l.left, l.right);
+            SplitInterval(h, cellsHeight * 2, row * 2, regionHeight * 2, l.top, l.bottom);
+        }
+        else
+        {
+            SplitInterval(w, (cellsWidth + 1) / 2, column / 2, (regionWidth + 1) / 2, l.left, l.right);
+            SplitInterval(h, cellsHeight, row, regionHeight, l.top, l.bottom);
+        }
+    }
+    void ComputeStretchedLayout(
+          BoxLayout& l, uint32 w, uint32 h, ImageRenderingMethod method, uint32 cellsWidth, uint32 cellsHeight)
+    {
+        ComputeStretchedLayout(l, w, h, method, cellsWidth, cellsHeight, 0, 0, cellsWidth, cellsHeight);
+    }
 
-            if (cp.Background == cp.Foreground)
+    // Averages one line of boxes (same result as Image::ComputeSquareAverageColor for every box).
+    // Without a summed-area table the image lines of the band are first summed per column, so that every pixel
+    // is read only once and sequentially ("sums" has room for one value per column and three per box).
+    void AverageBoxLine(const Source& src, const BoxLayout& l, uint32 top, uint32 bottom, uint64* sums, Pixel* result)
+    {
+        const auto boxes = (uint32) l.left.size();
+        bottom           = std::min<>(bottom, src.height);
+        if (top >= bottom)
+        {
+            for (uint32 tr = 0; tr < boxes; tr++)
+                result[tr] = Pixel(0U);
+            return;
+        }
+        if (src.integral)
+        {
+            for (uint32 tr = 0; tr < boxes; tr++)
+                result[tr] = src.integral->ComputeAverageColor(l.left[tr], top, l.right[tr], bottom);
+            return;
+        }
+        // the three channels of a column are added at once (21 bits per channel) --> at most MAX_PACKED_LINES
+        // lines can be added before the column sums are moved into the box sums
+        const auto w  = src.width;
+        auto* boxSums = sums + w;
+        memset(boxSums, 0, sizeof(uint64) * 3 * boxes);
+        for (uint32 chunkTop = top; chunkTop < bottom; chunkTop += MAX_PACKED_LINES)
+        {
+            const auto chunkBottom = std::min<>(chunkTop + MAX_PACKED_LINES, bottom);
+            memset(sums, 0, sizeof(uint64) * w);
+            for (uint32 y = chunkTop; y < chunkBottom; y++)
             {
-                if (cp.Background == Color::Black)
-                    r.WriteCharacter(px, y, ' ', cp);
-                else
-                    r.WriteSpecialCharacter(px, y, SpecialChars::Block100, cp);
+                const auto* p = src.image->GetPixelsBuffer() + (size_t) y * w;
+                for (uint32 x = 0; x < w; x++, p++)
+                {
+                    const uint64 v = p->ColorValue;
+                    sums[x] += ((v & 0xFF0000) << 26) | ((v & 0xFF00) << 13) | (v & 0xFF);
+                }
+            }
+            for (uint32 tr = 0; tr < boxes; tr++)
+            {
+                auto* b = boxSums + tr * 3;
+                for (uint32 x = l.left[tr]; x < l.right[tr]; x++)
+                {
+                    b[0] += sums[x] >> 42;
+                    b[1] += (sums[x] >> 21) & 0x1FFFFF;
+                    b[2] += sums[x] & 0x1FFFFF;
+                }
             }
-            else
-                r.WriteSpecialCharacter(px, y, SpecialChars::BlockUpperHalf, cp);
+        }
+        const auto lines = bottom - top;
+        for (uint32 tr = 0; tr < boxes; tr++)
+        {
+            const auto* b    = boxSums + tr * 3;
+            const auto count = (uint64) (l.right[tr] - l.left[tr]) * lines;
+            result[tr]       = Pixel((uint8) (b[0] / count), (uint8) (b[1] / count), (uint8) (b[2] / count));
         }
     }
-}
-void Paint_LargeBlocks(Renderer& r, const Graphics::Image& img, int x, int y, uint32 rap)
-{
-    const auto w    = img.GetWidth();
-    const auto h    = img.GetHeight();
-    int px          = 0;
-    ColorPair cp    = NoColorPair;
-    SpecialChars sc = SpecialChars::Block100;
-    for (uint32 img_y = 0; img_y < h; img_y += rap, y++)
-    {
-        px = x;
-        for (uint32 img_x = 0; img_x < w; img_x += rap, px += 2)
-        {
-            if (rap == 1)
-                PixelTo64Color(img.GetPixel(img_x, img_y), cp, sc);
-            else
-                PixelTo64Color(img.ComputeSquareAverageColor(img_x, img_y, rap), cp, sc);
 
-            // r.FillHorizontalLineWithSpecialChar(px, y, px + 1, sc, ColorPair{ cp, Color::Black });
-            r.FillHorizontalLineWithSpecialChar(px, y, px + 1, sc, cp);
+    // converts the cell rows [rowStart, rowEnd)
+    void ConvertRows(
+          const Source& src,
+          const BoxLayout& l,
+          ImageRenderingMethod method,
+          const int* specialChars,
+          Character* cells,
+          uint32 rowStart,
+          uint32 rowEnd)
+    {
+        const auto boxes = (uint32) l.left.size();
+        std::vector<uint64> sums(src.integral ? 0 : (size_t) src.width + (size_t) boxes * 3);
+        std::vector<Pixel> upper(boxes, Pixel(0U)), lower(boxes, Pixel(0U));
+        ColorPair cp    = NoColorPair;
+        SpecialChars sc = SpecialChars::Block100;
+
+        for (uint32 row = rowStart; row < rowEnd; row++)
+        {
+            Character* c = cells + (size_t) row * l.cellsWidth;
+            if (method == ImageRenderingMethod::PixelTo16ColorsSmallBlock)
+            {
+                AverageBoxLine(src, l, l.top[row * 2], l.bottom[row * 2], sums.data(), upper.data());
+                AverageBoxLine(src, l, l.top[row * 2 + 1], l.bottom[row * 2 + 1], sums.data(), lower.data());
+                for (uint32 tr = 0; tr < boxes; tr++, c++)
+                {
+                    cp       = { RGB_to_16Color(upper[tr]), RGB_to_16Color(lower[tr]) };
+                    c->Color = cp;
+                    if (cp.Background == cp.Foreground)
+                    {
+                        if (cp.Background == Color::Black)
+                            c->Code = ' ';
+                        else
+                            c->Code = specialChars[(uint32) SpecialChars::Block100];
+                    }
+                    else
+                        c->Code = specialChars[(uint32) SpecialChars::BlockUpperHalf];
+                }
+            }
+            else
+            {
+                AverageBoxLine(src, l, l.top[row], l.bottom[row], sums.data(), upper.data());
+                for (uint32 tr = 0; tr < boxes; tr++, c += 2)
+                {
+                    if (method == ImageRenderingMethod::GrayScale)
+                        PixelToGrayScaleCharacter(upper[tr], cp, sc);
+                    else
+                        PixelTo64Color(upper[tr], cp, sc);
+                    c[0].Code  = specialChars[(uint32) sc];
+                    c[0].Color = cp;
+                    // a stretched image can have an odd width --> the last box only has one character
+                    if ((tr * 2 + 1) < l.cellsWidth)
+                        c[1] = c[0];
+                }
+            }
         }
     }
-}
-void Paint_GrayScale(Renderer& r, const Graphics::Image& img, int x, int y, uint32 rap)
-{
-    const auto w    = img.GetWidth();
-    const auto h    = img.GetHeight();
-    int px          = 0;
-    ColorPair cp    = NoColorPair;
-    SpecialChars sc = SpecialChars::Block100;
-    for (uint32 img_y = 0; img_y < h; img_y += rap, y++)
-    {
-        px = x;
-        for (uint32 img_x = 0; img_x < w; img_x += rap, px += 2)
-        {
-            if (rap == 1)
-                PixelToGrayScaleCharacter(img.GetPixel(img_x, img_y), cp, sc);
-            else
-                PixelToGrayScaleCharacter(img.ComputeSquareAverageColor(img_x, img_y, rap), cp, sc);
 
-            // r.FillHorizontalLineWithSpecialChar(px, y, px + 1, sc, ColorPair{ cp, Color::Black });
-            r.FillHorizontalLineWithSpecialChar(px, y, px + 1, sc, cp);
+    // converts all cell rows - large images are split into bands of rows and every band is converted by a
+    // different thread
+    void Convert(
+          const Source& src, const BoxLayout& l, ImageRenderingMethod method, const int* specialChars, Character* cells)
+    {
+        const size_t pixels = src.integral ? 0 : (size_t) src.width * src.height;
+        uint32 threadsCount = 1;
+        if ((pixels >= MIN_PIXELS_FOR_WORKER_THREADS) ||
+            ((size_t) l.cellsWidth * l.cellsHeight >= MIN_CELLS_FOR_WORKER_THREADS))
+        {
+            threadsCount = std::min<>(std::max<>(std::thread::hardware_concurrency(), 1U), MAX_WORKER_THREADS);
+            threadsCount = std::max<>(std::min<>(threadsCount, l.cellsHeight / MIN_CELL_ROWS_PER_THREAD), 1U);
+        }
+        if (threadsCount == 1)
+        {
+            ConvertRows(src, l, method, specialChars, cells, 0, l.cellsHeight);
+            return;
+        }
+        std::vector<std::thread> workers;
+        workers.reserve(threadsCount - 1);
+        const auto rowsPerThread = (l.cellsHeight + threadsCount - 1) / threadsCount;
+        for (uint32 row = rowsPerThread; row < l.cellsHeight; row += rowsPerThread)
+        {
+            const auto rowEnd = std::min<>(row + rowsPerThread, l.cellsHeight);
+            workers.emplace_back(
+                  ConvertRows, std::cref(src), std::cref(l), method, specialChars, cells, row, rowEnd);
+        }
+        // the first band is converted on the current thread
+        ConvertRows(src, l, method, specialChars, cells, 0, std::min<>(rowsPerThread, l.cellsHeight));
+        for (auto& t : workers)
+            t.join();
+    }
+
+    // returns the cells of an image (cached - an image that is drawn again with the same method and scale
+    // is not converted again as long as its pixels were not modified)
+    const Canvas* GetCells(
+          const Image& img,
+          ImageRenderingMethod method,
+          uint32 rap,
+          uint32 cellsWidth,
+          uint32 cellsHeight,
+          const int* specialChars)
+    {
+        const auto w = img.GetWidth();
+        const auto h = img.GetHeight();
+        if ((w == 0) || (h == 0) || (img.GetPixelsBuffer() == nullptr))
+            return nullptr;
+
+        const Key key = { img.GetGeneration(), w, h, method, rap, cellsWidth, cellsHeight, specialChars };
+        useCounter++;
+        Entry* victim = &cache[0];
+        for (auto& e : cache)
+        {
+            if ((e.lastUse != 0) && (e.key == key))
+            {
+                e.lastUse = useCounter;
+                return &e.cells;
+            }
+            if (e.lastUse < victim->lastUse)
+                victim = &e;
         }
+
+        BoxLayout layout;
+        if (rap > 0)
+            ComputeFixedLayout(layout, w, h, method, rap);
+        else
+            ComputeStretchedLayout(layout, w, h, method, cellsWidth, cellsHeight);
+
+        victim->lastUse = 0; // not valid until the conversion is complete
+        victim->key     = key;
+        CHECK(victim->cells.Create(layout.cellsWidth, layout.cellsHeight),
+              nullptr,
+              "Fail to create a canvas of %ux%u characters",
+              layout.cellsWidth,
+              layout.cellsHeight);
+        Convert({ &img, nullptr, w, h }, layout, method, specialChars, victim->cells.GetCharactersBuffer());
+        victim->lastUse = useCounter;
+        return &victim->cells;
+    }
+
+    void WriteCells(Renderer& r, int x, int y, const Canvas& cells)
+    {
+        // row by row (and not DrawCanvas) so that the clip and translation of the renderer are always applied
+        auto* line = cells.GetCharactersBuffer();
+        for (uint32 tr = 0; tr < cells.GetHeight(); tr++, line += cells.GetWidth())
+            r.WriteSingleLineCharacterBuffer(x, y + (int) tr, CharacterView(line, cells.GetWidth()), true);
     }
+} // namespace ImageCells
+Size ComputeRenderingSize(uint32 imageWidth, uint32 imageHeight, ImageRenderingMethod method, double scale)
+{
+    CHECK(scale > 0, Size(), "Invalid scale (%f) - it should be bigger than 0", scale);
+    uint32 w = 0, h = 0;
+    switch (method)
+    {
+    case ImageRenderingMethod::PixelTo16ColorsSmallBlock:
+        w = (uint32) (imageWidth * scale);
+        h = (uint32) (imageHeight * scale / 2.0);
+        break;
+    case ImageRenderingMethod::PixelTo64ColorsLargeBlock:
+    case ImageRenderingMethod::GrayScale:
+        w = ((uint32) (imageWidth * scale)) * 2;
+        h = (uint32) (imageHeight * scale);
+        break;
+    case ImageRenderingMethod::AsciiArt:
+        NOT_IMPLEMENTED(Size());
+    default:
+        NOT_IMPLEMENTED(Size());
+    };
+    w = std::max<>(w, 1U);
+    h = std::max<>(h, 1U);
+    return Size(w, h);
+}
+bool DrawImage(
+      Renderer& renderer,
+      const ImageIntegral& integral,
+      int x,
+      int y,
+      uint32 width,
+      uint32 height,
+      uint32 column,
+      uint32 row,
+      uint32 visibleWidth,
+      uint32 visibleHeight,
+      ImageRenderingMethod method)
+{
+    CHECK(integral.IsValid(), false, "Summed-area table was not created !");
+    CHECK((width > 0) && (height > 0), false, "Invalid size (%ux%u)", width, height);
+    CHECK((visibleWidth > 0) && (visibleHeight > 0) && (column < width) && (row < height) &&
+                (visibleWidth <= width - column) && (visibleHeight <= height - row),
+          false,
+          "Invalid region (%u,%u - %ux%u) of an image drawn on %ux%u characters",
+          column,
+          row,
+          visibleWidth,
+          visibleHeight,
+          width,
+          height);
+    CHECK(ImageCells::IsSupported(method), false, "");
+
+    // two characters per box --> the region starts with the first character of a box
+    const uint32 shift = (method == ImageRenderingMethod::PixelTo16ColorsSmallBlock) ? 0 : (column & 1);
+
+    // no cache - the summed-area table is kept by controls that render the visible characters only once per
+    // scale change or scroll
+    ImageCells::BoxLayout layout;
+    Canvas cells;
+    ImageCells::ComputeStretchedLayout(
+          layout,
+          integral.GetWidth(),
+          integral.GetHeight(),
+          method,
+          width,
+          height,
+          column - shift,
+          row,
+          visibleWidth + shift,
+          visibleHeight);
+    CHECK(cells.Create(layout.cellsWidth, layout.cellsHeight),
+          false,
+          "Fail to create a canvas of %ux%u characters",
+          layout.cellsWidth,
+          layout.cellsHeight);
+    ImageCells::Convert(
+          { nullptr, &integral, integral.GetWidth(), integral.GetHeight() },
+          layout,
+          method,
+          SpecialCharacters,
+          cells.GetCharactersBuffer());
+    ImageCells::WriteCells(renderer, x - (int) shift, y, cells);
+    return true;
+}
+bool ConvertImageToCells(const Image& img, ImageRenderingMethod method, ImageScaleMethod scale, Canvas& cells)
+{
+    auto rap = static_cast<uint32>(scale);
+    CHECK((rap >= 1) && (rap <= 20), false, "Invalid scale enum value");
+    CHECK(ImageCells::IsSupported(method), false, "");
+    CHECK(img.GetPixelsBuffer(), false, "Image was not instantiated yet (have you called Create methods ?)");
+
+    ImageCells::BoxLayout layout;
+    ImageCells::ComputeFixedLayout(layout, img.GetWidth(), img.GetHeight(), method, rap);
+    if ((cells.GetWidth() != layout.cellsWidth) || (cells.GetHeight() != layout.cellsHeight))
+    {
+        CHECK(cells.Resize(layout.cellsWidth, layout.cellsHeight),
+              false,
+              "Fail to create a canvas of %ux%u characters",
+              layout.cellsWidth,
+              layout.cellsHeight);
+    }
+    ImageCells::Convert(
+          { &img, nullptr, img.GetWidth(), img.GetHeight() },
+          layout,
+          method,
+          SpecialCharacters,
+          cells.GetCharactersBuffer());
+    return true;
 }
 Size Renderer::ComputeRenderingSize(const Image& img, ImageRenderingMethod method, ImageScaleMethod scale)
 {
@@ -1594,28 +2070,29 @@ Size Renderer::ComputeRenderingSize(const Image& img, ImageRenderingMethod metho
     h = std::max<>(h, 1U);
     return Size(w, h);
 }
+Size Renderer::ComputeRenderingSize(const Image& img, ImageRenderingMethod method, double scale)
+{
+    return Graphics::ComputeRenderingSize(img.GetWidth(), img.GetHeight(), method, scale);
+}
 bool Renderer::DrawImage(const Image& img, int x, int y, ImageRenderingMethod method, ImageScaleMethod scale)
 {
     auto rap = static_cast<uint32>(scale);
     // sanity check
     CHECK((rap >= 1) && (rap <= 20), false, "Invalid scale enum value");
+    CHECK(ImageCells::IsSupported(method), false, "");
 
-    switch (method)
-    {
-    case ImageRenderingMethod::PixelTo16ColorsSmallBlock:
-        Paint_SmallBlocks(*this, img, x, y, rap);
-        return true;
-    case ImageRenderingMethod::PixelTo64ColorsLargeBlock:
-        Paint_LargeBlocks(*this, img, x, y, rap);
-        return true;
-    case ImageRenderingMethod::GrayScale:
-        Paint_GrayScale(*this, img, x, y, rap);
-        return true;
-    case ImageRenderingMethod::AsciiArt:
-        NOT_IMPLEMENTED(false);
-    default:
-        RETURNERROR(false, "Unknwon rendering method (%u) ", static_cast<uint32>(method));
-    }
+    if (auto cells = ImageCells::GetCells(img, method, rap, 0, 0, SpecialCharacters); cells)
+        ImageCells::WriteCells(*this, x, y, *cells);
+    return true;
+}
+bool Renderer::DrawImage(const Image& img, int x, int y, uint32 width, uint32 height, ImageRenderingMethod method)
+{
+    CHECK((width > 0) && (height > 0), false, "Invalid size (%ux%u)", width, height);
+    CHECK(ImageCells::IsSupported(method), false, "");
+
+    if (auto cells = ImageCells::GetCells(img, method, 0, width, height, SpecialCharacters); cells)
+        ImageCells::WriteCells(*this, x, y, *cells);
+    return true;
 }
 } // namespace AppCUI::Graphics
 
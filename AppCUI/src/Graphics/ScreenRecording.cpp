@@ -0,0 +1,199 @@
+#include "Internal.hpp"
+
+namespace AppCUI::Graphics
+{
+using namespace Internal::CellStream;
+
+constexpr uint32 INVALID_FRAME = 0xFFFFFFFF;
+
+struct ScreenRecordingContext
+{
+    struct Frame
+    {
+        uint64 offset;   // position of the encoded characters in the file
+        uint32 keyFrame; // index of the key frame the decoding has to start from
+        FrameHeader header;
+    };
+    OS::File file;
+    std::vector<Frame> frames;
+    std::vector<uint8> data;
+    std::vector<uint32> cells; // characters of the last decoded frame
+    uint32 decodedFrame;
+
+    ScreenRecordingContext() : decodedFrame(INVALID_FRAME)
+    {
+    }
+    bool ReadOperation(size_t& pos, uint32& type, uint64& count)
+    {
+        uint64 value = 0;
+        for (uint32 shift = 0; shift < 64; shift += 7)
+        {
+            CHECK(pos < this->data.size(), false, "Truncated operation");
+            const auto b = this->data[pos++];
+            value |= ((uint64) (b & 0x7F)) << shift;
+            if ((b & 0x80) == 0)
+            {
+                type  = (uint32) (value & 3);
+                count = value >> 2;
+                return true;
+            }
+        }
+        RETURNERROR(false, "Invalid operation encoding");
+    }
+    bool Decode(uint32 index)
+    {
+        const auto& f    = this->frames[index];
+        const auto count = (size_t) f.header.width * f.header.height;
+        const auto isKey = f.header.type == KEY_FRAME;
+        uint32 bytesRead = 0;
+        if (isKey)
+            this->cells.resize(count);
+        CHECK(this->cells.size() == count, false, "Delta frame %u has a different size than the previous one", index);
+        this->data.resize(f.header.size);
+        CHECK(this->file.Read(f.offset, this->data.data(), f.header.size, bytesRead),
+              false,
+              "Fail to read frame %u",
+              index);
+        CHECK(bytesRead == f.header.size, false, "Frame %u is truncated", index);
+
+        auto* c    = this->cells.data();
+        size_t i   = 0;
+        size_t pos = 0;
+        uint32 type;
+        uint64 cnt;
+        while (pos < this->data.size())
+        {
+            CHECK(ReadOperation(pos, type, cnt), false, "");
+            CHECK((cnt > 0) && (cnt <= count - i), false, "Operation outside the frame (%u)", index);
+            switch (type)
+            {
+            case OP_SKIP:
+                CHECK(!isKey, false, "Key frames can not skip characters (%u)", index);
+                break;
+            case OP_RUN:
+                CHECK(pos + sizeof(uint32) <= this->data.size(), false, "Truncated run (%u)", index);
+                uint32 value;
+                memcpy(&value, this->data.data() + pos, sizeof(uint32));
+                pos += sizeof(uint32);
+                std::fill(c + i, c + i + cnt, value);
+                break;
+            case OP_LITERAL:
+                CHECK(pos + cnt * sizeof(uint32) <= this->data.size(), false, "Truncated literal (%u)", index);
+                memcpy(c + i, this->data.data() + pos, cnt * sizeof(uint32));
+                pos += cnt * sizeof(uint32);
+                break;
+            default:
+                RETURNERROR(false, "Unknown operation: %u (frame %u)", type, index);
+            }
+            i += cnt;
+        }
+        CHECK((i == count) || (!isKey), false, "Key frame %u does not contain all characters", index);
+        return true;
+    }
+};
+
+ScreenRecording::ScreenRecording() : context(new ScreenRecordingContext())
+{
+}
+ScreenRecording::~ScreenRecording()
+{
+    delete reinterpret_cast<ScreenRecordingContext*>(this->context);
+    this->context = nullptr;
+}
+bool ScreenRecording::Open(const std::filesystem::path& path)
+{
+    auto Members = reinterpret_cast<ScreenRecordingContext*>(this->context);
+    Close();
+    CHECK(Members->file.OpenRead(path), false, "Fail to open: %s", path.string().c_str());
+    FileHeader fileHeader;
+    CHECK(Members->file.Read(fileHeader), false, "Fail to read the header of: %s", path.string().c_str());
+    CHECK(fileHeader.magic == FILE_MAGIC, false, "Not a screen recording: %s", path.string().c_str());
+    CHECK(fileHeader.version == FORMAT_VERSION, false, "Unsupported recording version: %u", fileHeader.version);
+
+    // only the frame headers are read - the characters are decoded when a frame is drawn
+    const auto size = Members->file.GetSize();
+    uint64 offset   = sizeof(FileHeader);
+    uint32 keyFrame = INVALID_FRAME;
+    ScreenRecordingContext::Frame f;
+    while (offset + sizeof(FrameHeader) <= size)
+    {
+        uint32 bytesRead = 0;
+        CHECK(Members->file.Read(offset, &f.header, sizeof(FrameHeader), bytesRead), false, "Fail to read frame");
+        offset += sizeof(FrameHeader);
+        if ((bytesRead != sizeof(FrameHeader)) || (offset + f.header.size > size))
+            break; // the recording was interrupted while this frame was written
+        if (f.header.type == KEY_FRAME)
+            keyFrame = (uint32) Members->frames.size();
+        else
+        {
+            CHECK(f.header.type == DELTA_FRAME, false, "Invalid frame type: %u", f.header.type);
+            CHECK(keyFrame != INVALID_FRAME, false, "Recording does not start with a key frame");
+        }
+        f.offset   = offset;
+        f.keyFrame = keyFrame;
+        Members->frames.push_back(f);
+        offset += f.header.size;
+    }
+    CHECK(Members->frames.size() > 0, false, "Recording has no frames: %s", path.string().c_str());
+    return true;
+}
+void ScreenRecording::Close()
+{
+    auto Members = reinterpret_cast<ScreenRecordingContext*>(this->context);
+    Members->file.Close();
+    Members->frames.clear();
+    Members->cells.clear();
+    Members->decodedFrame = INVALID_FRAME;
+}
+uint32 ScreenRecording::GetFramesCount()
+{
+    return (uint32) reinterpret_cast<ScreenRecordingContext*>(this->context)->frames.size();
+}
+uint64 ScreenRecording::GetFrameTime(uint32 index)
+{
+    auto Members = reinterpret_cast<ScreenRecordingContext*>(this->context);
+    CHECK(index < Members->frames.size(), 0, "Invalid frame index: %u", index);
+    return Members->frames[index].header.time;
+}
+uint32 ScreenRecording::FindFrame(uint64 time)
+{
+    auto Members = reinterpret_cast<ScreenRecordingContext*>(this->context);
+    auto it      = std::upper_bound(
+          Members->frames.begin(),
+          Members->frames.end(),
+          time,
+          [](uint64 value, const ScreenRecordingContext::Frame& f) { return value < f.header.time; });
+    if (it == Members->frames.begin())
+        return 0;
+    return (uint32) (it - Members->frames.begin() - 1);
+}
+bool ScreenRecording::DrawFrame(uint32 index, Canvas& frame)
+{
+    auto Members = reinterpret_cast<ScreenRecordingContext*>(this->context);
+    CHECK(index < Members->frames.size(), false, "Invalid frame index: %u", index);
+
+    // sequential playback continues from the last decoded frame, otherwise decoding starts from a key frame
+    const auto& f = Members->frames[index];
+    auto from     = f.keyFrame;
+    if ((Members->decodedFrame != INVALID_FRAME) && (Members->decodedFrame <= index) &&
+        (Members->decodedFrame >= f.keyFrame))
+        from = Members->decodedFrame + 1;
+    for (auto tr = from; tr <= index; tr++)
+    {
+        if (!Members->Decode(tr))
+        {
+            Members->decodedFrame = INVALID_FRAME;
+            RETURNERROR(false, "Fail to decode frame %u", tr);
+        }
+        Members->decodedFrame = tr;
+    }
+
+    CHECK(frame.Resize(f.header.width, f.header.height), false, "Fail to resize canvas");
+    memcpy(frame.GetCharactersBuffer(), Members->cells.data(), Members->cells.size() * sizeof(uint32));
+    if (f.header.cursorVisible)
+        frame.SetCursor(f.header.cursorX, f.header.cursorY);
+    else
+        frame.HideCursor();
+    return true;
+}
+} // namespace AppCUI::Graphics
@@ -0,0 +1,266 @@
+#include "Internal.hpp"
+#include <unordered_map>
+
+namespace AppCUI::Graphics
+{
+constexpr uint32 TILE_PIXELS      = TiledImage::TILE_SIZE * TiledImage::TILE_SIZE;
+constexpr uint64 TILE_BYTES       = TILE_PIXELS * sizeof(Pixel);
+constexpr uint32 MIN_CACHED_TILES = 4;
+constexpr uint32 MAX_LEVEL        = 31;
+
+// images that were already decoded in memory
+class ImageTileSource : public TileSource
+{
+    Image img;
+
+  public:
+    ImageTileSource(Image&& image) : img(std::move(image))
+    {
+        this->width  = img.GetWidth();
+        this->height = img.GetHeight();
+    }
+    void ReadPixels(uint32 x, uint32 y, uint32 count, uint32 lines, uint32 step, Pixel* output, uint32 stride) override
+    {
+        for (uint32 j = 0; j < lines; j++, output += stride)
+        {
+            const auto* p = img.GetPixelsBuffer() + ((size_t) y + (size_t) j * step) * this->width + x;
+            if (step == 1)
+                memcpy(output, p, sizeof(Pixel) * count);
+            else
+            {
+                for (uint32 i = 0; i < count; i++, p += step)
+                    output[i] = *p;
+            }
+        }
+    }
+};
+
+struct TiledImageContext
+{
+    struct Tile
+    {
+        uint64 key;
+        uint32 prev, next; // LRU links (slot 0 is never used, so it doubles as the "null" link)
+        std::unique_ptr<Pixel[]> pixels;
+    };
+    std::unique_ptr<TileSource> source;
+    std::vector<Tile> tiles;
+    std::unordered_map<uint64, uint32> index; // level/tile position --> slot in tiles
+    uint32 maxTiles;
+    uint32 lruHead, lruTail;
+
+    TiledImageContext() : maxTiles((uint32) (TiledImage::DEFAULT_MEMORY_BUDGET / TILE_BYTES)), lruHead(0), lruTail(0)
+    {
+        ClearCache();
+    }
+    void ClearCache()
+    {
+        this->tiles.clear();
+        this->tiles.emplace_back();
+        this->index.clear();
+        this->lruHead = 0;
+        this->lruTail = 0;
+    }
+    void Unlink(uint32 slot)
+    {
+        const auto prev = tiles[slot].prev;
+        const auto next = tiles[slot].next;
+        if (prev)
+            tiles[prev].next = next;
+        else
+            lruHead = next;
+        if (next)
+            tiles[next].prev = prev;
+        else
+            lruTail = prev;
+    }
+    void PushFront(uint32 slot)
+    {
+        tiles[slot].prev = 0;
+        tiles[slot].next = lruHead;
+        if (lruHead)
+            tiles[lruHead].prev = slot;
+        lruHead = slot;
+        if (lruTail == 0)
+            lruTail = slot;
+    }
+    static inline uint32 GetLevelSize(uint32 size, uint32 level)
+    {
+        return (uint32) ((((uint64) size) + (1ULL << level) - 1) >> level);
+    }
+    const Pixel* GetTile(uint32 level, uint32 tileX, uint32 tileY);
+};
+
+const Pixel* TiledImageContext::GetTile(uint32 level, uint32 tileX, uint32 tileY)
+{
+    const uint64 key = (((uint64) level) << 48) | (((uint64) tileY) << 24) | ((uint64) tileX);
+    auto it          = this->index.find(key);
+    if (it != this->index.end())
+    {
+        Unlink(it->second);
+        PushFront(it->second);
+        return tiles[it->second].pixels.get();
+    }
+
+    uint32 slot;
+    if (this->tiles.size() <= this->maxTiles)
+    {
+        slot = (uint32) this->tiles.size();
+        this->tiles.emplace_back();
+        this->tiles[slot].pixels = std::make_unique<Pixel[]>(TILE_PIXELS);
+    }
+    else
+    {
+        // the least recently used tile is reused
+        slot = this->lruTail;
+        Unlink(slot);
+        this->index.erase(this->tiles[slot].key);
+    }
+    this->tiles[slot].key = key;
+    this->index[key]      = slot;
+    PushFront(slot);
+
+    const auto x     = tileX * TiledImage::TILE_SIZE;
+    const auto y     = tileY * TiledImage::TILE_SIZE;
+    const auto count = std::min<>(TiledImage::TILE_SIZE, GetLevelSize(source->GetWidth(), level) - x);
+    const auto lines = std::min<>(TiledImage::TILE_SIZE, GetLevelSize(source->GetHeight(), level) - y);
+    this->source->ReadPixels(
+          x << level, y << level, count, lines, 1U << level, this->tiles[slot].pixels.get(), TiledImage::TILE_SIZE);
+    return this->tiles[slot].pixels.get();
+}
+
+static TiledImageContext* GetContext(void*& context)
+{
+    // a moved image has no context (it is created again the first time it is needed)
+    if (context == nullptr)
+        context = new TiledImageContext();
+    return reinterpret_cast<TiledImageContext*>(context);
+}
+
+TiledImage::TiledImage() : context(new TiledImageContext())
+{
+}
+TiledImage::TiledImage(TiledImage&& img) noexcept : context(img.context)
+{
+    img.context = nullptr;
+}
+TiledImage::~TiledImage()
+{
+    delete reinterpret_cast<TiledImageContext*>(this->context);
+    this->context = nullptr;
+}
+TiledImage& TiledImage::operator=(TiledImage&& img) noexcept
+{
+    std::swap(this->context, img.context);
+    return *this;
+}
+bool TiledImage::Load(const std::filesystem::path& imageFilePath)
+{
+    auto Members = GetContext(this->context);
+    Close();
+    auto source = CreateBitmapTileSource(imageFilePath);
+    if (!source)
+    {
+        Image img;
+        CHECK(img.Load(imageFilePath), false, "Fail to load image: %s", imageFilePath.string().c_str());
+        source = std::make_unique<ImageTileSource>(std::move(img));
+    }
+    Members->source = std::move(source);
+    return true;
+}
+bool TiledImage::Create(Image&& img)
+{
+    auto Members = GetContext(this->context);
+    CHECK(img.GetPixelsBuffer(), false, "Image was not instantiated yet (have you called Create methods ?)");
+    Close();
+    Members->source = std::make_unique<ImageTileSource>(std::move(img));
+    return true;
+}
+void TiledImage::Close()
+{
+    if (this->context == nullptr)
+        return;
+    auto Members = reinterpret_cast<TiledImageContext*>(this->context);
+    Members->ClearCache();
+    Members->source.reset();
+}
+bool TiledImage::SetMemoryBudget(uint64 bytes)
+{
+    auto Members = GetContext(this->context);
+    CHECK(bytes >= TILE_BYTES * MIN_CACHED_TILES,
+          false,
+          "Memory budget should be at least %llu bytes (%u tiles)",
+          (unsigned long long) (TILE_BYTES * MIN_CACHED_TILES),
+          MIN_CACHED_TILES);
+    Members->maxTiles = (uint32) std::min<uint64>(bytes / TILE_BYTES, 0xFFFFFFF);
+    if (Members->tiles.size() - 1 > Members->maxTiles)
+        Members->ClearCache();
+    return true;
+}
+uint64 TiledImage::GetMemoryUsage() const
+{
+    if (this->context == nullptr)
+        return 0;
+    return (reinterpret_cast<const TiledImageContext*>(this->context)->tiles.size() - 1) * TILE_BYTES;
+}
+uint32 TiledImage::GetWidth() const
+{
+    return IsValid() ? reinterpret_cast<const TiledImageContext*>(this->context)->source->GetWidth() : 0;
+}
+uint32 TiledImage::GetHeight() const
+{
+    return IsValid() ? reinterpret_cast<const TiledImageContext*>(this->context)->source->GetHeight() : 0;
+}
+uint32 TiledImage::GetLevelWidth(uint32 level) const
+{
+    CHECK(level <= MAX_LEVEL, 0, "Invalid level (%u) - it should be at most %u", level, MAX_LEVEL);
+    return TiledImageContext::GetLevelSize(GetWidth(), level);
+}
+uint32 TiledImage::GetLevelHeight(uint32 level) const
+{
+    CHECK(level <= MAX_LEVEL, 0, "Invalid level (%u) - it should be at most %u", level, MAX_LEVEL);
+    return TiledImageContext::GetLevelSize(GetHeight(), level);
+}
+bool TiledImage::IsValid() const
+{
+    return (this->context) && (reinterpret_cast<const TiledImageContext*>(this->context)->source);
+}
+bool TiledImage::GetRegion(uint32 x, uint32 y, uint32 width, uint32 height, uint32 level, Image& result)
+{
+    CHECK(IsValid(), false, "Image was not loaded (have you called Load or Create methods ?)");
+    CHECK(level <= MAX_LEVEL, false, "Invalid level (%u) - it should be at most %u", level, MAX_LEVEL);
+    CHECK((width > 0) && (height > 0), false, "Invalid region size (%ux%u)", width, height);
+    CHECK(((uint64) x + width <= GetLevelWidth(level)) && ((uint64) y + height <= GetLevelHeight(level)),
+          false,
+          "Region (%u,%u - %ux%u) is outside level %u (%ux%u)",
+          x,
+          y,
+          width,
+          height,
+          level,
+          GetLevelWidth(level),
+          GetLevelHeight(level));
+    CHECK(result.Create(width, height), false, "Fail to create a %ux%u image", width, height);
+
+    auto Members = reinterpret_cast<TiledImageContext*>(this->context);
+    auto* output = result.GetPixelsBuffer();
+    for (uint32 tileY = y / TILE_SIZE; tileY <= (y + height - 1) / TILE_SIZE; tileY++)
+    {
+        const auto top    = std::max<>(y, tileY * TILE_SIZE);
+        const auto bottom = std::min<>(y + height, (tileY + 1) * TILE_SIZE);
+        for (uint32 tileX = x / TILE_SIZE; tileX <= (x + width - 1) / TILE_SIZE; tileX++)
+        {
+            const auto left  = std::max<>(x, tileX * TILE_SIZE);
+            const auto right = std::min<>(x + width, (tileX + 1) * TILE_SIZE);
+            const auto* tile = Members->GetTile(level, tileX, tileY);
+            for (uint32 line = top; line < bottom; line++)
+            {
+                memcpy(output + (size_t) (line - y) * width + (left - x),
+                       tile + (size_t) (line - tileY * TILE_SIZE) * TILE_SIZE + (left - tileX * TILE_SIZE),
+                       sizeof(Pixel) * (right - left));
+            }
+        }
+    }
+    return true;
+}
+} // namespace AppCUI::Graphics
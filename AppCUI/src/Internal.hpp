@@ -17,13 +17,15 @@
 
 #include <stdio.h>
 #include <iostream>
+#include <chrono>
 
 namespace AppCUI
 {
-constexpr uint32 REPAINT_STATUS_COMPUTE_POSITION = 1;
-constexpr uint32 REPAINT_STATUS_DRAW             = 2;
-constexpr uint32 REPAINT_STATUS_ALL              = (REPAINT_STATUS_COMPUTE_POSITION | REPAINT_STATUS_DRAW);
-constexpr uint32 REPAINT_STATUS_NONE             = 0;
+constexpr uint32 REPAINT_STATUS_COMPUTE_POSITION       = 1;
+constexpr uint32 REPAINT_STATUS_DRAW                   = 2;
+constexpr uint32 REPAINT_STATUS_COMPUTE_DIRTY_POSITION = 4; // only subtrees marked with LayoutDirty
+constexpr uint32 REPAINT_STATUS_ALL                    = (REPAINT_STATUS_COMPUTE_POSITION | REPAINT_STATUS_DRAW);
+constexpr uint32 REPAINT_STATUS_NONE                   = 0;
 
 constexpr uint32 MAX_MODAL_CONTROLS_STACK   = 16;
 constexpr uint32 MAX_COMMANDBAR_SHIFTSTATES = 8;
@@ -205,6 +207,104 @@ namespace Internal
         void Paint(Graphics::Renderer& renderer);
     };
 
+    class HitTestMap
+    {
+        vector<Controls::Control*> Cells;
+        Controls::Control* Root;
+        uint32 Width, Height;
+        bool Valid;
+
+        void Fill(Controls::Control* ctrl);
+        void Rebuild(Controls::Control* root, uint32 width, uint32 height);
+
+      public:
+        HitTestMap();
+        void Invalidate();
+        Controls::Control* Get(Controls::Control* root, int x, int y, uint32 width, uint32 height);
+    };
+
+    constexpr uint32 PROFILER_MAX_FRAMES = 256;
+    class FrameProfiler
+    {
+        Application::Profiler::FrameInfo Frames[PROFILER_MAX_FRAMES];
+        uint32 FramesCount, NextFrame;
+        uint64 FrameIndex;
+
+      public:
+        Application::Profiler::FrameInfo Current;
+        vector<Application::Profiler::ControlInfo> Snapshot;
+        Input::Key OverlayHotKey;
+        bool Enabled, OverlayVisible;
+
+        FrameProfiler();
+
+        static uint64 Now();
+        inline uint64 Start() const
+        {
+            return this->Enabled ? Now() : 0;
+        }
+        inline void Stop(uint64& time, uint64 start) const
+        {
+            if ((this->Enabled) && (start != 0)) // start is 0 if profiling was enabled in the middle of a frame
+                time += Now() - start;
+        }
+        void EndFrame(uint64 start);
+        void ClearFrames();
+        uint32 GetFramesCount() const;
+        const Application::Profiler::FrameInfo* GetFrame(uint32 index) const;
+    };
+
+    // Screen recordings: a file header followed by frames (a frame header and the encoded characters). The
+    // characters of a frame (row by row) are encoded as operations - a LEB128 value (count << 2 | type) followed,
+    // for runs and literals, by the PackedValue of the characters. Delta frames skip the characters that did not
+    // change since the previous frame, key frames encode all of them.
+    namespace CellStream
+    {
+        constexpr uint32 FILE_MAGIC     = 0x53524341; // ACRS
+        constexpr uint16 FORMAT_VERSION = 1;
+        constexpr uint8 KEY_FRAME       = 1;
+        constexpr uint8 DELTA_FRAME     = 2;
+        constexpr uint32 OP_SKIP        = 0; // count characters are the same as in the previous frame
+        constexpr uint32 OP_RUN         = 1; // count characters with the same value
+        constexpr uint32 OP_LITERAL     = 2; // count different values
+
+        struct FileHeader
+        {
+            uint32 magic;
+            uint16 version;
+            uint16 reserved;
+        };
+        struct FrameHeader
+        {
+            uint32 size; // encoded characters (bytes) after this header
+            uint8 type;
+            uint8 cursorVisible;
+            uint16 reserved;
+            uint64 time; // microseconds since the recording started
+            uint16 width, height;
+            uint16 cursorX, cursorY;
+        };
+    } // namespace CellStream
+
+    class ScreenRecorder
+    {
+        OS::File file;
+        std::vector<uint8> output;      // encoded frames that were not written yet
+        std::vector<uint32> previous;   // characters of the last recorded frame
+        std::chrono::steady_clock::time_point start;
+        uint32 width, height, cursorX, cursorY;
+        uint32 keyFrameInterval, framesSinceKeyFrame;
+        bool cursorVisible;
+
+        bool Flush();
+
+      public:
+        ~ScreenRecorder();
+        bool Create(const std::filesystem::path& path, uint32 keyFrameInterval);
+        bool AddFrame(const Graphics::Canvas& screen);
+        bool Close();
+    };
+
     class AbstractTerminal
     {
       protected:
@@ -213,6 +313,8 @@ namespace Internal
       public:
         uint32 LastCursorX, LastCursorY;
         Graphics::Canvas OriginalScreenCanvas, ScreenCanvas;
+        unique_ptr<ScreenRecorder> Recorder; // every frame that is flushed is recorded (if set)
+        uint32 FrameUpdateRequests;          // frames are updated (even without EnableFPSMode) while this is not 0
         bool Inited, LastCursorVisibility;
 
         virtual bool OnInit(const Application::InitializationData& initData)  = 0;
@@ -224,6 +326,7 @@ namespace Internal
         virtual void GetSystemEvent(Internal::SystemEvent& evnt)              = 0;
         virtual bool IsEventAvailable()                                       = 0;
         virtual bool HasSupportFor(Application::SpecialCharacterSetType type) = 0;
+        virtual bool GetGlyphCacheStats(Application::GlyphCacheStats& stats);
 
         virtual ~AbstractTerminal();
 
@@ -251,6 +354,8 @@ namespace Internal
 
         Controls::Desktop* AppDesktop;
         ToolTipController ToolTip;
+        HitTestMap HitTest;
+        FrameProfiler Profiler;
         Application::CommandBar CommandBarWrapper;
 
         Controls::Control* ModalControlsStack[MAX_MODAL_CONTROLS_STACK];
@@ -265,6 +370,7 @@ namespace Internal
 
         Application::InitializationFlags InitFlags;
         uint32 LastWindowID;
+        uint32 HotKeysVersion;
         int LastMouseX, LastMouseY;
         bool Inited;
         bool cmdBarUpdate;
@@ -277,6 +383,7 @@ namespace Internal
 
         void Destroy();
         void ComputePositions();
+        void ComputeDirtyPositions();
         void ProcessKeyPress(Input::Key keyCode, char16_t unicodeCharacter);
         void ProcessShiftState(Input::Key ShiftState);
         void ProcessMenuMouseClick(Controls::Menu* mnu, int x, int y);
@@ -305,6 +412,7 @@ namespace Internal
         void CheckIfAppShouldClose();
         bool ExecuteEventLoop(Controls::Control* control = nullptr);
         void Paint();
+        void PaintProfilerOverlay();
         void RaiseEvent(
               Utils::Reference<Controls::Control> control,
               Utils::Reference<Controls::Control> sourceControl,
@@ -389,6 +497,175 @@ namespace Utils
         }
     };
 } // namespace Utils
+namespace OS
+{
+    // maps a whole file (of at most 4 GB) as one view - the view is invalid if the file is empty or it can not be
+    // mapped (the pages are read by the OS on first access)
+    Utils::BufferView MapWholeFile(MappedFile& file, const std::filesystem::path& path);
+
+    // entries of a directory ("." and ".." are skipped) - the name and (if the file system provides it) the type of
+    // an entry are read in bulk, its attributes only when they are requested
+    class DirectoryReader
+    {
+#ifdef _WIN32
+        HANDLE handle;
+        WIN32_FIND_DATAW data;
+        bool hasData;
+#else
+        int fd;
+        void* dir;           // DIR* (where getdents64 is not available)
+        const char* current; // name of the last entry (for ReadAttributes)
+        std::unique_ptr<uint8[]> buffer;
+        uint32 bufferSize, bufferPos;
+#endif
+
+      public:
+        enum class EntryType : uint8
+        {
+            Unknown, // symbolic links or file systems that do not report the type
+            File,
+            Folder
+        };
+        struct Entry
+        {
+            std::u16string Name;
+            uint64 Size;
+            uint64 ModifiedTime; // seconds since 1970-01-01 (UTC)
+            EntryType Type;
+        };
+
+        DirectoryReader();
+        DirectoryReader(const DirectoryReader&) = delete;
+        DirectoryReader& operator=(const DirectoryReader&) = delete;
+        ~DirectoryReader();
+
+        bool Open(const std::filesystem::path& path);
+        void Close();
+        // false when there are no more entries (or the directory can not be read)
+        bool Next(Entry& entry);
+        // size and modified time of the last entry returned by Next (links are followed - Type is File or Folder
+        // afterwards)
+        bool ReadAttributes(Entry& entry);
+        // the last entry returned by Next with its attributes (broken links are reported as empty files)
+        inline void ReadEntry(Entry& e, DirectoryEntry& entry)
+        {
+            if (!ReadAttributes(e))
+            {
+                e.Size         = 0;
+                e.ModifiedTime = 0;
+            }
+            entry.Name         = std::move(e.Name);
+            entry.Size         = e.Size;
+            entry.ModifiedTime = e.ModifiedTime;
+            entry.IsFolder     = e.Type == EntryType::Folder;
+        }
+        // next entry and its attributes
+        inline bool Next(DirectoryEntry& entry)
+        {
+            Entry e;
+            if (!Next(e))
+                return false;
+            ReadEntry(e, entry);
+            return true;
+        }
+    };
+
+    namespace DirectoryCache
+    {
+        // the ticket of a directory that can not be cached (Store ignores its entries)
+        constexpr uint64 INVALID_TICKET = 0xFFFFFFFFFFFFFFFFULL;
+
+        // cached entries (nullptr if the directory is not in the cache or it was changed)
+        std::shared_ptr<const DirectoryEntries> Find(const std::filesystem::path& path);
+        // has to be called before a directory is read (changes made while it is read are also detected) - the
+        // result is the ticket for Store
+        uint64 BeginRead(const std::filesystem::path& path);
+        // entries are not cached if the directory was changed since BeginRead
+        void Store(const std::filesystem::path& path, uint64 ticket, std::shared_ptr<const DirectoryEntries> entries);
+    } // namespace DirectoryCache
+} // namespace OS
+namespace Graphics
+{
+    // pixels of a tiled image - only the regions that are drawn are read
+    class TileSource
+    {
+      protected:
+        uint32 width, height;
+
+      public:
+        TileSource() : width(0), height(0)
+        {
+        }
+        virtual ~TileSource() = default;
+        // copies the pixels (x + i * step, y + j * step) with i < count and j < lines into output (one line of
+        // pixels every "stride" pixels) - the region is always inside the image
+        virtual void ReadPixels(
+              uint32 x, uint32 y, uint32 count, uint32 lines, uint32 step, Pixel* output, uint32 stride) = 0;
+        inline uint32 GetWidth() const
+        {
+            return width;
+        }
+        inline uint32 GetHeight() const
+        {
+            return height;
+        }
+    };
+    // uncompressed bitmaps (8, 24 or 32 bits/pixel) read straight from a memory mapped file (nullptr for any other
+    // kind of file)
+    std::unique_ptr<TileSource> CreateBitmapTileSource(const std::filesystem::path& path);
+
+    // summed-area table of an image --> the average color of any rectangle of pixels in O(1)
+    class ImageIntegral
+    {
+        struct Sum
+        {
+            uint32 Red, Green, Blue; // modulo 2^32 (exact for every rectangle of up to 2^32/255 pixels)
+        };
+        std::vector<Sum> sums; // (width + 1) x (height + 1) --> first line and column are 0
+        uint32 width, height;
+
+        void AddRectangle(uint32 left, uint32 top, uint32 right, uint32 bottom, uint64* result) const;
+
+      public:
+        ImageIntegral() : width(0), height(0)
+        {
+        }
+        bool Create(const Image& img);
+        void Clear();
+        // average of the pixels in [left, right) x [top, bottom) - black for an empty rectangle
+        Pixel ComputeAverageColor(uint32 left, uint32 top, uint32 right, uint32 bottom) const;
+        inline uint32 GetWidth() const
+        {
+            return width;
+        }
+        inline uint32 GetHeight() const
+        {
+            return height;
+        }
+        inline bool IsValid() const
+        {
+            return (width > 0) && (height > 0);
+        }
+    };
+    Size ComputeRenderingSize(uint32 imageWidth, uint32 imageHeight, ImageRenderingMethod method, double scale);
+    // same characters as Renderer::DrawImage, but without the cache (it can be called from any thread) - the
+    // canvas is resized to the rendering size of the image
+    bool ConvertImageToCells(const Image& img, ImageRenderingMethod method, ImageScaleMethod scale, Canvas& cells);
+    // draws the characters [column, column + visibleWidth) x [row, row + visibleHeight) of the image stretched
+    // over (width x height) characters - only the visible characters are computed
+    bool DrawImage(
+          Renderer& renderer,
+          const ImageIntegral& integral,
+          int x,
+          int y,
+          uint32 width,
+          uint32 height,
+          uint32 column,
+          uint32 row,
+          uint32 visibleWidth,
+          uint32 visibleHeight,
+          ImageRenderingMethod method);
+} // namespace Graphics
 namespace Log
 {
     void Unit(); // needed to release some alocation buffers
@@ -1,14 +1,39 @@
 #include "Internal.hpp"
 
 #include <stdarg.h>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace AppCUI::Log
 {
 using namespace Utils;
 
 constexpr uint32 CRITICAL_ERROR_STACK_BUFFER_SIZE = 0x10000;
+constexpr uint32 ASYNC_QUEUE_MIN_SIZE             = 0x10000;
+constexpr uint32 ASYNC_QUEUE_MAX_SIZE             = 0x10000000;
+constexpr uint32 ASYNC_RECORD_HEADER_SIZE         = sizeof(uint64);
+constexpr uint32 ASYNC_BATCH_SIZE                 = 0x100000; // the queue is released after every batch
+constexpr auto ASYNC_WRITE_INTERVAL               = std::chrono::milliseconds(50);
+constexpr auto ASYNC_BLOCK_WAIT                   = std::chrono::microseconds(100);
+constexpr uint64 ASYNC_STRUCTURED_RECORD          = 0x8000000000000000ULL; // header flag
+constexpr uint32 STRUCTURED_RECORD_MAX_SIZE       = 2048;
+constexpr uint32 STRUCTURED_RECORD_MAX_ARGUMENTS  = 32;
+constexpr uint64 NANOSECONDS_PER_SECOND           = 1000000000ULL;
+constexpr uint64 SECONDS_PER_DAY                  = 86400;
+
+struct AsyncLogWriter;
 static void (*fnMessageLogCallbak)(const Message& msg)   = nullptr;
 static  OS::File* logFile                                = nullptr;
+static AsyncLogWriter* asyncWriter                       = nullptr;
+static std::atomic<uint32> minSeverity{ 0 };
+static std::atomic<uint32> threadsCount{ 0 };
+static thread_local uint32 currentThreadID = 0;
+static thread_local bool loggingDisabled   = false; // the async writer thread can not log (it would log in itself)
+static void StopAsyncWriter();
 static const char* _severity_type_names_[5]              = {
     "[Information] ", "[  Warning  ] ", "[   Error   ] ", "[InternalErr] ", "[   Fatal   ] "
 };
@@ -54,6 +79,234 @@ bool _LogMessage_to_String_(const Message& msg, String& str, bool multiLine, boo
     return true;
 }
 
+// a value from a format specifier ('*' for width or precision) or for a conversion that expects another type
+int64 _Argument_to_Int64_(const Argument& arg)
+{
+    switch (arg.Type)
+    {
+    case ArgumentType::Int64:
+        return arg.Int64;
+    case ArgumentType::UInt64:
+        return (int64) arg.UInt64;
+    case ArgumentType::Double:
+        return (int64) arg.Double;
+    case ArgumentType::Pointer:
+        return (int64) (uintptr_t) arg.Pointer;
+    default:
+        return 0;
+    }
+}
+// an integer converted like printf does for %d (signed) and %u/%x/%o (unsigned) - only the bytes of the original value
+// are used (an int32 of -1 is 0xFFFFFFFF for %x)
+int64 _Argument_to_Signed_(const Argument& arg)
+{
+    const auto value = _Argument_to_Int64_(arg);
+    if ((arg.Type != ArgumentType::Int64) && (arg.Type != ArgumentType::UInt64))
+        return value;
+    if ((arg.Size == 0) || (arg.Size >= sizeof(int64)))
+        return value;
+    const auto shift = (sizeof(int64) - arg.Size) * 8;
+    return (int64) ((uint64) value << shift) >> shift;
+}
+uint64 _Argument_to_Unsigned_(const Argument& arg)
+{
+    const auto value = (uint64) _Argument_to_Int64_(arg);
+    if ((arg.Type != ArgumentType::Int64) && (arg.Type != ArgumentType::UInt64))
+        return value;
+    if ((arg.Size == 0) || (arg.Size >= sizeof(uint64)))
+        return value;
+    return value & ((1ULL << (arg.Size * 8)) - 1);
+}
+double _Argument_to_Double_(const Argument& arg)
+{
+    switch (arg.Type)
+    {
+    case ArgumentType::Int64:
+        return (double) arg.Int64;
+    case ArgumentType::UInt64:
+        return (double) arg.UInt64;
+    case ArgumentType::Double:
+        return arg.Double;
+    default:
+        return 0.0;
+    }
+}
+template <typename T>
+void _AddFormat_(std::string& output, const char* specifier, T value)
+{
+    char buffer[256];
+    const auto len = snprintf(buffer, sizeof(buffer), specifier, value);
+    if (len < 0)
+        return;
+    if (len < (int) sizeof(buffer))
+    {
+        output.append(buffer, len);
+        return;
+    }
+    // a large width or a long string
+    const auto start = output.size();
+    output.resize(start + len + 1);
+    snprintf(output.data() + start, len + 1, specifier, value);
+    output.resize(start + len);
+}
+// formats the arguments like vsnprintf does - the length modifiers (h, l, ll, z, ...) from the format are replaced
+// with the ones needed by the stored type of each argument
+void _FormatArguments_(std::string& output, const char* format, const Argument* args, uint32 argsCount)
+{
+    char specifier[64];
+    uint32 argIndex = 0;
+    auto p          = format;
+    while (*p)
+    {
+        if ((*p) != '%')
+        {
+            const auto start = p;
+            while ((*p) && ((*p) != '%'))
+                p++;
+            output.append(start, p - start);
+            continue;
+        }
+        if (p[1] == '%')
+        {
+            output += '%';
+            p += 2;
+            continue;
+        }
+        // %[flags][width][.precision][length]conversion
+        const auto start   = p++;
+        uint32 len         = 0;
+        bool missing       = false;
+        specifier[len++]   = '%';
+        const auto addChar = [&specifier, &len](char ch)
+        {
+            if (len + 4 < sizeof(specifier)) // room for "ll" + conversion + '\0'
+                specifier[len++] = ch;
+        };
+        const auto addNumber = [&](bool isPrecision)
+        {
+            if ((*p) == '*')
+            {
+                p++;
+                if (argIndex >= argsCount)
+                {
+                    missing = true;
+                    return;
+                }
+                auto value = _Argument_to_Int64_(args[argIndex++]);
+                if ((isPrecision) && (value < 0))
+                    value = 0;
+                char number[24];
+                const auto numberLen = snprintf(number, sizeof(number), "%lld", (long long) value);
+                for (auto tr = 0; tr < numberLen; tr++)
+                    addChar(number[tr]);
+                return;
+            }
+            while (((*p) >= '0') && ((*p) <= '9'))
+                addChar(*(p++));
+        };
+        while ((*p) && (strchr("-+ #0", *p)))
+            addChar(*(p++));
+        addNumber(false);
+        if ((*p) == '.')
+        {
+            addChar(*(p++));
+            addNumber(true);
+        }
+        while ((*p) && (strchr("hlLqjzt", *p)))
+            p++;
+        const auto conversion = *p;
+        if (conversion == 0)
+        {
+            output.append(start);
+            break;
+        }
+        p++;
+        if ((missing) || (conversion == 'n') || (argIndex >= argsCount))
+        {
+            // nothing to format --> the specifier is written as it is
+            output.append(start, p - start);
+            continue;
+        }
+        const auto& arg = args[argIndex++];
+        if (len == 1)
+        {
+            // no flags, width or precision (the usual case) --> there is no need for snprintf
+            char number[24];
+            std::to_chars_result res{ nullptr, std::errc::invalid_argument };
+            if ((conversion == 'd') || (conversion == 'i'))
+                res = std::to_chars(number, number + sizeof(number), _Argument_to_Signed_(arg));
+            else if (conversion == 'u')
+                res = std::to_chars(number, number + sizeof(number), _Argument_to_Unsigned_(arg));
+            else if (conversion == 'x')
+                res = std::to_chars(number, number + sizeof(number), _Argument_to_Unsigned_(arg), 16);
+            else if ((conversion == 's') && (arg.Type == ArgumentType::String) && (arg.String))
+            {
+                output.append(arg.String);
+                continue;
+            }
+            if (res.ec == std::errc())
+            {
+                output.append(number, res.ptr - number);
+                continue;
+            }
+        }
+        switch (conversion)
+        {
+        case 'd':
+        case 'i':
+            addChar('l');
+            addChar('l');
+            addChar(conversion);
+            specifier[len] = 0;
+            _AddFormat_(output, specifier, (long long) _Argument_to_Signed_(arg));
+            break;
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+            addChar('l');
+            addChar('l');
+            addChar(conversion);
+            specifier[len] = 0;
+            _AddFormat_(output, specifier, (unsigned long long) _Argument_to_Unsigned_(arg));
+            break;
+        case 'c':
+            addChar('c');
+            specifier[len] = 0;
+            _AddFormat_(output, specifier, (int) _Argument_to_Int64_(arg));
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            addChar(conversion);
+            specifier[len] = 0;
+            _AddFormat_(output, specifier, _Argument_to_Double_(arg));
+            break;
+        case 's':
+            addChar('s');
+            specifier[len] = 0;
+            if (arg.Type != ArgumentType::String)
+                _AddFormat_(output, specifier, "(invalid)");
+            else
+                _AddFormat_(output, specifier, arg.String ? arg.String : "(null)");
+            break;
+        case 'p':
+            addChar('p');
+            specifier[len] = 0;
+            _AddFormat_(output, specifier, arg.Type == ArgumentType::Pointer ? arg.Pointer : nullptr);
+            break;
+        default:
+            output.append(start, p - start);
+            break;
+        }
+    }
+}
+
 void Report(
       Severity severity,
       const char* fileName,
@@ -64,11 +317,12 @@ void Report(
       ...)
 {
     va_list args;
-    int len, len2;
+    int len;
     char Text[CRITICAL_ERROR_STACK_BUFFER_SIZE];
     Message msg;
 
-    if (fnMessageLogCallbak == nullptr)
+    if ((fnMessageLogCallbak == nullptr) || (((uint32) severity) < minSeverity.load(std::memory_order_relaxed)) ||
+        (loggingDisabled))
         return;
     // fill up Message structure
     msg.Type       = severity;
@@ -78,22 +332,17 @@ void Report(
     msg.LineNumber = line;
     msg.Content    = Text;
 
-    // fill up the content
+    // fill up the content (one formatting pass - vsnprintf returns the full length even if the text is truncated)
     while (true)
     {
         CHECK_INTERNAL_CONDITION(format != nullptr, "Invalid 'format' parameter (expecting a non-null one) !");
         va_start(args, format);
-        len = vsnprintf(nullptr, 0, format, args);
+        len = vsnprintf(Text, CRITICAL_ERROR_STACK_BUFFER_SIZE - 2, format, args);
         va_end(args);
         CHECK_INTERNAL_CONDITION(len >= 0, "'vsnprinf' has returned an invalid value !");
         CHECK_INTERNAL_CONDITION(
-              len < (int)(CRITICAL_ERROR_STACK_BUFFER_SIZE - 2),
+              len < (int) (CRITICAL_ERROR_STACK_BUFFER_SIZE - 2),
               "Formatting buffer size is too large (max accepted is 0x10000 bytes)");
-        va_start(args, format);
-        len2 = vsnprintf(Text, CRITICAL_ERROR_STACK_BUFFER_SIZE - 2, format, args);
-        va_end(args);
-        CHECK_INTERNAL_CONDITION(len2 >= 0, "'vsnprinf' has returned an invalid value when writing the buffer !");
-        Text[len2] = 0;
         break;
     }
     fnMessageLogCallbak(msg);
@@ -102,6 +351,7 @@ void Report(
 void SetLogCallback(void (*callback)(const Message&))
 {
     fnMessageLogCallbak = callback;
+    StopAsyncWriter();
 }
 
 void _write_to_file_callback_(const Message& msg)
@@ -112,6 +362,442 @@ void _write_to_file_callback_(const Message& msg)
         logFile->Write(tmpString.GetText(), tmpString.Len());
     }
 }
+// a message whose arguments are formatted by the writer thread (followed by the arguments and the copied strings)
+struct StructuredRecord
+{
+    const char* Format;
+    const char* FileName;
+    const char* Function;
+    const char* Condition;
+    uint64 Time; // nanoseconds (system clock)
+    Severity Type;
+    uint32 LineNumber;
+    uint32 ThreadID;
+    uint32 ArgumentsCount;
+};
+static_assert(sizeof(StructuredRecord) % alignof(Argument) == 0);
+static_assert(
+      sizeof(StructuredRecord) + (sizeof(Argument) + 1) * STRUCTURED_RECORD_MAX_ARGUMENTS <= STRUCTURED_RECORD_MAX_SIZE);
+
+uint64 GetTimestamp()
+{
+    const auto now = std::chrono::system_clock::now().time_since_epoch();
+    return (uint64) std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+uint32 GetCurrentThreadID()
+{
+    if (currentThreadID == 0)
+        currentThreadID = threadsCount.fetch_add(1, std::memory_order_relaxed) + 1;
+    return currentThreadID;
+}
+
+// a queue of messages: the threads that log reserve space in it with a CAS (no locks) and the writer thread consumes
+// the messages in the order they were reserved
+// every record is a header (the size of the data + 1, set after the data is copied) followed by the data (aligned
+// to 8) - the data is either a formatted text or a StructuredRecord
+struct AsyncLogWriter
+{
+    std::unique_ptr<uint64[]> queue;
+    uint64 size;
+    uint64 mask;
+    std::atomic<uint64> writePos; // reserved by the threads that log
+    std::atomic<uint64> readPos;  // consumed by the writer thread
+    std::atomic<uint64> droppedMessages;
+    std::atomic<bool> stop;
+    OverflowPolicy policy;
+    OS::File file;
+    std::thread writer;
+    std::string batch;
+    std::string content;
+    vector<uint64> record; // a structured record (aligned)
+
+    // only used to wait (for the writer or for a flush)
+    std::mutex lock;
+    std::condition_variable wakeWriter;
+    std::condition_variable written;
+    uint64 writtenPos;
+
+    AsyncLogWriter(uint32 queueSize, OverflowPolicy overflowPolicy)
+        : size(std::bit_ceil(std::clamp<>(queueSize, ASYNC_QUEUE_MIN_SIZE, ASYNC_QUEUE_MAX_SIZE))),
+          mask(size - 1), writePos(0), readPos(0), droppedMessages(0), stop(false), policy(overflowPolicy),
+          writtenPos(0)
+    {
+        queue = std::make_unique<uint64[]>(size / sizeof(uint64)); // all headers are 0 (not committed)
+    }
+    static uint64 GetRecordSize(uint32 textSize)
+    {
+        return ASYNC_RECORD_HEADER_SIZE + ((((uint64) textSize) + 7) & (~((uint64) 7)));
+    }
+    std::atomic_ref<uint64> GetHeader(uint64 pos)
+    {
+        return std::atomic_ref<uint64>(queue[(pos & mask) / sizeof(uint64)]);
+    }
+    // the text of a record might wrap around the end of the queue
+    void CopyToQueue(uint64 pos, const char* text, uint32 textSize)
+    {
+        auto data         = reinterpret_cast<char*>(queue.get());
+        const auto offset = pos & mask;
+        const auto first  = std::min<>((uint64) textSize, size - offset);
+        memcpy(data + offset, text, first);
+        memcpy(data, text + first, textSize - first);
+    }
+    void CopyFromQueue(uint64 pos, char* output, uint64 dataSize)
+    {
+        auto data         = reinterpret_cast<char*>(queue.get());
+        const auto offset = pos & mask;
+        const auto first  = std::min<>(dataSize, size - offset);
+        memcpy(output, data + offset, first);
+        memcpy(output + first, data, dataSize - first);
+    }
+    void ClearQueue(uint64 pos, uint64 recordSize)
+    {
+        // any 8 bytes from the record can be the header of a future record
+        auto data         = reinterpret_cast<char*>(queue.get());
+        const auto offset = pos & mask;
+        const auto first  = std::min<>(recordSize, size - offset);
+        memset(data + offset, 0, first);
+        memset(data, 0, recordSize - first);
+    }
+    void AddStructuredRecord()
+    {
+        const auto rec  = reinterpret_cast<StructuredRecord*>(record.data());
+        const auto args = reinterpret_cast<Argument*>(rec + 1);
+        auto strings    = reinterpret_cast<const char*>(args + rec->ArgumentsCount);
+        for (uint32 tr = 0; tr < rec->ArgumentsCount; tr++)
+        {
+            if (args[tr].Type != ArgumentType::String)
+                continue;
+            const auto len = args[tr].UInt64;
+            args[tr].String = strings;
+            strings += len + 1;
+        }
+        // [hh:mm:ss.uuuuuu T<thread>] message (UTC time)
+        const auto seconds      = rec->Time / NANOSECONDS_PER_SECOND;
+        const auto daySeconds   = (uint32) (seconds % SECONDS_PER_DAY);
+        const auto microseconds = (uint32) ((rec->Time % NANOSECONDS_PER_SECOND) / 1000);
+        const auto addDigits    = [this](uint32 value, uint32 digits)
+        {
+            char text[8];
+            for (auto tr = digits; tr > 0; tr--, value /= 10)
+                text[tr - 1] = (char) ('0' + (value % 10));
+            content.append(text, digits);
+        };
+        content.assign("[");
+        addDigits(daySeconds / 3600, 2);
+        content += ':';
+        addDigits((daySeconds / 60) % 60, 2);
+        content += ':';
+        addDigits(daySeconds % 60, 2);
+        content += '.';
+        addDigits(microseconds, 6);
+        content += " T";
+        content += std::to_string(rec->ThreadID);
+        content += "] ";
+        _FormatArguments_(content, rec->Format, args, rec->ArgumentsCount);
+
+        Message msg;
+        msg.Type       = rec->Type;
+        msg.Content    = content.c_str();
+        msg.FileName   = rec->FileName;
+        msg.Function   = rec->Function;
+        msg.Condition  = rec->Condition;
+        msg.LineNumber = rec->LineNumber;
+        LocalString<2048> tmpString;
+        if (_LogMessage_to_String_(msg, tmpString, true, true))
+            batch.append(tmpString.GetText(), tmpString.Len());
+    }
+    void Push(const char* text, uint32 textSize, uint64 flags)
+    {
+        textSize              = std::min<>(textSize, (uint32) (size / 4));
+        const auto recordSize = GetRecordSize(textSize);
+        auto pos              = writePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            if (pos + recordSize - readPos.load(std::memory_order_acquire) > size)
+            {
+                if (policy == OverflowPolicy::Drop)
+                {
+                    droppedMessages.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                wakeWriter.notify_one();
+                std::this_thread::sleep_for(ASYNC_BLOCK_WAIT);
+                pos = writePos.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (writePos.compare_exchange_weak(pos, pos + recordSize, std::memory_order_relaxed))
+                break;
+        }
+        CopyToQueue(pos + ASYNC_RECORD_HEADER_SIZE, text, textSize);
+        GetHeader(pos).store((((uint64) textSize) + 1) | flags, std::memory_order_release);
+        // the writer is woken up earlier if the queue is half full
+        if (pos + recordSize - readPos.load(std::memory_order_relaxed) > size / 2)
+            wakeWriter.notify_one();
+    }
+    // writes all consecutive records that were committed (a record that is still copied stops the batch)
+    void WriteRecords()
+    {
+        auto pos = readPos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            batch.clear();
+            while (batch.size() < ASYNC_BATCH_SIZE)
+            {
+                const auto header = GetHeader(pos).load(std::memory_order_acquire);
+                if (header == 0)
+                    break;
+                const auto dataSize   = (header & (~ASYNC_STRUCTURED_RECORD)) - 1;
+                const auto recordSize = GetRecordSize((uint32) dataSize);
+                const auto dataPos    = pos + ASYNC_RECORD_HEADER_SIZE;
+                if (header & ASYNC_STRUCTURED_RECORD)
+                {
+                    record.resize((dataSize + 7) / 8);
+                    CopyFromQueue(dataPos, reinterpret_cast<char*>(record.data()), dataSize);
+                    AddStructuredRecord();
+                }
+                else
+                {
+                    const auto start = batch.size();
+                    batch.resize(start + dataSize);
+                    CopyFromQueue(dataPos, batch.data() + start, dataSize);
+                }
+                ClearQueue(pos, recordSize);
+                pos += recordSize;
+            }
+            readPos.store(pos, std::memory_order_release);
+            const auto dropped = droppedMessages.exchange(0, std::memory_order_relaxed);
+            if (dropped > 0)
+            {
+                LocalString<128> tmp;
+                tmp.SetFormat("%s%llu messages were dropped (the log queue was full)\n",
+                              _severity_type_names_[(uint32) Severity::Warning],
+                              (unsigned long long) dropped);
+                batch.append(tmp.GetText(), tmp.Len());
+            }
+            if (batch.empty())
+                break;
+            file.Write(batch.data(), (uint32) batch.size());
+            if (batch.size() < ASYNC_BATCH_SIZE)
+                break;
+        }
+        std::lock_guard<std::mutex> guard(lock);
+        writtenPos = pos;
+        written.notify_all();
+    }
+    void Run()
+    {
+        // a failed write reports an error --> it would be pushed in the queue that is written (and with a full
+        // queue and OverflowPolicy::Block the writer would wait for itself)
+        loggingDisabled = true;
+        while (!stop.load(std::memory_order_acquire))
+        {
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                wakeWriter.wait_for(guard, ASYNC_WRITE_INTERVAL);
+            }
+            WriteRecords();
+        }
+        WriteRecords();
+    }
+    void Flush()
+    {
+        if (std::this_thread::get_id() == writer.get_id())
+            return; // the writer thread would wait for itself
+        const auto target = writePos.load(std::memory_order_acquire);
+        std::unique_lock<std::mutex> guard(lock);
+        wakeWriter.notify_one();
+        written.wait(guard, [this, target]() { return writtenPos >= target; });
+    }
+    void Stop()
+    {
+        stop.store(true, std::memory_order_release);
+        wakeWriter.notify_one();
+        if (writer.joinable())
+            writer.join();
+        file.Close();
+    }
+};
+static void StopAsyncWriter()
+{
+    if (asyncWriter)
+    {
+        asyncWriter->Stop();
+        delete asyncWriter;
+        asyncWriter = nullptr;
+    }
+}
+void _write_to_async_queue_callback_(const Message& msg)
+{
+    LocalString<2048> tmpString;
+    if ((_LogMessage_to_String_(msg, tmpString, true, true)) && (asyncWriter))
+    {
+        asyncWriter->Push(tmpString.GetText(), tmpString.Len(), 0);
+        // the application might stop right after these messages
+        if ((msg.Type == Severity::Fatal) || (msg.Type == Severity::InternalError))
+            asyncWriter->Flush();
+    }
+}
+bool ToFileAsync(const std::filesystem::path& fileName, uint32 queueSize, OverflowPolicy policy)
+{
+    StopAsyncWriter();
+    auto writer = new AsyncLogWriter(queueSize, policy);
+    if (writer->file.Create(fileName, true) == false)
+    {
+        delete writer;
+        return false;
+    }
+    asyncWriter         = writer;
+    asyncWriter->writer = std::thread(&AsyncLogWriter::Run, asyncWriter);
+    fnMessageLogCallbak = _write_to_async_queue_callback_;
+    return true;
+}
+void Flush()
+{
+    if (asyncWriter)
+        asyncWriter->Flush();
+}
+void SetMinSeverity(Severity type)
+{
+    minSeverity.store((uint32) type, std::memory_order_relaxed);
+}
+// the maximum number of characters that the format reads from each string argument - a string printed with a
+// precision (%.5s or %.*s) does not have to be NUL terminated, so it must not be read after the precision
+void _GetStringLimits_(const char* format, const Argument* args, uint32 argsCount, uint32* limits)
+{
+    for (uint32 tr = 0; tr < argsCount; tr++)
+        limits[tr] = 0xFFFFFFFF;
+    uint32 argIndex = 0;
+    auto p          = format;
+    while ((*p) && (argIndex < argsCount))
+    {
+        if ((*(p++)) != '%')
+            continue;
+        if ((*p) == '%')
+        {
+            p++;
+            continue;
+        }
+        // the same parsing as _FormatArguments_ (the arguments are consumed in the same order)
+        while ((*p) && (strchr("-+ #0", *p)))
+            p++;
+        if ((*p) == '*')
+        {
+            p++;
+            argIndex++;
+        }
+        while (((*p) >= '0') && ((*p) <= '9'))
+            p++;
+        int64 precision = -1;
+        if ((*p) == '.')
+        {
+            p++;
+            if ((*p) == '*')
+            {
+                p++;
+                precision = argIndex < argsCount ? _Argument_to_Int64_(args[argIndex]) : -1;
+                argIndex++;
+            }
+            else
+            {
+                precision = 0;
+                while (((*p) >= '0') && ((*p) <= '9'))
+                    precision = std::min<>(precision * 10 + ((*(p++)) - '0'), (int64) 0xFFFFFFFF);
+            }
+        }
+        while ((*p) && (strchr("hlLqjzt", *p)))
+            p++;
+        if ((*p) == 0)
+            break;
+        const auto conversion = *(p++);
+        if ((conversion == 'n') || (argIndex >= argsCount))
+            continue;
+        if ((conversion == 's') && (precision >= 0))
+            limits[argIndex] = (uint32) precision;
+        argIndex++;
+    }
+}
+// only the arguments are copied (the text is formatted by the writer thread)
+void _write_structured_record_(const StructuredRecord& header, const Argument* arguments, uint32 argumentsCount)
+{
+    alignas(StructuredRecord) char data[STRUCTURED_RECORD_MAX_SIZE];
+    auto rec            = reinterpret_cast<StructuredRecord*>(data);
+    auto args           = reinterpret_cast<Argument*>(rec + 1);
+    *rec                = header;
+    rec->ArgumentsCount = std::min<>(argumentsCount, STRUCTURED_RECORD_MAX_ARGUMENTS);
+    uint32 used         = (uint32) (sizeof(StructuredRecord) + sizeof(Argument) * rec->ArgumentsCount);
+    uint32 limits[STRUCTURED_RECORD_MAX_ARGUMENTS];
+    _GetStringLimits_(rec->Format, arguments, rec->ArgumentsCount, limits);
+    // every string needs at least its terminator --> a long string leaves room for the strings that follow it
+    uint32 stringsLeft = 0;
+    for (uint32 tr = 0; tr < rec->ArgumentsCount; tr++)
+        stringsLeft += arguments[tr].Type == ArgumentType::String ? 1 : 0;
+    for (uint32 tr = 0; tr < rec->ArgumentsCount; tr++)
+    {
+        args[tr] = arguments[tr];
+        if (args[tr].Type != ArgumentType::String)
+            continue;
+        // strings are copied (long strings are truncated)
+        stringsLeft--;
+        const auto text  = args[tr].String ? args[tr].String : "(null)";
+        const auto space = STRUCTURED_RECORD_MAX_SIZE - used - stringsLeft - 1;
+        const auto len   = (uint32) strnlen(text, std::min<>(limits[tr], space));
+        memcpy(data + used, text, len);
+        data[used + len] = 0;
+        args[tr].UInt64  = len;
+        used += len + 1;
+    }
+    asyncWriter->Push(data, used, ASYNC_STRUCTURED_RECORD);
+    if ((header.Type == Severity::Fatal) || (header.Type == Severity::InternalError))
+        asyncWriter->Flush();
+}
+void ReportArguments(
+      Severity severity,
+      const char* fileName,
+      const char* function,
+      const char* condition,
+      uint32 line,
+      const char* format,
+      bool staticFormat,
+      const Argument* arguments,
+      uint32 argumentsCount)
+{
+    if ((fnMessageLogCallbak == nullptr) || (((uint32) severity) < minSeverity.load(std::memory_order_relaxed)) ||
+        (loggingDisabled))
+        return;
+    if ((staticFormat) && (format) && (fnMessageLogCallbak == _write_to_async_queue_callback_) && (asyncWriter))
+    {
+        StructuredRecord rec;
+        rec.Format     = format;
+        rec.FileName   = fileName;
+        rec.Function   = function;
+        rec.Condition  = condition;
+        rec.Time       = GetTimestamp();
+        rec.Type       = severity;
+        rec.LineNumber = line;
+        rec.ThreadID   = GetCurrentThreadID();
+        _write_structured_record_(rec, arguments, argumentsCount);
+        return;
+    }
+    // formatted right away (just like Report)
+    std::string text;
+    Message msg;
+    msg.Type       = severity;
+    msg.Condition  = condition;
+    msg.FileName   = fileName;
+    msg.Function   = function;
+    msg.LineNumber = line;
+    if (format)
+    {
+        _FormatArguments_(text, format, arguments, argumentsCount);
+    }
+    else
+    {
+        text     = "Invalid 'format' parameter (expecting a non-null one) !";
+        msg.Type = Severity::InternalError;
+    }
+    msg.Content = text.c_str();
+    fnMessageLogCallbak(msg);
+}
 bool ToFile(const std::filesystem::path& fileName)
 {
     if (logFile == nullptr)
@@ -127,6 +813,7 @@ bool ToFile(const std::filesystem::path& fileName)
     }
     // all good
     fnMessageLogCallbak = _write_to_file_callback_;
+    StopAsyncWriter();
     return true;
 }
 
@@ -144,6 +831,7 @@ bool ToOutputDebugString()
 {
 #ifdef OutputDebugString
     fnMessageLogCallbak = _write_to_OutDebugString_;
+    StopAsyncWriter();
     return true;
 #endif
     return false; // not on Windows
@@ -160,6 +848,7 @@ void _write_to_stderr_callback_(const Message& msg)
 bool ToStdErr()
 {
     fnMessageLogCallbak = _write_to_stderr_callback_;
+    StopAsyncWriter();
     return true;
 }
 
@@ -174,12 +863,15 @@ void _write_to_stdout_callback_(const Message& msg)
 bool ToStdOut()
 {
     fnMessageLogCallbak = _write_to_stdout_callback_;
+    StopAsyncWriter();
     return true;
 }
 
 // only available for internal usage
 void Unit()
 {
+    // the queued messages are written before the file is closed
+    StopAsyncWriter();
     if (logFile != nullptr)
     {
         logFile->Close();
@@ -0,0 +1,288 @@
+#include "Internal.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace AppCUI::OS
+{
+using namespace Utils;
+
+constexpr uint32 MAX_IO_THREADS = 4;
+
+struct AsyncReaderData;
+struct AsyncReadRequest
+{
+    AsyncReaderData* reader;
+    Buffer data;
+    uint64 id;
+    uint64 offset;
+    uint32 size;
+    bool succeeded;
+};
+struct AsyncReaderData
+{
+    DataObject* dataObject;
+    OnAsyncReadCompletedInterface* handler;
+    std::deque<std::unique_ptr<AsyncReadRequest>> requests; // not started yet
+    uint64 runningRequest;                                   // 0 if it was cancelled (or no request is read)
+    bool scheduled;                                          // in the ready queue of the pool (or running)
+    bool running;
+};
+
+// the requests of a reader are read one at a time (a data object is not thread safe) --> a reader (and not a request)
+// is given to a thread and it is scheduled again if it has other requests
+struct AsyncIOPool
+{
+    std::mutex lock;
+    std::condition_variable workAvailable, requestFinished;
+    std::deque<AsyncReaderData*> ready;
+    std::deque<std::unique_ptr<AsyncReadRequest>> completed;
+    vector<std::thread> threads;
+    uint64 lastRequestID;
+    uint32 outstandingRequests; // scheduled and not delivered (or cancelled)
+    bool frameUpdatesRequested;
+    bool stop;
+
+    AsyncIOPool() : lastRequestID(0), outstandingRequests(0), frameUpdatesRequested(false), stop(false)
+    {
+    }
+    ~AsyncIOPool()
+    {
+        {
+            std::lock_guard<std::mutex> guard(this->lock);
+            this->stop = true;
+        }
+        this->workAvailable.notify_all();
+        for (auto& t : this->threads)
+            t.join();
+    }
+    void Run()
+    {
+        std::unique_lock<std::mutex> guard(this->lock);
+        while (true)
+        {
+            this->workAvailable.wait(guard, [this]() { return (this->stop) || (!this->ready.empty()); });
+            if (this->stop)
+                return;
+            auto* reader = this->ready.front();
+            this->ready.pop_front();
+            if (reader->requests.empty())
+            {
+                reader->scheduled = false; // its requests were cancelled
+                continue;
+            }
+            auto request = std::move(reader->requests.front());
+            reader->requests.pop_front();
+            reader->runningRequest = request->id;
+            reader->running        = true;
+            guard.unlock();
+
+            uint64 bytesRead = 0;
+            request->data.Resize(request->size);
+            if (request->data.GetLength() == request->size)
+            {
+                IOBuffer buffer    = { request->data.GetData(), request->size };
+                request->succeeded = reader->dataObject->ReadVector(request->offset, &buffer, 1, bytesRead);
+            }
+            request->data.Resize(request->succeeded ? (size_t) bytesRead : 0);
+
+            guard.lock();
+            // a request that was cancelled while it was read is dropped
+            if (reader->runningRequest == request->id)
+                this->completed.push_back(std::move(request));
+            else
+                this->outstandingRequests--;
+            reader->runningRequest = 0;
+            reader->running        = false;
+            if (reader->requests.empty())
+                reader->scheduled = false;
+            else
+            {
+                this->ready.push_back(reader);
+                this->workAvailable.notify_one();
+            }
+            this->requestFinished.notify_all();
+        }
+    }
+    void Schedule(AsyncReaderData* reader)
+    {
+        if (reader->scheduled)
+            return;
+        reader->scheduled = true;
+        this->ready.push_back(reader);
+        if (this->threads.size() < std::min<>(std::max<>(std::thread::hardware_concurrency(), 1U), MAX_IO_THREADS))
+            this->threads.emplace_back(&AsyncIOPool::Run, this);
+        this->workAvailable.notify_one();
+    }
+    // while reads are pending the application loop must not wait (indefinitely) for input
+    void UpdateFrameRequests()
+    {
+        auto* app = Application::GetApplication();
+        if ((!app) || (!app->terminal))
+            return;
+        const auto needed = this->outstandingRequests > 0;
+        if (needed == this->frameUpdatesRequested)
+            return;
+        if (needed)
+            app->terminal->FrameUpdateRequests++;
+        else
+            app->terminal->FrameUpdateRequests--;
+        this->frameUpdatesRequested = needed;
+    }
+};
+static AsyncIOPool& GetAsyncIOPool()
+{
+    static AsyncIOPool pool;
+    return pool;
+}
+
+#define READER ((AsyncReaderData*) this->data)
+
+AsyncReader::AsyncReader() : data(nullptr)
+{
+}
+AsyncReader::~AsyncReader()
+{
+    Close();
+}
+bool AsyncReader::Create(DataObject* dataObject, OnAsyncReadCompletedInterface* handler)
+{
+    Close();
+    CHECK(dataObject, false, "Expecting a valid (non-null) data object");
+    CHECK(handler, false, "Expecting a valid (non-null) handler");
+    auto* reader           = new AsyncReaderData();
+    reader->dataObject     = dataObject;
+    reader->handler        = handler;
+    reader->runningRequest = 0;
+    reader->scheduled      = false;
+    reader->running        = false;
+    this->data             = reader;
+    return true;
+}
+uint64 AsyncReader::Read(uint64 offset, uint32 size)
+{
+    CHECK(this->data, 0, "Reader was not created");
+    CHECK(size > 0, 0, "Expecting a size bigger than 0");
+    auto& pool = GetAsyncIOPool();
+    std::lock_guard<std::mutex> guard(pool.lock);
+    auto request       = std::make_unique<AsyncReadRequest>();
+    request->reader    = READER;
+    request->id        = ++pool.lastRequestID;
+    request->offset    = offset;
+    request->size      = size;
+    request->succeeded = false;
+    const auto id      = request->id;
+    READER->requests.push_back(std::move(request));
+    pool.outstandingRequests++;
+    pool.Schedule(READER);
+    pool.UpdateFrameRequests();
+    return id;
+}
+bool AsyncReader::Cancel(uint64 requestID)
+{
+    CHECK(this->data, false, "Reader was not created");
+    auto& pool = GetAsyncIOPool();
+    std::lock_guard<std::mutex> guard(pool.lock);
+    auto& requests = READER->requests;
+    for (auto it = requests.begin(); it != requests.end(); it++)
+    {
+        if ((*it)->id == requestID)
+        {
+            requests.erase(it);
+            pool.outstandingRequests--;
+            pool.UpdateFrameRequests();
+            return true;
+        }
+    }
+    if ((requestID != 0) && (READER->runningRequest == requestID))
+    {
+        READER->runningRequest = 0; // the result is dropped once the read is finished
+        return true;
+    }
+    for (auto it = pool.completed.begin(); it != pool.completed.end(); it++)
+    {
+        if ((*it)->id == requestID)
+        {
+            pool.completed.erase(it);
+            pool.outstandingRequests--;
+            pool.UpdateFrameRequests();
+            return true;
+        }
+    }
+    return false;
+}
+uint32 AsyncReader::GetPendingRequestsCount() const
+{
+    if (!this->data)
+        return 0;
+    auto& pool = GetAsyncIOPool();
+    std::lock_guard<std::mutex> guard(pool.lock);
+    uint32 count = (uint32) READER->requests.size() + (READER->runningRequest != 0 ? 1 : 0);
+    for (const auto& request : pool.completed)
+        count += request->reader == READER ? 1 : 0;
+    return count;
+}
+void AsyncReader::Close()
+{
+    if (!this->data)
+        return;
+    auto& pool = GetAsyncIOPool();
+    {
+        std::unique_lock<std::mutex> guard(pool.lock);
+        pool.outstandingRequests -= (uint32) READER->requests.size();
+        READER->requests.clear();
+        READER->runningRequest = 0;
+        for (auto it = pool.ready.begin(); it != pool.ready.end(); it++)
+        {
+            if (*it == READER)
+            {
+                pool.ready.erase(it);
+                READER->scheduled = false;
+                break;
+            }
+        }
+        // the data object (and the reader) must not be used once this method returns
+        pool.requestFinished.wait(guard, [this]() { return !READER->running; });
+        for (auto it = pool.completed.begin(); it != pool.completed.end();)
+        {
+            if ((*it)->reader == READER)
+            {
+                it = pool.completed.erase(it);
+                pool.outstandingRequests--;
+            }
+            else
+                it++;
+        }
+        pool.UpdateFrameRequests();
+    }
+    delete READER;
+    this->data = nullptr;
+}
+uint32 AsyncReader::ProcessCompletions()
+{
+    auto& pool     = GetAsyncIOPool();
+    uint32 handled = 0;
+    while (true)
+    {
+        std::unique_ptr<AsyncReadRequest> request;
+        {
+            std::lock_guard<std::mutex> guard(pool.lock);
+            if (pool.completed.empty())
+            {
+                pool.UpdateFrameRequests();
+                return handled;
+            }
+            request = std::move(pool.completed.front());
+            pool.completed.pop_front();
+            pool.outstandingRequests--;
+        }
+        // the handler can schedule, cancel or close readers (the lock is not held)
+        request->reader->handler->OnAsyncReadCompleted(
+              request->id, request->offset, request->data, request->succeeded);
+        handled++;
+    }
+}
+#undef READER
+} // namespace AppCUI::OS
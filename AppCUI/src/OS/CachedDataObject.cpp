@@ -0,0 +1,248 @@
+#include "Internal.hpp"
+
+#include <unordered_map>
+
+namespace AppCUI::OS
+{
+using namespace Utils;
+
+constexpr uint32 MIN_PAGE_SIZE        = 512;
+constexpr uint32 MIN_PAGES_COUNT      = 2;
+constexpr uint32 MAX_READ_AHEAD_PAGES = 16;
+constexpr uint64 NO_PAGE              = 0xFFFFFFFFFFFFFFFFULL;
+
+struct CachedPage
+{
+    uint8* data;
+    uint64 index; // NO_PAGE for an empty slot
+    uint64 lastUse;
+    uint32 length; // shorter than the page size for the last page of the data
+};
+struct CachedDataObjectData
+{
+    DataObject* dataObject;
+    unique_ptr<uint8[]> memory;
+    vector<CachedPage> pages;
+    std::unordered_map<uint64, uint32> lookup; // page index -> slot
+    Buffer copy;                               // the data of a view over several pages
+    uint64 size;
+    uint64 useCounter;
+    uint64 nextSequentialPage; // the page that follows the last pages that were read
+    uint32 pageSize;
+    uint32 readAheadPages;
+    uint32 lastSlot;
+
+    void Clear()
+    {
+        for (auto& page : this->pages)
+        {
+            page.index   = NO_PAGE;
+            page.lastUse = 0;
+            page.length  = 0;
+        }
+        this->lookup.clear();
+        this->size               = this->dataObject->GetSize();
+        this->nextSequentialPage = NO_PAGE;
+        this->readAheadPages     = 1;
+        this->lastSlot           = 0;
+    }
+    uint32 GetLeastRecentlyUsedSlot()
+    {
+        uint32 oldest = 0;
+        for (uint32 tr = 1; tr < (uint32) this->pages.size(); tr++)
+            if (this->pages[tr].lastUse < this->pages[oldest].lastUse)
+                oldest = tr;
+        return oldest;
+    }
+    // the page and (if the data is read sequentially) the next ones are read with one call
+    bool Load(uint64 index)
+    {
+        if (index == this->nextSequentialPage)
+            this->readAheadPages =
+                  std::min<>({ this->readAheadPages * 2, MAX_READ_AHEAD_PAGES, (uint32) this->pages.size() / 2 });
+        else
+            this->readAheadPages = 1;
+        const auto lastPage = (this->size - 1) / this->pageSize;
+
+        IOBuffer buffers[MAX_READ_AHEAD_PAGES];
+        uint32 slots[MAX_READ_AHEAD_PAGES];
+        uint32 count = 0;
+        // the read ahead stops at the first page that is already cached
+        while ((count < this->readAheadPages) && (index + count <= lastPage) &&
+               ((count == 0) || (this->lookup.find(index + count) == this->lookup.end())))
+        {
+            const auto slot = GetLeastRecentlyUsedSlot();
+            auto& page      = this->pages[slot];
+            if (page.index != NO_PAGE)
+                this->lookup.erase(page.index);
+            page.index     = index + count;
+            page.lastUse   = ++this->useCounter;
+            page.length    = 0;
+            buffers[count] = { page.data, this->pageSize };
+            slots[count]   = slot;
+            this->lookup.emplace(page.index, slot);
+            count++;
+        }
+        if (count == 0)
+            return false; // the page is after the end of the data
+        uint64 bytesRead = 0;
+        const auto ok    = this->dataObject->ReadVector(index * this->pageSize, buffers, count, bytesRead);
+        for (uint32 tr = 0; tr < count; tr++)
+        {
+            auto& page       = this->pages[slots[tr]];
+            const auto start = (uint64) tr * this->pageSize;
+            page.length      = 0;
+            if ((ok) && (bytesRead > start))
+                page.length = (uint32) std::min<>(bytesRead - start, (uint64) this->pageSize);
+            if (page.length == 0)
+            {
+                // not read (or the data is shorter than it was)
+                this->lookup.erase(page.index);
+                page.index   = NO_PAGE;
+                page.lastUse = 0;
+            }
+        }
+        this->nextSequentialPage = index + count;
+        return this->pages[slots[0]].length > 0;
+    }
+    CachedPage* GetPage(uint64 index)
+    {
+        auto* page = &this->pages[this->lastSlot];
+        if (page->index != index)
+        {
+            auto it = this->lookup.find(index);
+            if (it == this->lookup.end())
+            {
+                CHECK(Load(index), nullptr, "Fail to read the page %llu", index);
+                it = this->lookup.find(index);
+            }
+            this->lastSlot = it->second;
+            page           = &this->pages[it->second];
+        }
+        page->lastUse = ++this->useCounter;
+        return page;
+    }
+    uint64 Copy(uint64 offset, uint8* output, uint64 size)
+    {
+        uint64 copied = 0;
+        while ((copied < size) && (offset + copied < this->size))
+        {
+            const auto index = (offset + copied) / this->pageSize;
+            auto* page       = GetPage(index);
+            if (!page)
+                break;
+            const auto start = (uint32) ((offset + copied) - index * this->pageSize);
+            if (start >= page->length)
+                break; // the data is shorter than it was
+            const auto toCopy = std::min<>((uint64) (page->length - start), size - copied);
+            memcpy(output + copied, page->data + start, (size_t) toCopy);
+            copied += toCopy;
+        }
+        return copied;
+    }
+};
+
+#define CACHE ((CachedDataObjectData*) this->data)
+
+CachedDataObject::CachedDataObject() : data(nullptr), pos(0)
+{
+}
+CachedDataObject::~CachedDataObject()
+{
+    Close();
+}
+bool CachedDataObject::Create(DataObject* dataObject, uint32 pageSize, uint32 pagesCount)
+{
+    Close();
+    CHECK(dataObject, false, "Expecting a valid (non-null) data object");
+    CHECK(pageSize >= MIN_PAGE_SIZE, false, "Page size must be at least %u bytes", MIN_PAGE_SIZE);
+    CHECK(pagesCount >= MIN_PAGES_COUNT, false, "At least %u pages are needed", MIN_PAGES_COUNT);
+    auto cache = std::make_unique<CachedDataObjectData>();
+    try
+    {
+        cache->memory = std::make_unique<uint8[]>((size_t) pageSize * (size_t) pagesCount);
+    }
+    catch (...)
+    {
+        RETURNERROR(false, "Fail to allocate %u pages of %u bytes", pagesCount, pageSize);
+    }
+    cache->dataObject = dataObject;
+    cache->pageSize   = pageSize;
+    cache->useCounter = 0;
+    cache->pages.resize(pagesCount);
+    for (uint32 tr = 0; tr < pagesCount; tr++)
+        cache->pages[tr].data = cache->memory.get() + (size_t) tr * pageSize;
+    cache->Clear();
+    this->data = cache.release();
+    this->pos  = 0;
+    return true;
+}
+BufferView CachedDataObject::GetView(uint64 offset, uint32 size)
+{
+    CHECK(this->data, BufferView(), "Cache was not created");
+    if ((offset >= CACHE->size) || (size == 0))
+        return BufferView();
+    const auto end   = std::min<>(offset + size, CACHE->size);
+    const auto index = offset / CACHE->pageSize;
+    if ((end - 1) / CACHE->pageSize == index)
+    {
+        // the most common case (the range is inside a page) --> no copy
+        auto* page = CACHE->GetPage(index);
+        CHECK(page, BufferView(), "Fail to read from offset %llu", offset);
+        const auto start   = offset - index * CACHE->pageSize;
+        const auto pageEnd = std::min<>(end - index * CACHE->pageSize, (uint64) page->length);
+        if (start >= pageEnd)
+            return BufferView(); // the data is shorter than it was
+        return BufferView(page->data + start, (size_t) (pageEnd - start));
+    }
+    CACHE->copy.Resize((size_t) (end - offset));
+    const auto copied = CACHE->Copy(offset, CACHE->copy.GetData(), end - offset);
+    return BufferView(CACHE->copy.GetData(), (size_t) copied);
+}
+void CachedDataObject::Invalidate()
+{
+    if (this->data)
+        CACHE->Clear();
+}
+
+bool CachedDataObject::ReadBuffer(void* buffer, uint32 bufferSize, uint32& bytesRead)
+{
+    bytesRead = 0;
+    CHECK(this->data, false, "Cache was not created");
+    CHECK(buffer, false, "Expecting a valid (non-null) buffer");
+    bytesRead = (uint32) CACHE->Copy(this->pos, reinterpret_cast<uint8*>(buffer), bufferSize);
+    this->pos += bytesRead;
+    return true;
+}
+bool CachedDataObject::WriteBuffer(const void*, uint32, uint32& bytesWritten)
+{
+    bytesWritten = 0;
+    RETURNERROR(false, "A cached data object is read-only");
+}
+
+uint64 CachedDataObject::GetSize()
+{
+    return this->data ? CACHE->size : 0;
+}
+uint64 CachedDataObject::GetCurrentPos()
+{
+    return this->pos;
+}
+bool CachedDataObject::SetSize(uint64)
+{
+    RETURNERROR(false, "A cached data object is read-only");
+}
+bool CachedDataObject::SetCurrentPos(uint64 newPosition)
+{
+    CHECK(newPosition <= GetSize(), false, "Invalid position (%llu) - size is %llu", newPosition, GetSize());
+    this->pos = newPosition;
+    return true;
+}
+void CachedDataObject::Close()
+{
+    delete CACHE;
+    this->data = nullptr;
+    this->pos  = 0;
+}
+#undef CACHE
+} // namespace AppCUI::OS
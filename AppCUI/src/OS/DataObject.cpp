@@ -76,6 +76,39 @@ bool DataObject::Read(uint64 offset, AppCUI::Utils::Buffer& buf, uint32 size)
     }
     return true;
 }
+bool DataObject::ReadVector(uint64 offset, const IOBuffer* buffers, uint32 count, uint64& bytesRead)
+{
+    bytesRead = 0;
+    CHECK((buffers) || (count == 0), false, "Expecting a valid (non-null) list of buffers");
+    // a data object can read less than it was asked (a pipe) --> every buffer is read until it is filled
+    auto readBuffers = [&]() -> bool
+    {
+        CHECK(this->SetCurrentPos(offset), false, "Fail to move cursor to offset: %lld", offset);
+        for (uint32 tr = 0; tr < count; tr++)
+        {
+            uint32 filled = 0;
+            while (filled < buffers[tr].Size)
+            {
+                auto* output    = reinterpret_cast<uint8*>(buffers[tr].Data) + filled;
+                const auto size = buffers[tr].Size - filled;
+                uint32 read     = 0;
+                CHECK(this->ReadBuffer(output, size, read), false, "Fail to read %u bytes", size);
+                if (read == 0)
+                    break; // end of data
+                filled += read;
+            }
+            bytesRead += filled;
+            if (filled < buffers[tr].Size)
+                break;
+        }
+        return true;
+    };
+    // the position is restored even if the read fails
+    const auto originalPos = this->GetCurrentPos();
+    const auto result      = readBuffers();
+    this->SetCurrentPos(originalPos);
+    return result;
+}
 //====================================[WRITE METHODS]=========================================
 bool DataObject::Write(const void* buffer, uint32 bufferSize)
 {
@@ -103,4 +136,35 @@ bool DataObject::Write(uint64 offset, string_view text, uint32& bytesWritten)
 {
     return Write(offset, reinterpret_cast<const void*>(text.data()), static_cast<uint32>(text.length()), bytesWritten);
 }
+bool DataObject::WriteVector(uint64 offset, const BufferView* buffers, uint32 count, uint64& bytesWritten)
+{
+    bytesWritten = 0;
+    CHECK((buffers) || (count == 0), false, "Expecting a valid (non-null) list of buffers");
+    auto writeBuffers = [&]() -> bool
+    {
+        CHECK(this->SetCurrentPos(offset), false, "Fail to move cursor to offset: %lld", offset);
+        for (uint32 tr = 0; tr < count; tr++)
+        {
+            size_t written = 0;
+            while (written < buffers[tr].GetLength())
+            {
+                const auto size = (uint32) std::min<>(buffers[tr].GetLength() - written, (size_t) 0x40000000);
+                uint32 result   = 0;
+                CHECK(this->WriteBuffer(buffers[tr].GetData() + written, size, result),
+                      false,
+                      "Fail to write %u bytes",
+                      size);
+                CHECK(result > 0, false, "Fail to write %u bytes", size);
+                written += result;
+            }
+            bytesWritten += written;
+        }
+        return true;
+    };
+    // the position is restored even if the write fails
+    const auto originalPos = this->GetCurrentPos();
+    const auto result      = writeBuffers();
+    this->SetCurrentPos(originalPos);
+    return result;
+}
 } // namespace AppCUI
\ No newline at end of file
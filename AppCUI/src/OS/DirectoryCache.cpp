@@ -0,0 +1,238 @@
+#include "Internal.hpp"
+
+#include <mutex>
+#ifdef __linux__
+#    include <sys/inotify.h>
+#endif
+
+namespace AppCUI::OS
+{
+#ifdef __linux__
+constexpr uint32 WATCHED_CHANGES = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_MODIFY | IN_ATTRIB |
+                                   IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+#endif
+
+struct CachedDirectory
+{
+    std::string key;
+    std::shared_ptr<const DirectoryEntries> entries;
+    uint64 changes; // incremented every time the directory is changed
+    uint64 lastUse;
+#ifdef __linux__
+    int watch;
+#else
+    std::filesystem::file_time_type modified;
+#endif
+};
+
+// the cache is used from any thread (FileDialog reads directories on a worker thread)
+struct DirectoryCacheData
+{
+    std::mutex lock;
+    vector<std::unique_ptr<CachedDirectory>> directories;
+    uint32 capacity;
+    uint64 useCounter;
+#ifdef __linux__
+    int notifyFD;
+#endif
+
+    DirectoryCacheData() : capacity(DirectoryCache::DEFAULT_CAPACITY), useCounter(0)
+    {
+#ifdef __linux__
+        this->notifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+    }
+    ~DirectoryCacheData()
+    {
+        while (!this->directories.empty())
+            Remove(0);
+#ifdef __linux__
+        if (this->notifyFD >= 0)
+            close(this->notifyFD);
+#endif
+    }
+    static std::string GetKey(const std::filesystem::path& path)
+    {
+        auto p = path.lexically_normal();
+        if ((!p.has_filename()) && (p != p.root_path()))
+            p = p.parent_path(); // trailing separator
+        return p.string();
+    }
+    static void Changed(CachedDirectory* dir)
+    {
+        dir->changes++;
+        dir->entries.reset();
+    }
+    CachedDirectory* Find(const std::string& key)
+    {
+        for (auto& dir : this->directories)
+            if (dir->key == key)
+                return dir.get();
+        return nullptr;
+    }
+    void Remove(size_t index)
+    {
+#ifdef __linux__
+        const auto watch = this->directories[index]->watch;
+        this->directories.erase(this->directories.begin() + index);
+        if (watch < 0)
+            return;
+        for (auto& dir : this->directories)
+            if (dir->watch == watch)
+                return; // the same directory (through a link) is cached twice --> they share the watch
+        inotify_rm_watch(this->notifyFD, watch);
+#else
+        this->directories.erase(this->directories.begin() + index);
+#endif
+    }
+    void Shrink(size_t size)
+    {
+        while (this->directories.size() > size)
+        {
+            size_t oldest = 0;
+            for (size_t tr = 1; tr < this->directories.size(); tr++)
+                if (this->directories[tr]->lastUse < this->directories[oldest]->lastUse)
+                    oldest = tr;
+            Remove(oldest);
+        }
+    }
+    // the changes notified since the last call (there is no need for a separate thread to watch them)
+    void ProcessChanges()
+    {
+#ifdef __linux__
+        alignas(struct inotify_event) char buffer[16384];
+        while (this->notifyFD >= 0)
+        {
+            const auto size = read(this->notifyFD, buffer, sizeof(buffer));
+            if (size <= 0)
+                return; // no other changes (EAGAIN)
+            for (auto pos = 0; pos < size;)
+            {
+                const auto* e = reinterpret_cast<const struct inotify_event*>(buffer + pos);
+                pos += sizeof(struct inotify_event) + e->len;
+                for (auto& dir : this->directories)
+                {
+                    if ((e->mask & IN_Q_OVERFLOW) || (dir->watch == e->wd))
+                        Changed(dir.get());
+                    if ((e->mask & IN_IGNORED) && (dir->watch == e->wd))
+                        dir->watch = -1; // the directory was removed
+                }
+            }
+        }
+#endif
+    }
+    bool IsChanged(CachedDirectory* dir, [[maybe_unused]] const std::filesystem::path& path)
+    {
+#ifdef __linux__
+        return dir->watch < 0;
+#else
+        std::error_code err;
+        return std::filesystem::last_write_time(path, err) != dir->modified;
+#endif
+    }
+};
+static DirectoryCacheData& GetDirectoryCache()
+{
+    static DirectoryCacheData cache;
+    return cache;
+}
+
+std::shared_ptr<const DirectoryEntries> DirectoryCache::Find(const std::filesystem::path& path)
+{
+    auto& cache = GetDirectoryCache();
+    std::lock_guard<std::mutex> guard(cache.lock);
+    cache.ProcessChanges();
+    auto dir = cache.Find(DirectoryCacheData::GetKey(path));
+    if ((!dir) || (!dir->entries))
+        return nullptr;
+    if (cache.IsChanged(dir, path))
+    {
+        DirectoryCacheData::Changed(dir);
+        return nullptr;
+    }
+    dir->lastUse = ++cache.useCounter;
+    return dir->entries;
+}
+uint64 DirectoryCache::BeginRead(const std::filesystem::path& path)
+{
+    auto& cache = GetDirectoryCache();
+    std::lock_guard<std::mutex> guard(cache.lock);
+    cache.ProcessChanges();
+    const auto key = DirectoryCacheData::GetKey(path);
+    auto dir       = cache.Find(key);
+    if (!dir)
+    {
+        cache.Shrink(cache.capacity - 1);
+        auto newDir     = std::make_unique<CachedDirectory>();
+        newDir->key     = key;
+        newDir->changes = 0;
+#ifdef __linux__
+        newDir->watch = -1;
+#endif
+        dir = newDir.get();
+        cache.directories.push_back(std::move(newDir));
+    }
+    dir->lastUse = ++cache.useCounter;
+#ifdef __linux__
+    if (dir->watch < 0)
+        dir->watch = inotify_add_watch(cache.notifyFD, key.c_str(), WATCHED_CHANGES);
+    // without a watch (not enough inotify watches) the directory can not be cached
+    return dir->watch >= 0 ? dir->changes : DirectoryCache::INVALID_TICKET;
+#else
+    // the modified time is read before the entries --> changes made while they are read are detected
+    std::error_code err;
+    dir->modified = std::filesystem::last_write_time(path, err);
+    return err ? DirectoryCache::INVALID_TICKET : dir->changes;
+#endif
+}
+void DirectoryCache::Store(
+      const std::filesystem::path& path, uint64 ticket, std::shared_ptr<const DirectoryEntries> entries)
+{
+    auto& cache = GetDirectoryCache();
+    std::lock_guard<std::mutex> guard(cache.lock);
+    cache.ProcessChanges();
+    auto dir = cache.Find(DirectoryCacheData::GetKey(path));
+    if ((!dir) || (ticket == DirectoryCache::INVALID_TICKET) || (dir->changes != ticket))
+        return; // removed from the cache or changed while it was read
+    dir->entries = std::move(entries);
+    dir->lastUse = ++cache.useCounter;
+}
+
+//=====================================================================================================[API]
+std::shared_ptr<const DirectoryEntries> DirectoryCache::GetEntries(const std::filesystem::path& path)
+{
+    auto entries = Find(path);
+    if (entries)
+        return entries;
+    const auto ticket = BeginRead(path);
+    DirectoryReader reader;
+    CHECK(reader.Open(path), nullptr, "Fail to read: %s", path.string().c_str());
+    auto result = std::make_shared<DirectoryEntries>();
+    DirectoryEntry entry;
+    while (reader.Next(entry))
+        result->push_back(std::move(entry));
+    Store(path, ticket, result);
+    return result;
+}
+void DirectoryCache::Invalidate(const std::filesystem::path& path)
+{
+    auto& cache = GetDirectoryCache();
+    std::lock_guard<std::mutex> guard(cache.lock);
+    auto dir = cache.Find(DirectoryCacheData::GetKey(path));
+    if (dir)
+        DirectoryCacheData::Changed(dir);
+}
+void DirectoryCache::Clear()
+{
+    auto& cache = GetDirectoryCache();
+    std::lock_guard<std::mutex> guard(cache.lock);
+    cache.Shrink(0);
+}
+void DirectoryCache::SetCapacity(uint32 directories)
+{
+    auto& cache = GetDirectoryCache();
+    std::lock_guard<std::mutex> guard(cache.lock);
+    cache.capacity = std::max<>(directories, 1U);
+    cache.Shrink(cache.capacity);
+}
+} // namespace AppCUI::OS
@@ -0,0 +1,129 @@
+#include "Internal.hpp"
+
+namespace AppCUI::OS
+{
+using namespace Utils;
+
+// a 64-bit process can map any file, a 32-bit one should keep most of its address space for other allocations
+constexpr uint64 DEFAULT_ADDRESS_SPACE_BUDGET = sizeof(void*) >= 8 ? 0x10000000000ULL : 0x10000000ULL;
+constexpr uint64 MIN_WINDOW_SIZE              = 0x100000;
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const std::filesystem::path& filePath, uint64 addressSpaceBudget)
+{
+    Close();
+    CHECK(OpenFile(filePath), false, "Fail to open: %s", filePath.string().c_str());
+    if (addressSpaceBudget == 0)
+        addressSpaceBudget = DEFAULT_ADDRESS_SPACE_BUDGET;
+    this->maxWindowSize = std::max<>(addressSpaceBudget, MIN_WINDOW_SIZE);
+    this->pos           = 0;
+    if (this->fileSize == 0)
+        return true; // nothing to map
+    if (!MoveWindow(0))
+    {
+        Close();
+        RETURNERROR(false, "Fail to map: %s", filePath.string().c_str());
+    }
+    return true;
+}
+bool MappedFile::MoveWindow(uint64 offset)
+{
+    if (this->fileSize <= this->maxWindowSize)
+        return MapWindow(0, this->fileSize);
+    // the window starts at the aligned offset --> the data that follows it (sequential reads) is already mapped
+    const auto start = offset - (offset % GetMappingAlignment());
+    return MapWindow(start, std::min<>(this->maxWindowSize, this->fileSize - start));
+}
+BufferView MappedFile::GetView(uint64 offset, uint32 size)
+{
+    if ((offset >= this->fileSize) || (size == 0))
+        return BufferView();
+    const auto end = std::min<>(offset + size, this->fileSize);
+    if ((!this->window) || (offset < this->windowStart) || (end > this->windowStart + this->windowSize))
+    {
+        CHECK(MoveWindow(offset), BufferView(), "Fail to map the file at offset %llu", offset);
+    }
+    const auto viewEnd = std::min<>(end, this->windowStart + this->windowSize);
+    return BufferView(this->window + (offset - this->windowStart), (size_t) (viewEnd - offset));
+}
+bool MappedFile::SetAccessPattern(AccessPattern pattern)
+{
+    this->accessPattern = pattern;
+    if (this->window)
+        ApplyAccessPattern();
+    return true;
+}
+
+bool MappedFile::ReadBuffer(void* buffer, uint32 bufferSize, uint32& bytesRead)
+{
+    bytesRead = 0;
+    CHECK(buffer, false, "Expecting a valid (non-null) buffer");
+    auto* output = reinterpret_cast<uint8*>(buffer);
+    // a read larger than the window is copied through several windows
+    while ((bytesRead < bufferSize) && (this->pos < this->fileSize))
+    {
+        const auto view = GetView(this->pos, bufferSize - bytesRead);
+        CHECK(view.IsValid(), false, "Fail to read from offset %llu", this->pos);
+        memcpy(output + bytesRead, view.GetData(), view.GetLength());
+        bytesRead += (uint32) view.GetLength();
+        this->pos += view.GetLength();
+    }
+    return true;
+}
+bool MappedFile::WriteBuffer(const void*, uint32, uint32& bytesWritten)
+{
+    bytesWritten = 0;
+    RETURNERROR(false, "A mapped file is read-only");
+}
+
+uint64 MappedFile::GetSize()
+{
+    return this->fileSize;
+}
+uint64 MappedFile::GetCurrentPos()
+{
+    return this->pos;
+}
+bool MappedFile::SetSize(uint64)
+{
+    RETURNERROR(false, "A mapped file is read-only");
+}
+bool MappedFile::SetCurrentPos(uint64 newPosition)
+{
+    CHECK(newPosition <= this->fileSize,
+          false,
+          "Invalid position (%llu) - file size is %llu",
+          newPosition,
+          this->fileSize);
+    this->pos = newPosition;
+    return true;
+}
+void MappedFile::Close()
+{
+    UnmapWindow();
+    CloseFile();
+    this->fileSize      = 0;
+    this->maxWindowSize = 0;
+    this->pos           = 0;
+}
+
+BufferView MapWholeFile(MappedFile& file, const std::filesystem::path& path)
+{
+    // no budget --> the whole file is mapped in one window
+    if (!file.Open(path, 0xFFFFFFFFFFFFFFFFULL))
+        return BufferView();
+    const auto size = file.GetSize();
+    if ((size > 0) && (size <= 0xFFFFFFFFULL))
+    {
+        const auto view = file.GetView(0, (uint32) size);
+        if (view.GetLength() == size)
+            return view;
+    }
+    file.Close();
+    return BufferView();
+}
+} // namespace AppCUI::OS
@@ -53,4 +53,28 @@ bool File::WriteContent(const std::filesystem::path& path, string_view text)
     auto buf_sz  = static_cast<size_t>(text.length());
     return WriteContent(path, BufferView(buf_ptr, buf_sz));
 }
+bool File::ReplaceContent(const std::filesystem::path& path, string_view text)
+{
+    CHECK(text.length() < 0xFFFFFFF,
+          false,
+          "Buffer size exceed 0xFFFFF bytes --> cannot create (%s)",
+          path.string().c_str());
+    auto tempPath = path;
+    tempPath += ".tmp";
+    File f;
+    CHECK(f.Create(tempPath, true), false, "Fail to create: %s", tempPath.string().c_str());
+    // the data must be on the disk before the rename (otherwise a crash could leave an empty file)
+    auto result = text.empty() || f.Write(text.data(), (uint32) text.length());
+    result      = result && f.Flush();
+    f.Close();
+    std::error_code err;
+    if (result)
+        std::filesystem::rename(tempPath, path, err);
+    if ((!result) || (err))
+    {
+        std::filesystem::remove(tempPath, err);
+        RETURNERROR(false, "Fail to write %u bytes into %s", (uint32) text.length(), path.string().c_str());
+    }
+    return true;
+}
 } // namespace AppCUI
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "../../Internal.hpp"
+
+#include <dirent.h>
+#ifdef __linux__
+#    include <sys/syscall.h>
+#endif
+
+namespace AppCUI::OS
+{
+// large enough for a few hundred entries per system call
+constexpr uint32 DIRECTORY_BUFFER_SIZE = 64 * 1024;
+
+#ifdef __linux__
+struct LinuxDirent64
+{
+    uint64 d_ino;
+    int64 d_off;
+    uint16 d_reclen;
+    uint8 d_type;
+    char d_name[1];
+};
+#endif
+
+static void ConvertName(const char* name, std::u16string& result)
+{
+    result.clear();
+    const auto* p   = reinterpret_cast<const char8*>(name);
+    const auto* end = p + strlen(name);
+    Utils::UnicodeChar uc;
+    while (p < end)
+    {
+        if ((*p) < 0x80)
+        {
+            result.push_back(*p);
+            p++;
+        }
+        else if (Utils::ConvertUTF8CharToUnicodeChar(p, end, uc))
+        {
+            result.push_back(uc.Value);
+            p += uc.Length;
+        }
+        else
+        {
+            result.push_back(*p); // not a valid UTF-8 sequence
+            p++;
+        }
+    }
+}
+static DirectoryReader::EntryType GetEntryType(uint8 type)
+{
+    switch (type)
+    {
+    case DT_DIR:
+        return DirectoryReader::EntryType::Folder;
+    case DT_LNK:
+    case DT_UNKNOWN:
+        return DirectoryReader::EntryType::Unknown;
+    default:
+        return DirectoryReader::EntryType::File;
+    }
+}
+
+DirectoryReader::DirectoryReader() : fd(-1), dir(nullptr), current(nullptr), bufferSize(0), bufferPos(0)
+{
+}
+DirectoryReader::~DirectoryReader()
+{
+    Close();
+}
+bool DirectoryReader::Open(const std::filesystem::path& path)
+{
+    Close();
+    this->fd = open(path.string().c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    CHECK(this->fd >= 0, false, "ERROR: %s", strerror(errno));
+#ifdef __linux__
+    if (!this->buffer)
+        this->buffer = std::make_unique<uint8[]>(DIRECTORY_BUFFER_SIZE);
+#else
+    // readdir closes the file descriptor when the directory is closed
+    this->dir = fdopendir(this->fd);
+    if (!this->dir)
+    {
+        close(this->fd);
+        this->fd = -1;
+        RETURNERROR(false, "ERROR: %s", strerror(errno));
+    }
+#endif
+    return true;
+}
+void DirectoryReader::Close()
+{
+    if (this->dir)
+        closedir(reinterpret_cast<DIR*>(this->dir));
+    else if (this->fd >= 0)
+        close(this->fd);
+    this->fd         = -1;
+    this->dir        = nullptr;
+    this->current    = nullptr;
+    this->bufferSize = 0;
+    this->bufferPos  = 0;
+}
+bool DirectoryReader::Next(Entry& entry)
+{
+    CHECK(this->fd >= 0, false, "Directory was not opened !");
+    const char* name = nullptr;
+    uint8 type       = DT_UNKNOWN;
+    do
+    {
+#ifdef __linux__
+        if (this->bufferPos >= this->bufferSize)
+        {
+            const auto result = syscall(SYS_getdents64, this->fd, this->buffer.get(), DIRECTORY_BUFFER_SIZE);
+            if (result <= 0)
+                return false; // end of the directory (or an error)
+            this->bufferSize = (uint32) result;
+            this->bufferPos  = 0;
+        }
+        auto* d = reinterpret_cast<LinuxDirent64*>(this->buffer.get() + this->bufferPos);
+        this->bufferPos += d->d_reclen;
+        name = d->d_name;
+        type = d->d_type;
+#else
+        auto* d = readdir(reinterpret_cast<DIR*>(this->dir));
+        if (!d)
+            return false;
+        name = d->d_name;
+        type = d->d_type;
+#endif
+    } while ((name[0] == '.') && ((name[1] == 0) || ((name[1] == '.') && (name[2] == 0))));
+
+    this->current = name;
+    ConvertName(name, entry.Name);
+    entry.Type         = GetEntryType(type);
+    entry.Size         = 0;
+    entry.ModifiedTime = 0;
+    return true;
+}
+bool DirectoryReader::ReadAttributes(Entry& entry)
+{
+    CHECK(this->current, false, "No entry was read !");
+    struct stat st;
+    CHECK(fstatat(this->fd, this->current, &st, 0) == 0, false, "ERROR: %s", strerror(errno));
+    entry.Type         = S_ISDIR(st.st_mode) ? EntryType::Folder : EntryType::File;
+    entry.Size         = (uint64) st.st_size;
+    entry.ModifiedTime = (uint64) st.st_mtime;
+    return true;
+}
+} // namespace AppCUI::OS
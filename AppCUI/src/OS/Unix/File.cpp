@@ -1,9 +1,11 @@
 #include "../../Internal.hpp"
 
+#include <sys/uio.h>
 
 namespace AppCUI::OS
 {
 constexpr int32 INVALID_FILE_HANDLE = -1;
+constexpr int32 IO_VECTORS_PER_CALL = 64;
 
 File::File()
 {
@@ -39,7 +41,7 @@ bool File::Create(const std::filesystem::path& path, bool overwriteExisting)
     Close();
     int fileId =
           open(path.string().c_str(),
-               overwriteExisting ? O_CREAT | O_RDWR | O_EXCL : O_CREAT | O_RDWR,
+               overwriteExisting ? O_CREAT | O_RDWR | O_TRUNC : O_CREAT | O_RDWR | O_EXCL,
                S_IRWXU | S_IRWXG | S_IRWXO);
     CHECK(fileId >= 0, false, "ERROR: %s", strerror(errno));
     this->FileID.fid = fileId;
@@ -104,6 +106,13 @@ bool File::SetCurrentPos(uint64 newPosition)
     return true;
 }
 
+bool File::Flush()
+{
+    CHECK(this->FileID.fid != INVALID_FILE_HANDLE, false, "Invalid file handle.");
+    CHECK(fsync(this->FileID.fid) == 0, false, "ERROR: %s", strerror(errno));
+    return true;
+}
+
 void File::Close()
 {
     if (this->FileID.fid != INVALID_FILE_HANDLE)
@@ -112,4 +121,68 @@ void File::Close()
         this->FileID.fid = INVALID_FILE_HANDLE;
     }
 }
-}
\ No newline at end of file
+
+bool File::ReadVector(uint64 offset, const IOBuffer* buffers, uint32 count, uint64& bytesRead)
+{
+    bytesRead = 0;
+    CHECK(this->FileID.fid != INVALID_FILE_HANDLE, false, "Invalid file handle.");
+    CHECK((buffers) || (count == 0), false, "Invalid NULL list of buffers.");
+    struct iovec vectors[IO_VECTORS_PER_CALL];
+    uint32 index = 0; // the first buffer that is not filled
+    uint64 skip  = 0; // the bytes from buffers[index] that were already read
+    while (index < count)
+    {
+        int32 vectorsCount = 0;
+        for (auto tr = index; (tr < count) && (vectorsCount < IO_VECTORS_PER_CALL); tr++, vectorsCount++)
+        {
+            const auto filled              = tr == index ? skip : 0;
+            vectors[vectorsCount].iov_base = reinterpret_cast<uint8*>(buffers[tr].Data) + filled;
+            vectors[vectorsCount].iov_len  = buffers[tr].Size - filled;
+        }
+        // preadv does not change the file position --> several threads can read the same file
+        const auto result = preadv(this->FileID.fid, vectors, vectorsCount, (off_t) (offset + bytesRead));
+        if ((result < 0) && (errno == EINTR))
+            continue;
+        CHECK(result >= 0, false, "ERROR: %s", strerror(errno));
+        if (result == 0)
+            break; // end of file
+        bytesRead += (uint64) result;
+        skip += (uint64) result;
+        while ((index < count) && (skip >= buffers[index].Size))
+            skip -= buffers[index++].Size;
+    }
+    return true;
+}
+
+bool File::WriteVector(uint64 offset, const Utils::BufferView* buffers, uint32 count, uint64& bytesWritten)
+{
+    bytesWritten = 0;
+    CHECK(this->FileID.fid != INVALID_FILE_HANDLE, false, "Invalid file handle.");
+    CHECK((buffers) || (count == 0), false, "Invalid NULL list of buffers.");
+    struct iovec vectors[IO_VECTORS_PER_CALL];
+    uint32 index = 0;
+    uint64 skip  = 0;
+    while ((index < count) && (skip >= buffers[index].GetLength()))
+        skip -= buffers[index++].GetLength(); // empty buffers
+    while (index < count)
+    {
+        int32 vectorsCount = 0;
+        for (auto tr = index; (tr < count) && (vectorsCount < IO_VECTORS_PER_CALL); tr++, vectorsCount++)
+        {
+            const auto written             = tr == index ? skip : 0;
+            vectors[vectorsCount].iov_base = const_cast<uint8*>(buffers[tr].GetData() + written);
+            vectors[vectorsCount].iov_len  = buffers[tr].GetLength() - written;
+        }
+        const auto result = pwritev(this->FileID.fid, vectors, vectorsCount, (off_t) (offset + bytesWritten));
+        if ((result < 0) && (errno == EINTR))
+            continue;
+        CHECK(result >= 0, false, "ERROR: %s", strerror(errno));
+        CHECK(result > 0, false, "Nothing was written at offset %llu", offset + bytesWritten);
+        bytesWritten += (uint64) result;
+        skip += (uint64) result;
+        while ((index < count) && (skip >= buffers[index].GetLength()))
+            skip -= buffers[index++].GetLength();
+    }
+    return true;
+}
+}
@@ -0,0 +1,83 @@
+#include "../../Internal.hpp"
+
+#include <sys/mman.h>
+
+namespace AppCUI::OS
+{
+constexpr int32 INVALID_FILE_HANDLE = -1;
+
+MappedFile::MappedFile()
+{
+    this->FileID.fid    = INVALID_FILE_HANDLE;
+    this->mappingHandle = nullptr;
+    this->window        = nullptr;
+    this->windowStart   = 0;
+    this->windowSize    = 0;
+    this->maxWindowSize = 0;
+    this->fileSize      = 0;
+    this->pos           = 0;
+    this->accessPattern = AccessPattern::Normal;
+}
+
+uint64 MappedFile::GetMappingAlignment()
+{
+    static const uint64 pageSize = (uint64) sysconf(_SC_PAGESIZE);
+    return pageSize;
+}
+bool MappedFile::OpenFile(const std::filesystem::path& filePath)
+{
+    this->FileID.fid = open(filePath.string().c_str(), O_RDONLY);
+    CHECK(this->FileID.fid >= 0, false, "ERROR: %s", strerror(errno));
+    struct stat st;
+    if (fstat(this->FileID.fid, &st) != 0)
+    {
+        CloseFile();
+        RETURNERROR(false, "ERROR: %s", strerror(errno));
+    }
+    this->fileSize = (uint64) st.st_size;
+    return true;
+}
+void MappedFile::CloseFile()
+{
+    if (this->FileID.fid >= 0)
+        close(this->FileID.fid);
+    this->FileID.fid = INVALID_FILE_HANDLE;
+}
+bool MappedFile::MapWindow(uint64 start, uint64 size)
+{
+    UnmapWindow();
+    auto* ptr = mmap(nullptr, (size_t) size, PROT_READ, MAP_SHARED, this->FileID.fid, (off_t) start);
+    CHECK(ptr != MAP_FAILED, false, "ERROR: %s", strerror(errno));
+    this->window      = reinterpret_cast<const uint8*>(ptr);
+    this->windowStart = start;
+    this->windowSize  = size;
+    // the hint is given for a range of pages --> every new window needs it
+    ApplyAccessPattern();
+    return true;
+}
+void MappedFile::UnmapWindow()
+{
+    if (this->window)
+        munmap(const_cast<uint8*>(this->window), (size_t) this->windowSize);
+    this->window      = nullptr;
+    this->windowStart = 0;
+    this->windowSize  = 0;
+}
+void MappedFile::ApplyAccessPattern()
+{
+    int advice = MADV_NORMAL;
+    switch (this->accessPattern)
+    {
+    case AccessPattern::Sequential:
+        advice = MADV_SEQUENTIAL;
+        break;
+    case AccessPattern::Random:
+        advice = MADV_RANDOM;
+        break;
+    default:
+        break;
+    }
+    // only a hint --> the file can still be read if it fails
+    madvise(const_cast<uint8*>(this->window), (size_t) this->windowSize, advice);
+}
+} // namespace AppCUI::OS
@@ -0,0 +1,66 @@
+#include "Internal.hpp"
+
+namespace AppCUI::OS
+{
+constexpr uint64 WINDOWS_TICKS_PER_SECOND = 10000000ULL;
+constexpr uint64 SECONDS_TO_UNIX_EPOCH    = 11644473600ULL;
+
+DirectoryReader::DirectoryReader() : handle(INVALID_HANDLE_VALUE), hasData(false)
+{
+}
+DirectoryReader::~DirectoryReader()
+{
+    Close();
+}
+bool DirectoryReader::Open(const std::filesystem::path& path)
+{
+    Close();
+    // FindExInfoBasic skips the short (8.3) names and LARGE_FETCH reads more entries per call
+    this->handle = FindFirstFileExW(
+          (path / L"*").wstring().c_str(),
+          FindExInfoBasic,
+          &this->data,
+          FindExSearchNameMatch,
+          nullptr,
+          FIND_FIRST_EX_LARGE_FETCH);
+    CHECK(this->handle != INVALID_HANDLE_VALUE, false, "Fail to open: %s", path.string().c_str());
+    this->hasData = true;
+    return true;
+}
+void DirectoryReader::Close()
+{
+    if (this->handle != INVALID_HANDLE_VALUE)
+        FindClose(this->handle);
+    this->handle  = INVALID_HANDLE_VALUE;
+    this->hasData = false;
+}
+bool DirectoryReader::Next(Entry& entry)
+{
+    CHECK(this->handle != INVALID_HANDLE_VALUE, false, "Directory was not opened !");
+    do
+    {
+        if (!this->hasData)
+        {
+            if (!FindNextFileW(this->handle, &this->data))
+                return false;
+        }
+        this->hasData = false;
+    } while ((this->data.cFileName[0] == L'.') &&
+             ((this->data.cFileName[1] == 0) || ((this->data.cFileName[1] == L'.') && (this->data.cFileName[2] == 0))));
+
+    // the attributes are already known (they are returned with the name)
+    entry.Name = reinterpret_cast<const char16*>(this->data.cFileName);
+    return ReadAttributes(entry);
+}
+bool DirectoryReader::ReadAttributes(Entry& entry)
+{
+    CHECK(this->handle != INVALID_HANDLE_VALUE, false, "Directory was not opened !");
+    const auto ticks = (((uint64) this->data.ftLastWriteTime.dwHighDateTime) << 32) |
+                       this->data.ftLastWriteTime.dwLowDateTime;
+    const auto isFolder = (this->data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+    entry.Type          = isFolder ? EntryType::Folder : EntryType::File;
+    entry.Size          = (((uint64) this->data.nFileSizeHigh) << 32) | this->data.nFileSizeLow;
+    entry.ModifiedTime  = ticks / WINDOWS_TICKS_PER_SECOND - SECONDS_TO_UNIX_EPOCH;
+    return true;
+}
+} // namespace AppCUI::OS
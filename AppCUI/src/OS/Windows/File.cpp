@@ -205,6 +205,13 @@ bool File::SetCurrentPos(uint64 newPosition)
     return true;
 }
 
+bool File::Flush()
+{
+    VALIDATE_FILE_HANLDE(false);
+    CHECK(FlushFileBuffers(F_HNDL), false, "FlushFileBuffers failed !");
+    return true;
+}
+
 void File::Close()
 {
     if (FileID.Handle != INVALID_HANDLE_VALUE)
@@ -213,6 +220,67 @@ void File::Close()
         FileID.Handle = INVALID_HANDLE_VALUE;
     }
 }
+
+// ReadFileScatter/WriteFileGather need unbuffered (page aligned) I/O --> every buffer is transferred with an
+// explicit offset instead
+bool File::ReadVector(uint64 offset, const IOBuffer* buffers, uint32 count, uint64& bytesRead)
+{
+    bytesRead = 0;
+    VALIDATE_FILE_HANLDE(false);
+    CHECK((buffers) || (count == 0), false, "Expecting a valid (non-null) list of buffers !");
+    const auto originalPos = GetCurrentPos();
+    for (uint32 tr = 0; tr < count; tr++)
+    {
+        if (buffers[tr].Size == 0)
+            continue;
+        OVERLAPPED position = {};
+        position.Offset     = (DWORD) ((offset + bytesRead) & 0xFFFFFFFF);
+        position.OffsetHigh = (DWORD) ((offset + bytesRead) >> 32);
+        DWORD nrBytesRead   = 0;
+        if ((!ReadFile(F_HNDL, buffers[tr].Data, buffers[tr].Size, &nrBytesRead, &position)) &&
+            (GetLastError() != ERROR_HANDLE_EOF))
+        {
+            SetCurrentPos(originalPos);
+            RETURNERROR(false, "Reading from file failed with code: %d", GetLastError());
+        }
+        bytesRead += nrBytesRead;
+        if (nrBytesRead < buffers[tr].Size)
+            break; // end of file
+    }
+    // a synchronous handle moves its file pointer even if the offset is explicit
+    SetCurrentPos(originalPos);
+    return true;
+}
+
+bool File::WriteVector(uint64 offset, const Utils::BufferView* buffers, uint32 count, uint64& bytesWritten)
+{
+    bytesWritten = 0;
+    VALIDATE_FILE_HANLDE(false);
+    CHECK((buffers) || (count == 0), false, "Expecting a valid (non-null) list of buffers !");
+    const auto originalPos = GetCurrentPos();
+    for (uint32 tr = 0; tr < count; tr++)
+    {
+        size_t written = 0;
+        while (written < buffers[tr].GetLength())
+        {
+            OVERLAPPED position  = {};
+            position.Offset      = (DWORD) ((offset + bytesWritten) & 0xFFFFFFFF);
+            position.OffsetHigh  = (DWORD) ((offset + bytesWritten) >> 32);
+            const auto size      = (DWORD) std::min<>(buffers[tr].GetLength() - written, (size_t) 0x40000000);
+            DWORD nrBytesWritten = 0;
+            if ((!WriteFile(F_HNDL, buffers[tr].GetData() + written, size, &nrBytesWritten, &position)) ||
+                (nrBytesWritten == 0))
+            {
+                SetCurrentPos(originalPos);
+                RETURNERROR(false, "Writing to file failed with code: %d", GetLastError());
+            }
+            written += nrBytesWritten;
+            bytesWritten += nrBytesWritten;
+        }
+    }
+    SetCurrentPos(originalPos);
+    return true;
+}
 } // namespace AppCUI
 
 #undef VALIDATE_FILE_HANLDE
@@ -0,0 +1,89 @@
+#include "Internal.hpp"
+
+namespace AppCUI::OS
+{
+MappedFile::MappedFile()
+{
+    this->FileID.Handle = INVALID_HANDLE_VALUE;
+    this->mappingHandle = nullptr;
+    this->window        = nullptr;
+    this->windowStart   = 0;
+    this->windowSize    = 0;
+    this->maxWindowSize = 0;
+    this->fileSize      = 0;
+    this->pos           = 0;
+    this->accessPattern = AccessPattern::Normal;
+}
+uint64 MappedFile::GetMappingAlignment()
+{
+    // the offset of a view must be a multiple of the allocation granularity (not of the page size)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (uint64) info.dwAllocationGranularity;
+}
+bool MappedFile::OpenFile(const std::filesystem::path& filePath)
+{
+    this->FileID.Handle = CreateFileW(
+          filePath.wstring().c_str(),
+          GENERIC_READ,
+          FILE_SHARE_READ,
+          nullptr,
+          OPEN_EXISTING,
+          FILE_ATTRIBUTE_NORMAL,
+          nullptr);
+    CHECK(this->FileID.Handle != INVALID_HANDLE_VALUE, false, "Fail to open: %s", filePath.string().c_str());
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx((HANDLE) this->FileID.Handle, &size))
+    {
+        CloseFile();
+        RETURNERROR(false, "Fail to read the size of: %s", filePath.string().c_str());
+    }
+    this->fileSize = (uint64) size.QuadPart;
+    if (this->fileSize == 0)
+        return true; // an empty file can not be mapped
+    this->mappingHandle = CreateFileMappingW((HANDLE) this->FileID.Handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (this->mappingHandle == nullptr)
+    {
+        CloseFile();
+        RETURNERROR(false, "Fail to create a file mapping for: %s", filePath.string().c_str());
+    }
+    return true;
+}
+void MappedFile::CloseFile()
+{
+    if (this->mappingHandle)
+        CloseHandle(this->mappingHandle);
+    if (this->FileID.Handle != INVALID_HANDLE_VALUE)
+        CloseHandle((HANDLE) this->FileID.Handle);
+    this->mappingHandle = nullptr;
+    this->FileID.Handle = INVALID_HANDLE_VALUE;
+}
+bool MappedFile::MapWindow(uint64 start, uint64 size)
+{
+    UnmapWindow();
+    auto* ptr = MapViewOfFile(
+          this->mappingHandle,
+          FILE_MAP_READ,
+          (DWORD) (start >> 32),
+          (DWORD) (start & 0xFFFFFFFF),
+          (SIZE_T) size);
+    CHECK(ptr, false, "Fail to map %llu bytes from offset %llu", size, start);
+    this->window      = reinterpret_cast<const uint8*>(ptr);
+    this->windowStart = start;
+    this->windowSize  = size;
+    ApplyAccessPattern();
+    return true;
+}
+void MappedFile::UnmapWindow()
+{
+    if (this->window)
+        UnmapViewOfFile(this->window);
+    this->window      = nullptr;
+    this->windowStart = 0;
+    this->windowSize  = 0;
+}
+void MappedFile::ApplyAccessPattern()
+{
+    // there is no equivalent of madvise for a view of a file (the memory manager detects sequential reads by itself)
+}
+} // namespace AppCUI::OS
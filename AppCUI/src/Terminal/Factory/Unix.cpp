@@ -1,6 +1,7 @@
 #include "../TerminalFactory.hpp"
 #include "../TestTerminal/TestTerminal.hpp"
 #include "../SDLTerminal/SDLTerminal.hpp"
+#include "../SDLTerminal/SDLHeadlessTerminal.hpp"
 #include "../NcursesTerminal/NcursesTerminal.hpp"
 
 namespace AppCUI::Internal
@@ -18,6 +19,8 @@ static unique_ptr<AbstractTerminal> GetTerminalImpl(FrontendType frontend)
         return std::make_unique<SDLTerminal>();
     case FrontendType::Tests:
         return std::make_unique<TestTerminal>();
+    case FrontendType::SDLHeadless:
+        return std::make_unique<SDLHeadlessTerminal>();
     }
     RETURNERROR(nullptr, "Unsuported terminal type for UNIX OS (%d)", (uint32) frontend);
 }
@@ -2,6 +2,7 @@
 #include "../WindowsTerminal/WindowsTerminal.hpp"
 #include "../TestTerminal/TestTerminal.hpp"
 #include "../SDLTerminal/SDLTerminal.hpp"
+#include "../SDLTerminal/SDLHeadlessTerminal.hpp"
 
 namespace AppCUI::Internal
 {
@@ -22,6 +23,9 @@ unique_ptr<AbstractTerminal> GetTerminal(const InitializationData& initData)
     case FrontendType::Tests:
         term = std::make_unique<TestTerminal>();
         break;
+    case FrontendType::SDLHeadless:
+        term = std::make_unique<SDLHeadlessTerminal>();
+        break;
     default:
         RETURNERROR(nullptr, "Unsuported terminal type for Windows OS (%d)", (uint32) initData.Frontend);
     }
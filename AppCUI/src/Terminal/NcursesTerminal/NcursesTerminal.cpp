@@ -72,8 +72,10 @@ static val get_self_path(void)
 
 namespace AppCUI::Internal
 {
-bool NcursesTerminal::OnInit(const Application::InitializationData&)
+bool NcursesTerminal::OnInit(const Application::InitializationData& initData)
 {
+    autoRedraw = (initData.Flags & Application::InitializationFlags::EnableFPSMode) !=
+                 Application::InitializationFlags::None;
     bool setTerminInfo = false;
     if(const char* terminfo = std::getenv("TERMINFO"))
     {
@@ -2,6 +2,7 @@
 
 #include "../../Internal.hpp"
 #include <array>
+#include <chrono>
 #include <ncursesw/ncurses.h>
 
 /*
@@ -56,6 +57,8 @@ namespace Internal
         std::map<int, Input::Key> keyTranslationMatrix;
         ColorManager colors;
         TerminalMode mode;
+        std::chrono::time_point<std::chrono::steady_clock> lastFramesUpdate;
+        bool autoRedraw;
 
       public:
         virtual bool OnInit(const Application::InitializationData& initData) override;
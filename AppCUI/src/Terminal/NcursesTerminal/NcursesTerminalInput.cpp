@@ -179,6 +179,7 @@ void NcursesTerminal::GetSystemEvent(Internal::SystemEvent& evnt)
     evnt.eventType        = SystemEventType::None;
     evnt.keyCode          = Key::None;
     evnt.unicodeCharacter = 0;
+    evnt.updateFrames     = false;
     // select on stdin with timeout, should  translate to about ~30 fps
     pollfd readFD;
     readFD.fd     = STDIN_FILENO;
@@ -186,6 +187,17 @@ void NcursesTerminal::GetSystemEvent(Internal::SystemEvent& evnt)
     // poll for 30 milliseconds
     poll(&readFD, 1, 30);
 
+    if ((autoRedraw) || (FrameUpdateRequests > 0))
+    {
+        // a new frame every 33 ms (even if keys are pressed continuously)
+        const auto now = std::chrono::steady_clock::now();
+        if (now - lastFramesUpdate >= std::chrono::milliseconds(33))
+        {
+            evnt.updateFrames = true;
+            lastFramesUpdate  = now;
+        }
+    }
+
     int c = getch();
     if (c == ERR)
     {
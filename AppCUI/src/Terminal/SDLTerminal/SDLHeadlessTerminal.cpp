@@ -0,0 +1,71 @@
+#include "SDLHeadlessTerminal.hpp"
+#include <chrono>
+
+namespace AppCUI::Internal
+{
+using namespace Application;
+
+bool SDLHeadlessTerminal::OnInit(const InitializationData& initData)
+{
+    CHECK(TestTerminal::OnInit(initData), false, "");
+    // same size as the script driven canvas (TestTerminal picks a default one if none was provided)
+    auto sdlInitData   = initData;
+    sdlInitData.Width  = ScreenCanvas.GetWidth();
+    sdlInitData.Height = ScreenCanvas.GetHeight();
+    CHECK(sdl.InitOffscreen(sdlInitData), false, "Fail to initialize SDL headless rendering");
+    return true;
+}
+void SDLHeadlessTerminal::OnUnInit()
+{
+    sdl.UnInitOffscreen();
+    TestTerminal::OnUnInit();
+}
+void SDLHeadlessTerminal::OnFlushToScreen()
+{
+    const auto width  = ScreenCanvas.GetWidth();
+    const auto height = ScreenCanvas.GetHeight();
+    if ((sdl.ScreenCanvas.GetWidth() != width) || (sdl.ScreenCanvas.GetHeight() != height))
+    {
+        CHECKRET(sdl.ScreenCanvas.Resize(width, height), "Fail to resize SDL canvas to %u x %u", width, height);
+        CHECKRET(sdl.ResizeOffscreen(width, height), "Fail to resize SDL offscreen surface to %u x %u", width, height);
+    }
+    sdl.ScreenCanvas.DrawCanvas(0, 0, ScreenCanvas);
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    sdl.OnFlushToScreen();
+    const auto end = std::chrono::high_resolution_clock::now();
+    frameTimes.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+void SDLHeadlessTerminal::OnFlushToScreen(const Graphics::Rect& /*r*/)
+{
+    OnFlushToScreen();
+}
+bool SDLHeadlessTerminal::GetGlyphCacheStats(Application::GlyphCacheStats& stats)
+{
+    return sdl.GetGlyphCacheStats(stats);
+}
+bool SDLHeadlessTerminal::SaveFrame(const std::filesystem::path& path)
+{
+    return sdl.SaveFrameToPNG(path);
+}
+void SDLHeadlessTerminal::PrintRenderTime()
+{
+    if (frameTimes.empty())
+    {
+        std::cout << "No frames rendered" << std::endl;
+        return;
+    }
+    uint64 total = 0;
+    uint64 minim = frameTimes[0];
+    uint64 maxim = frameTimes[0];
+    for (auto t : frameTimes)
+    {
+        total += t;
+        minim = std::min<>(minim, t);
+        maxim = std::max<>(maxim, t);
+    }
+    std::cout << "Frame #" << frameTimes.size() << ": " << (frameTimes.back() / 1000) << " us (avg: "
+              << (total / frameTimes.size() / 1000) << " us, min: " << (minim / 1000) << " us, max: " << (maxim / 1000)
+              << " us)" << std::endl;
+}
+} // namespace AppCUI::Internal
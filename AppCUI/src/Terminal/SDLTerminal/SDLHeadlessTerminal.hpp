@@ -0,0 +1,30 @@
+#pragma once
+
+#include "SDLTerminal.hpp"
+#include "../TestTerminal/TestTerminal.hpp"
+
+namespace AppCUI
+{
+namespace Internal
+{
+    // Script driven terminal (same commands as TestTerminal) that also renders every frame through the SDL frontend
+    // into an offscreen surface. Frames can be saved as PNG (Frame.Save) and the render time of each frame is
+    // recorded (Frame.PrintRenderTime) - useful for benchmarks and golden images on machines without a display.
+    class SDLHeadlessTerminal : public TestTerminal
+    {
+        SDLTerminal sdl;
+        std::vector<uint64> frameTimes; // nanoseconds
+
+      public:
+        virtual bool OnInit(const Application::InitializationData& initData) override;
+        virtual void OnUnInit() override;
+        virtual void OnFlushToScreen() override;
+        virtual void OnFlushToScreen(const Graphics::Rect& r) override;
+        virtual bool GetGlyphCacheStats(Application::GlyphCacheStats& stats) override;
+
+      protected:
+        virtual bool SaveFrame(const std::filesystem::path& path) override;
+        virtual void PrintRenderTime() override;
+    };
+} // namespace Internal
+} // namespace AppCUI
@@ -4,7 +4,7 @@
 #include "SDL.h"
 #include "SDL_ttf.h"
 #include <iterator>
-#include <unordered_map>
+#include <vector>
 
 namespace AppCUI
 {
@@ -21,13 +21,46 @@ namespace Internal
         SDL_Window* window;
         Uint32 windowID;
         SDL_Renderer* renderer;
+        SDL_Surface* offscreenSurface; // headless mode: the renderer draws into this surface (no window)
+        uint32 glyphCacheMemory;
         std::unique_ptr<char[]> fontBuffer;
         TTF_Font* font;
         size_t charWidth;
         size_t charHeight;
         bool autoRedraw;
 
-        std::unordered_map<uint32, SDL_Texture*> characterCache;
+        // glyph atlas: every glyph is rendered once (white, with alpha) in a cell sized slot of a single texture
+        // and colorized at draw time through the vertex colors; slot 0 is a solid white cell used for backgrounds
+        // the number of slots is bounded by a memory budget, the least recently used glyph being evicted first
+        SDL_Texture* glyphAtlas;
+        SDL_Surface* glyphSlotSurface;
+        uint32 atlasColumns;
+        uint32 atlasSlotsCount;
+        uint32 atlasUsedSlots;
+        float slotWidthUV;
+        float slotHeightUV;
+        std::vector<uint32> glyphSlots; // char16 -> atlas slot (0 = not loaded)
+        std::vector<char16> slotGlyph;  // atlas slot -> char16
+        std::vector<uint32> slotBatch;  // atlas slot -> last batch that referenced it
+        std::vector<uint32> lruPrev;
+        std::vector<uint32> lruNext;
+        uint32 lruHead;
+        uint32 lruTail;
+        uint32 currentBatch;
+        uint64 glyphCacheHits;
+        uint64 glyphCacheMisses;
+        uint64 glyphCacheEvictions;
+        uint64 glyphCacheBudget;
+
+        // retained frame (only the cells that changed since the previous flush are redrawn)
+        SDL_Texture* frameTexture;
+        std::vector<Graphics::Character> previousFrame;
+        uint32 previousFrameWidth;
+        uint32 previousFrameHeight;
+
+        // batch of quads submitted with a single SDL_RenderGeometry call
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
 
       public:
         virtual bool OnInit(const Application::InitializationData& initData) override;
@@ -39,6 +72,13 @@ namespace Internal
         virtual bool IsEventAvailable() override;
         virtual void RestoreOriginalConsoleSettings() override;
         virtual bool HasSupportFor(Application::SpecialCharacterSetType type) override;
+        virtual bool GetGlyphCacheStats(Application::GlyphCacheStats& stats) override;
+
+        // headless mode (software rendering into an offscreen surface, no window and no input)
+        bool InitOffscreen(const Application::InitializationData& initData);
+        bool ResizeOffscreen(uint32 width, uint32 height);
+        bool SaveFrameToPNG(const std::filesystem::path& path);
+        void UnInitOffscreen();
 
       private:
         bool InitScreen(const Application::InitializationData& initData);
@@ -53,8 +93,14 @@ namespace Internal
         void HandleKeyUp(SystemEvent& evt, const SDL_Event& eSdl);
         void HandleKeyDown(SystemEvent& evt, const SDL_Event& eSdl);
 
-        SDL_Texture* RenderCharacter(
-              const uint32 charPacked, const char16_t charCode, const SDL_Color& fg, const SDL_Color& bg);
+        bool InitGlyphAtlas(uint32 memoryBudget);
+        void UnInitGlyphAtlas();
+        void UnlinkGlyphSlot(uint32 slot);
+        void PushFrontGlyphSlot(uint32 slot);
+        uint32 GetGlyphSlot(char16 charCode);
+        bool CreateFrameTexture(uint32 width, uint32 height);
+        void AddQuad(const SDL_Rect& r, uint32 slot, SDL_Color color);
+        void FlushBatch();
     };
 } // namespace Internal
 } // namespace AppCUI
@@ -170,14 +170,14 @@ void SDLTerminal::GetSystemEvent(Internal::SystemEvent& evnt)
     // wait 33 ms max for the next event, equates to roughly 30 fps
     if (!SDL_WaitEventTimeout(&e, 33))
     {
-        if (autoRedraw)
+        if ((autoRedraw) || (FrameUpdateRequests > 0))
         {
             evnt.updateFrames = true;
         }
         return;
     }
 
-    if (autoRedraw)
+    if ((autoRedraw) || (FrameUpdateRequests > 0))
     {
         auto pollTime = std::chrono::high_resolution_clock::now();
         auto diffMS   = std::chrono::duration_cast<std::chrono::milliseconds>(pollTime - lastFramesUpdate);
@@ -239,6 +239,10 @@ void SDLTerminal::GetSystemEvent(Internal::SystemEvent& evnt)
             evnt.mouseWheel = Input::MouseWheel::Left;
         }
         break;
+    case SDL_RENDER_TARGETS_RESET:
+        // the retained frame texture was lost --> the next flush must redraw every cell
+        this->previousFrameWidth = 0;
+        break;
     default:
         break;
     }
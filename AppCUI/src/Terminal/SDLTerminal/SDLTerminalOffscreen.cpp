@@ -0,0 +1,88 @@
+#include "SDLTerminal.hpp"
+#include <lodepng.h>
+
+namespace AppCUI::Internal
+{
+using namespace Application;
+
+// Headless mode: the same glyph atlas / batched rendering as the windowed mode, but done by a software renderer
+// into an offscreen surface. No window is created and no video subsystem is required, so it works with
+// SDL_VIDEODRIVER=offscreen or dummy (CI machines without a display).
+bool SDLTerminal::InitOffscreen(const InitializationData& initData)
+{
+    window           = nullptr;
+    windowID         = 0;
+    renderer         = nullptr;
+    glyphAtlas       = nullptr;
+    glyphSlotSurface = nullptr;
+    frameTexture     = nullptr;
+    offscreenSurface = nullptr;
+    glyphCacheMemory = initData.GlyphCacheMemory;
+    autoRedraw       = false;
+    CHECK((initData.Width > 0) && (initData.Height > 0), false, "Headless mode requires a size (width and height)");
+    CHECK(SDL_Init(0) == 0, false, "Failed to initialize SDL: %s", SDL_GetError());
+    CHECK(InitFont(initData), false, "Unable to init font");
+    CHECK(ScreenCanvas.Create(initData.Width, initData.Height),
+          false,
+          "Fail to create an internal canvas of %d x %d size",
+          initData.Width,
+          initData.Height);
+    CHECK(OriginalScreenCanvas.Create(initData.Width, initData.Height),
+          false,
+          "Fail to create the original screen canvas of %d x %d size",
+          initData.Width,
+          initData.Height);
+    return ResizeOffscreen(initData.Width, initData.Height);
+}
+bool SDLTerminal::ResizeOffscreen(uint32 width, uint32 height)
+{
+    // the atlas and the retained frame belong to the renderer --> they are recreated together with it
+    UnInitGlyphAtlas();
+    if (renderer)
+        SDL_DestroyRenderer(renderer);
+    if (offscreenSurface)
+        SDL_FreeSurface(offscreenSurface);
+    renderer = nullptr;
+
+    offscreenSurface = SDL_CreateRGBSurfaceWithFormat(
+          0,
+          static_cast<int>(width * charWidth),
+          static_cast<int>(height * charHeight),
+          32,
+          SDL_PIXELFORMAT_ARGB8888);
+    CHECK(offscreenSurface, false, "Failed to create an offscreen surface: %s", SDL_GetError());
+    renderer = SDL_CreateSoftwareRenderer(offscreenSurface);
+    CHECK(renderer, false, "Failed to initialize SDL software renderer: %s", SDL_GetError());
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+    CHECK(InitGlyphAtlas(glyphCacheMemory), false, "Failed to initialize the glyph atlas");
+    return true;
+}
+bool SDLTerminal::SaveFrameToPNG(const std::filesystem::path& path)
+{
+    CHECK(renderer, false, "SDL renderer was not initialized !");
+    int width  = 0;
+    int height = 0;
+    CHECK(SDL_GetRendererOutputSize(renderer, &width, &height) == 0,
+          false,
+          "Failed to get the renderer size: %s",
+          SDL_GetError());
+    std::vector<uint8> pixels(static_cast<size_t>(width) * height * 4);
+    CHECK(SDL_RenderReadPixels(renderer, nullptr, SDL_PIXELFORMAT_RGBA32, pixels.data(), width * 4) == 0,
+          false,
+          "Failed to read the frame pixels: %s",
+          SDL_GetError());
+
+    uint8* png     = nullptr;
+    size_t pngSize = 0;
+    auto err       = lodepng_encode_memory(&png, &pngSize, pixels.data(), width, height, LodePNGColorType::LCT_RGBA, 8);
+    CHECK(err == 0, false, "Failed to encode frame as PNG: %s", lodepng_error_text(err));
+    const auto result = AppCUI::OS::File::WriteContent(path, Utils::BufferView(png, pngSize));
+    free(png);
+    CHECK(result, false, "Failed to write frame to %s", path.string().c_str());
+    return true;
+}
+void SDLTerminal::UnInitOffscreen()
+{
+    UnInitScreen();
+}
+} // namespace AppCUI::Internal
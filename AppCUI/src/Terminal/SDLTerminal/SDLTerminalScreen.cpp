@@ -120,6 +120,10 @@ bool SDLTerminal::InitFont(const InitializationData& initData)
 
 bool SDLTerminal::InitScreen(const InitializationData& initData)
 {
+    glyphAtlas       = nullptr;
+    glyphSlotSurface = nullptr;
+    frameTexture     = nullptr;
+    offscreenSurface = nullptr;
     CHECK(SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS) == 0, false, "Failed to initialize SDL: %s", SDL_GetError());
     CHECK(InitFont(initData), false, "Unable to init font");
 
@@ -181,6 +185,8 @@ bool SDLTerminal::InitScreen(const InitializationData& initData)
           widthInChars,
           heightInChars);
     autoRedraw = (initData.Flags & InitializationFlags::EnableFPSMode) != InitializationFlags::None;
+    glyphCacheMemory = initData.GlyphCacheMemory;
+    CHECK(InitGlyphAtlas(glyphCacheMemory), false, "Failed to initialize the glyph atlas");
     return true;
 }
 
@@ -215,64 +221,322 @@ int codePageConversions(const int ch)
     return ch;
 }
 
-SDL_Texture* SDLTerminal::RenderCharacter(
-      const uint32 charPacked, const char16_t charCode, const SDL_Color& fg, const SDL_Color& bg)
+constexpr uint32 GLYPH_MISSING       = 0xFFFFFFFF;
+constexpr uint32 SOLID_SLOT          = 0;
+constexpr uint32 MAX_ATLAS_SIZE      = 2048;
+constexpr uint32 MAX_QUADS_PER_BATCH = 8192;
+constexpr uint32 MIN_GLYPH_SLOTS     = 256;
+
+constexpr uint32 DEFAULT_GLYPH_CACHE_MEMORY = 8 * 1024 * 1024;
+
+inline SDL_Color ToSDLColor(Graphics::Color color)
+{
+    return appcuiColorToSDLColor[static_cast<uint8>(color) % NR_COLORS];
+}
+
+bool SDLTerminal::InitGlyphAtlas(uint32 memoryBudget)
+{
+    SDL_RendererInfo info;
+    CHECK(SDL_GetRendererInfo(renderer, &info) == 0, false, "Failed to query SDL renderer: %s", SDL_GetError());
+    uint32 atlasWidth  = MAX_ATLAS_SIZE;
+    uint32 atlasHeight = MAX_ATLAS_SIZE;
+    if ((info.max_texture_width > 0) && (static_cast<uint32>(info.max_texture_width) < atlasWidth))
+        atlasWidth = static_cast<uint32>(info.max_texture_width);
+    if ((info.max_texture_height > 0) && (static_cast<uint32>(info.max_texture_height) < atlasHeight))
+        atlasHeight = static_cast<uint32>(info.max_texture_height);
+
+    // the memory budget decides how many glyphs are kept (4 bytes per pixel), within the limits of a texture
+    const uint32 maxColumns = atlasWidth / static_cast<uint32>(charWidth);
+    const uint32 maxSlots   = maxColumns * (atlasHeight / static_cast<uint32>(charHeight));
+    CHECK(maxSlots > MIN_GLYPH_SLOTS, false, "Font is too large for a glyph atlas of %u x %u", atlasWidth, atlasHeight);
+    if (memoryBudget == 0)
+        memoryBudget = DEFAULT_GLYPH_CACHE_MEMORY;
+    const uint32 slotSize  = static_cast<uint32>(charWidth * charHeight * 4);
+    this->atlasSlotsCount  = std::clamp<uint32>(memoryBudget / slotSize, MIN_GLYPH_SLOTS, maxSlots);
+    this->atlasColumns     = std::min<uint32>(maxColumns, this->atlasSlotsCount);
+    const uint32 atlasRows = (this->atlasSlotsCount + this->atlasColumns - 1) / this->atlasColumns;
+    this->glyphCacheBudget = static_cast<uint64>(this->atlasSlotsCount) * slotSize;
+
+    this->glyphAtlas = SDL_CreateTexture(
+          renderer,
+          SDL_PIXELFORMAT_ARGB8888,
+          SDL_TEXTUREACCESS_STATIC,
+          static_cast<int>(this->atlasColumns * charWidth),
+          static_cast<int>(atlasRows * charHeight));
+    CHECK(this->glyphAtlas, false, "Failed to create the glyph atlas: %s", SDL_GetError());
+    SDL_SetTextureBlendMode(this->glyphAtlas, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(this->glyphAtlas, SDL_ScaleModeNearest);
+    this->slotWidthUV  = 1.0f / this->atlasColumns;
+    this->slotHeightUV = 1.0f / atlasRows;
+
+    this->glyphSlotSurface = SDL_CreateRGBSurfaceWithFormat(
+          0, static_cast<int>(charWidth), static_cast<int>(charHeight), 32, SDL_PIXELFORMAT_ARGB8888);
+    CHECK(this->glyphSlotSurface, false, "Failed to create the glyph surface: %s", SDL_GetError());
+
+    // slot 0 --> solid cell (used to draw the background of a run of cells)
+    SDL_FillRect(this->glyphSlotSurface, nullptr, 0xFFFFFFFF);
+    SDL_Rect r = { 0, 0, static_cast<int>(charWidth), static_cast<int>(charHeight) };
+    CHECK(SDL_UpdateTexture(this->glyphAtlas, &r, this->glyphSlotSurface->pixels, this->glyphSlotSurface->pitch) == 0,
+          false,
+          "Failed to update the glyph atlas: %s",
+          SDL_GetError());
+
+    this->atlasUsedSlots = 1;
+    this->glyphSlots.assign(0x10000, 0);
+    this->slotGlyph.assign(this->atlasSlotsCount, 0);
+    this->slotBatch.assign(this->atlasSlotsCount, 0);
+    this->lruPrev.assign(this->atlasSlotsCount, 0);
+    this->lruNext.assign(this->atlasSlotsCount, 0);
+    this->lruHead             = 0;
+    this->lruTail             = 0;
+    this->currentBatch        = 1;
+    this->glyphCacheHits      = 0;
+    this->glyphCacheMisses    = 0;
+    this->glyphCacheEvictions = 0;
+    return true;
+}
+void SDLTerminal::UnInitGlyphAtlas()
 {
-    if (characterCache.find(charPacked) != characterCache.end())
+    if (this->frameTexture)
+        SDL_DestroyTexture(this->frameTexture);
+    if (this->glyphAtlas)
+        SDL_DestroyTexture(this->glyphAtlas);
+    if (this->glyphSlotSurface)
+        SDL_FreeSurface(this->glyphSlotSurface);
+    this->frameTexture     = nullptr;
+    this->glyphAtlas       = nullptr;
+    this->glyphSlotSurface = nullptr;
+    this->glyphSlots.clear();
+    this->slotGlyph.clear();
+    this->slotBatch.clear();
+    this->lruPrev.clear();
+    this->lruNext.clear();
+    this->previousFrame.clear();
+}
+// LRU list over the atlas slots (0 is the solid slot, so it doubles as the "null" link)
+void SDLTerminal::UnlinkGlyphSlot(uint32 slot)
+{
+    const auto prev = this->lruPrev[slot];
+    const auto next = this->lruNext[slot];
+    if (prev)
+        this->lruNext[prev] = next;
+    else
+        this->lruHead = next;
+    if (next)
+        this->lruPrev[next] = prev;
+    else
+        this->lruTail = prev;
+}
+void SDLTerminal::PushFrontGlyphSlot(uint32 slot)
+{
+    this->lruPrev[slot] = 0;
+    this->lruNext[slot] = this->lruHead;
+    if (this->lruHead)
+        this->lruPrev[this->lruHead] = slot;
+    else
+        this->lruTail = slot;
+    this->lruHead = slot;
+}
+uint32 SDLTerminal::GetGlyphSlot(char16 charCode)
+{
+    auto slot = this->glyphSlots[charCode];
+    if (slot == GLYPH_MISSING)
+        return GLYPH_MISSING;
+    if (slot != 0)
+    {
+        this->glyphCacheHits++;
+        if (slot != this->lruHead)
+        {
+            UnlinkGlyphSlot(slot);
+            PushFrontGlyphSlot(slot);
+        }
+        this->slotBatch[slot] = this->currentBatch;
+        return slot;
+    }
+    this->glyphCacheMisses++;
+    SDL_Surface* glyph = TTF_RenderGlyph_Blended(font, codePageConversions(charCode), SDL_Color{ 255, 255, 255, 255 });
+    if (glyph == nullptr)
+    {
+        this->glyphSlots[charCode] = GLYPH_MISSING;
+        return GLYPH_MISSING;
+    }
+    // copy the glyph (including its alpha channel) over an empty cell
+    SDL_FillRect(this->glyphSlotSurface, nullptr, 0);
+    SDL_SetSurfaceBlendMode(glyph, SDL_BLENDMODE_NONE);
+    SDL_BlitSurface(glyph, nullptr, this->glyphSlotSurface, nullptr);
+    SDL_FreeSurface(glyph);
+
+    if (this->atlasUsedSlots < this->atlasSlotsCount)
+    {
+        slot = this->atlasUsedSlots++;
+    }
+    else
     {
-        return characterCache[charPacked];
+        // evict the least recently used glyph
+        slot = this->lruTail;
+        // if it is referenced by the queued quads, all slots are --> draw them before reusing the slot
+        if (this->slotBatch[slot] == this->currentBatch)
+            FlushBatch();
+        UnlinkGlyphSlot(slot);
+        this->glyphSlots[this->slotGlyph[slot]] = 0;
+        this->glyphCacheEvictions++;
     }
-    SDL_Surface* glyphSurface = TTF_RenderGlyph_Shaded(font, charCode, fg, bg);
-    if (glyphSurface == nullptr)
+    SDL_Rect r;
+    r.x = static_cast<int>((slot % this->atlasColumns) * charWidth);
+    r.y = static_cast<int>((slot / this->atlasColumns) * charHeight);
+    r.w = static_cast<int>(charWidth);
+    r.h = static_cast<int>(charHeight);
+    SDL_UpdateTexture(this->glyphAtlas, &r, this->glyphSlotSurface->pixels, this->glyphSlotSurface->pitch);
+    this->glyphSlots[charCode] = slot;
+    this->slotGlyph[slot]      = charCode;
+    this->slotBatch[slot]      = this->currentBatch;
+    PushFrontGlyphSlot(slot);
+    return slot;
+}
+bool SDLTerminal::GetGlyphCacheStats(Application::GlyphCacheStats& stats)
+{
+    CHECK(this->glyphAtlas, false, "Glyph cache was not initialized !");
+    stats.Hits         = this->glyphCacheHits;
+    stats.Misses       = this->glyphCacheMisses;
+    stats.Evictions    = this->glyphCacheEvictions;
+    stats.UsedGlyphs   = this->atlasUsedSlots - 1;
+    stats.MaxGlyphs    = this->atlasSlotsCount - 1;
+    stats.MemoryBudget = this->glyphCacheBudget;
+    return true;
+}
+bool SDLTerminal::CreateFrameTexture(uint32 width, uint32 height)
+{
+    if (this->frameTexture)
     {
-        characterCache[charPacked] = nullptr;
-        return nullptr;
+        SDL_DestroyTexture(this->frameTexture);
+        this->frameTexture = nullptr;
     }
-    SDL_Texture* glyphTexture = SDL_CreateTextureFromSurface(renderer, glyphSurface);
-    // SDL_FreeSurface(glyphSurface);
-    characterCache[charPacked] = glyphTexture;
-    return glyphTexture;
+    this->previousFrameWidth  = width;
+    this->previousFrameHeight = height;
+    this->previousFrame.assign(static_cast<size_t>(width) * height, Graphics::Character{});
+    if (SDL_RenderTargetSupported(renderer) == SDL_FALSE)
+        return false;
+    this->frameTexture = SDL_CreateTexture(
+          renderer,
+          SDL_PIXELFORMAT_ARGB8888,
+          SDL_TEXTUREACCESS_TARGET,
+          static_cast<int>(width * charWidth),
+          static_cast<int>(height * charHeight));
+    return this->frameTexture != nullptr;
+}
+void SDLTerminal::AddQuad(const SDL_Rect& r, uint32 slot, SDL_Color color)
+{
+    if (vertices.size() >= MAX_QUADS_PER_BATCH * 4)
+        FlushBatch();
+
+    const float u1 = (slot % this->atlasColumns) * this->slotWidthUV;
+    const float v1 = (slot / this->atlasColumns) * this->slotHeightUV;
+    const float u2 = u1 + this->slotWidthUV;
+    const float v2 = v1 + this->slotHeightUV;
+    const float x1 = static_cast<float>(r.x);
+    const float y1 = static_cast<float>(r.y);
+    const float x2 = static_cast<float>(r.x + r.w);
+    const float y2 = static_cast<float>(r.y + r.h);
+
+    const int first = static_cast<int>(vertices.size());
+    vertices.push_back(SDL_Vertex{ { x1, y1 }, color, { u1, v1 } });
+    vertices.push_back(SDL_Vertex{ { x2, y1 }, color, { u2, v1 } });
+    vertices.push_back(SDL_Vertex{ { x2, y2 }, color, { u2, v2 } });
+    vertices.push_back(SDL_Vertex{ { x1, y2 }, color, { u1, v2 } });
+    for (auto idx : { 0, 1, 2, 0, 2, 3 })
+        indices.push_back(first + idx);
+}
+void SDLTerminal::FlushBatch()
+{
+    if (vertices.empty())
+        return;
+    SDL_RenderGeometry(
+          renderer,
+          this->glyphAtlas,
+          vertices.data(),
+          static_cast<int>(vertices.size()),
+          indices.data(),
+          static_cast<int>(indices.size()));
+    vertices.clear();
+    indices.clear();
+    this->currentBatch++;
 }
 
-// A very basic flush to screen
-// It will draw each character as a separate texture
-// Optimizations would be welcome, like drawing an entire string of text with the same colors
+// Every glyph lives in a single atlas texture and the frame is sent to SDL as one batch of quads:
+// - a background quad (the solid slot of the atlas) for every run of changed cells with the same background
+// - a glyph quad for every visible character, colorized through its vertex colors
+// When render targets are supported, the frame is retained in a texture and only the cells that changed since
+// the previous flush are redrawn.
 void SDLTerminal::OnFlushToScreen()
 {
-    SDL_RenderClear(renderer);
     Graphics::Character* charsBuffer = this->ScreenCanvas.GetCharactersBuffer();
-    const std::size_t width          = ScreenCanvas.GetWidth();
-    const std::size_t height         = ScreenCanvas.GetHeight();
-
-    SDL_Rect WindowRect;
-    WindowRect.w = charWidth;
-    WindowRect.h = charHeight;
-
-    for (std::size_t y = 0; y < height; y++)
+    const uint32 width               = ScreenCanvas.GetWidth();
+    const uint32 height              = ScreenCanvas.GetHeight();
+    const int cw                     = static_cast<int>(charWidth);
+    const int ch                     = static_cast<int>(charHeight);
+
+    bool fullRedraw = (this->frameTexture == nullptr) || (width != this->previousFrameWidth) ||
+                      (height != this->previousFrameHeight);
+    if (fullRedraw)
+        CreateFrameTexture(width, height);
+
+    if (this->frameTexture)
+        SDL_SetRenderTarget(renderer, this->frameTexture);
+    else
+        SDL_RenderClear(renderer);
+
+    for (uint32 y = 0; y < height; y++)
     {
-        for (std::size_t x = 0; x < width; x++)
+        const Graphics::Character* row = charsBuffer + static_cast<size_t>(y) * width;
+        Graphics::Character* prev      = this->previousFrame.data() + static_cast<size_t>(y) * width;
+        uint32 x                       = 0;
+        while (x < width)
         {
-            Graphics::Character ch = charsBuffer[y * width + x];
-
-            SDL_Texture* glyphTexture = RenderCharacter(
-                  ch.PackedValue,
-                  codePageConversions(ch.Code),
-                  appcuiColorToSDLColor[(char) ch.Color.Foreground],
-                  appcuiColorToSDLColor[(char) ch.Color.Background]);
-
-            if (glyphTexture != nullptr)
+            if ((!fullRedraw) && (row[x].PackedValue == prev[x].PackedValue))
+            {
+                x++;
+                continue;
+            }
+            // run of changed cells that share the same background
+            const uint32 start = x;
+            const auto back    = row[x].Color.Background;
+            while ((x < width) && (row[x].Color.Background == back) &&
+                   (fullRedraw || (row[x].PackedValue != prev[x].PackedValue)))
+            {
+                x++;
+            }
+            AddQuad({ static_cast<int>(start) * cw, static_cast<int>(y) * ch, static_cast<int>(x - start) * cw, ch },
+                    SOLID_SLOT,
+                    ToSDLColor(back));
+            for (uint32 i = start; i < x; i++)
             {
-                WindowRect.x = charWidth * x;
-                WindowRect.y = charHeight * y;
-                SDL_RenderCopy(renderer, glyphTexture, nullptr, &WindowRect);
+                prev[i] = row[i];
+                if ((row[i].Code == 0) || (row[i].Code == ' '))
+                    continue;
+                const auto slot = GetGlyphSlot(row[i].Code);
+                if (slot != GLYPH_MISSING)
+                {
+                    AddQuad({ static_cast<int>(i) * cw, static_cast<int>(y) * ch, cw, ch },
+                            slot,
+                            ToSDLColor(row[i].Color.Foreground));
+                }
             }
         }
     }
+    FlushBatch();
+
+    if (this->frameTexture)
+    {
+        SDL_Rect r = { 0, 0, static_cast<int>(width) * cw, static_cast<int>(height) * ch };
+        SDL_SetRenderTarget(renderer, nullptr);
+        SDL_RenderClear(renderer);
+        SDL_RenderCopy(renderer, this->frameTexture, nullptr, &r);
+    }
     SDL_RenderPresent(renderer);
 }
 void SDLTerminal::OnFlushToScreen(const Graphics::Rect& /*r*/)
 {
-    // No implementation for the moment, copy the entire screem
+    // only the changed cells are redrawn anyway
     OnFlushToScreen();
 }
 
@@ -292,14 +556,14 @@ bool SDLTerminal::HasSupportFor(Application::SpecialCharacterSetType /*type*/)
 }
 void SDLTerminal::UnInitScreen()
 {
-    for (const auto& cacheItem : characterCache)
-    {
-        SDL_DestroyTexture(cacheItem.second);
-    }
+    UnInitGlyphAtlas();
 
     TTF_CloseFont(font);
     SDL_DestroyRenderer(renderer);
-    SDL_DestroyWindow(window);
+    if (window)
+        SDL_DestroyWindow(window);
+    if (offscreenSurface)
+        SDL_FreeSurface(offscreenSurface);
     SDL_Quit();
 }
 } // namespace AppCUI::Internal
\ No newline at end of file
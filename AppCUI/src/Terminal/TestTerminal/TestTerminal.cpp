@@ -27,6 +27,8 @@ struct
     { "Print", TestTerminal::CommandID::Print, 0 /**/ },
     { "PrintScreenHash", TestTerminal::CommandID::PrintScreenHash, 1 /*with colors*/ },
     { "ValidateScreenHash", TestTerminal::CommandID::ValidateScreenHash, 2 /*hash, with colors*/ },
+    { "Frame.Save", TestTerminal::CommandID::SaveFrame, 1 /* file name (PNG) */ },
+    { "Frame.PrintRenderTime", TestTerminal::CommandID::PrintRenderTime, 0 /**/ },
 };
 
 const char* SkipSpaces(const char* start, const char* end)
@@ -194,6 +196,22 @@ void TestTerminal::AddPrintScreenHashCommand(const std::string_view* params)
     cmd.Params[0].boolValue = withColors.value();
     this->commandsQueue.push(cmd);
 }
+void TestTerminal::AddSaveFrameCommand(const std::string_view* params)
+{
+    ASSERT(params[0].size() > 0, "First parameter (file name) must not be empty -> (in Frame.Save(fileName)");
+    Command cmd(CommandID::SaveFrame);
+    cmd.Params[0].u32Value = static_cast<uint32>(this->stringParams.size());
+    this->stringParams.emplace_back(params[0]);
+    this->commandsQueue.push(cmd);
+}
+bool TestTerminal::SaveFrame(const std::filesystem::path& /*path*/)
+{
+    RETURNERROR(false, "Frame.Save is not supported by this terminal (use the SDLHeadless frontend)");
+}
+void TestTerminal::PrintRenderTime()
+{
+    std::cout << "Frame.PrintRenderTime is not supported by this terminal (use the SDLHeadless frontend)" << std::endl;
+}
 void TestTerminal::AddMouseHoldCommand(const std::string_view* params)
 {
     Command cmd(CommandID::MouseHold);
@@ -468,6 +486,12 @@ void TestTerminal::CreateEventsQueue(std::string_view commandsScript, bool* _scr
         case TestTerminal::CommandID::Print:
             this->commandsQueue.emplace(CommandID::Print);
             break;
+        case TestTerminal::CommandID::SaveFrame:
+            AddSaveFrameCommand(params);
+            break;
+        case TestTerminal::CommandID::PrintRenderTime:
+            this->commandsQueue.emplace(CommandID::PrintRenderTime);
+            break;
         default:
             ASSERT(false, "Internal error (code path to a command ID was not treated !");
             break;
@@ -591,6 +615,15 @@ void TestTerminal::GetSystemEvent(Internal::SystemEvent& evnt)
                   (static_cast<uint64>(cmd.Params[0].u32Value) << 32) | static_cast<uint64>(cmd.Params[1].u32Value),
                   cmd.Params[2].boolValue);
             break;
+        case CommandID::SaveFrame:
+            evnt.eventType = SystemEventType::None;
+            if ((!SaveFrame(this->stringParams[cmd.Params[0].u32Value])) && (this->scriptValidationResult))
+                (*this->scriptValidationResult) = false;
+            break;
+        case CommandID::PrintRenderTime:
+            evnt.eventType = SystemEventType::None;
+            PrintRenderTime();
+            break;
         case CommandID::MouseClick:
         case CommandID::KeyType:
         case CommandID::KeyPressMultipleTimes:
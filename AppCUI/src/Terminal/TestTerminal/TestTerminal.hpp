@@ -28,7 +28,9 @@ namespace Internal
             ResizeTerminal,
             Print,
             PrintScreenHash,
-            ValidateScreenHash
+            ValidateScreenHash,
+            SaveFrame,
+            PrintRenderTime
         };
         struct Command
         {
@@ -49,6 +51,7 @@ namespace Internal
 
       protected:
         std::queue<Command> commandsQueue;
+        std::vector<std::string> stringParams; // string parameters (commands keep an index into this vector)
         bool* scriptValidationResult;
 
         uint64 ComputeHash(bool useColors);
@@ -65,9 +68,14 @@ namespace Internal
         void AddTerminalResizeCommand(const std::string_view* params);
         void AddValidateHashCommand(const std::string_view* params);
         void AddPrintScreenHashCommand(const std::string_view* params);
+        void AddSaveFrameCommand(const std::string_view* params);
         void PrintCurrentScreen();
         void PrintScreenHash(bool withColors);
         void ValidateScreenHash(uint64 hashToValidate, bool withColors);
+
+        // frame related commands (only terminals that actually render frames support them)
+        virtual bool SaveFrame(const std::filesystem::path& path);
+        virtual void PrintRenderTime();
       public:
         TestTerminal();
 
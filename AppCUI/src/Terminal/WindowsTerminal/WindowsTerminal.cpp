@@ -529,7 +529,7 @@ void WindowsTerminal::GetSystemEvent(Internal::SystemEvent& evnt)
 
     evnt.eventType    = SystemEventType::None;
     evnt.updateFrames = false;
-    if (this->fpsMode)
+    if ((this->fpsMode) || (this->FrameUpdateRequests > 0))
     {
         DWORD cTime = GetTickCount();
         DWORD diff  = 33;
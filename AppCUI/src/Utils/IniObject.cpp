@@ -1,6 +1,15 @@
 #include "Internal.hpp"
 
-#include <unordered_map>
+#include <atomic>
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#    include <emmintrin.h>
+#    define APPCUI_INI_SCANNER_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define APPCUI_INI_SCANNER_NEON
+#endif
 
 using namespace AppCUI;
 using namespace Utils;
@@ -22,8 +31,7 @@ using BuffPtr = const uint8*;
 #define WRITE_INI_NUMERIC_VALUE                                                                                        \
     PREPARE_VALUE;                                                                                                     \
     NumericFormatter n;                                                                                                \
-    iniValue->KeyValue = n.ToDec(value);                                                                               \
-    iniValue->KeyValues.clear();
+    iniValue->SetValue(n.ToDec(value));
 
 #define VALIDATE_INITED(returnValue)                                                                                   \
     CHECK(Data, returnValue, "Parser object has not been created. Have you called one of the Crete... methods first ?");
@@ -141,6 +149,25 @@ constexpr uint32 INI_VALUE_NO    = 0x6F6EU;
 constexpr uint32 INI_VALUE_TRUE  = 0x65757274U;
 constexpr uint32 INI_VALUE_FALSE = 0x736C6166;
 
+// character classes the scanner looks for
+constexpr uint32 SCAN_NEW_LINE   = 0x01;
+constexpr uint32 SCAN_COMMENT    = 0x02;
+constexpr uint32 SCAN_QUOTE      = 0x04; // both ' and "
+constexpr uint32 SCAN_BLOCK_SIZE = 64;
+
+constexpr uint32 POOL_FIRST_CHUNK_SIZE = 64;
+constexpr uint32 POOL_MAX_CHUNK_SIZE   = 65536;
+constexpr uint32 HASH_TABLE_MIN_SIZE   = 8;
+constexpr uint64 HASH_SLOT_EMPTY       = 0;
+constexpr uint64 HASH_SLOT_DELETED     = 1;
+
+// offsets in the source text (the parsed or the last saved text) of the values and sections
+constexpr uint32 NO_SOURCE       = 0xFFFFFFFF; // created after the text was parsed (or the text is too large)
+constexpr size_t MAX_SOURCE_SIZE = 0xFFFFFFF0;
+
+// incremented every time a value or a section (from any IniObject) is changed - the auto-save checks it first
+static std::atomic<uint64> Ini_ChangesCounter{ 0 };
+
 namespace AppCUI
 {
 namespace Ini
@@ -152,30 +179,389 @@ namespace Ini
         ExpectingValue,
         ExpectingArray
     };
-    struct Value
+
+    // bitmaps (one bit for every character of a 64 bytes block) with the positions of the characters of each class
+    struct ScannerBlock
+    {
+        uint64 NewLine;
+        uint64 Comment;
+        uint64 Quote;
+    };
+    // finds the next character of a class without checking the characters one by one - a block is classified (16
+    // bytes at a time where SIMD instructions are available) the first time the parser reaches it
+    class Scanner
+    {
+        BuffPtr start;
+        BuffPtr end;
+        size_t blockIndex;
+        ScannerBlock block;
+
+        void Classify(size_t index);
+
+      public:
+        void Init(BuffPtr bufferStart, BuffPtr bufferEnd)
+        {
+            start      = bufferStart;
+            end        = bufferEnd;
+            blockIndex = SIZE_MAX;
+        }
+        // the position of the first character (starting with "from") from one of the classes or the end of the buffer
+        template <uint32 classes>
+        inline BuffPtr Find(BuffPtr from)
+        {
+            while (from < end)
+            {
+                const auto offset = (size_t) (from - start);
+                const auto index  = offset / SCAN_BLOCK_SIZE;
+                if (index != blockIndex)
+                    Classify(index);
+                uint64 bits = 0;
+                if constexpr ((classes & SCAN_NEW_LINE) != 0)
+                    bits |= block.NewLine;
+                if constexpr ((classes & SCAN_COMMENT) != 0)
+                    bits |= block.Comment;
+                if constexpr ((classes & SCAN_QUOTE) != 0)
+                    bits |= block.Quote;
+                bits >>= (offset % SCAN_BLOCK_SIZE);
+                if (bits)
+                    return std::min<>(from + std::countr_zero(bits), end);
+                from = start + (index + 1) * SCAN_BLOCK_SIZE;
+            }
+            return end;
+        }
+    };
+
+    // objects are allocated in chunks that never move (IniSection and IniValue keep pointers to them)
+    template <typename T>
+    class Pool
+    {
+        struct Chunk
+        {
+            unique_ptr<T[]> Items;
+            uint32 Size;
+            uint32 Used;
+        };
+        vector<Chunk> chunks;
+
+      public:
+        T* Allocate(uint32 count)
+        {
+            if (chunks.empty() || (chunks.back().Used + count > chunks.back().Size))
+            {
+                // chunks get bigger as the pool grows --> small files need only a few small allocations
+                auto size = POOL_MAX_CHUNK_SIZE;
+                if (chunks.size() < 16)
+                    size = std::min<>(POOL_FIRST_CHUNK_SIZE << chunks.size(), POOL_MAX_CHUNK_SIZE);
+                size = std::max<>(size, count);
+                chunks.push_back({ std::make_unique<T[]>(size), size, 0 });
+            }
+            auto& chunk = chunks.back();
+            auto* res   = chunk.Items.get() + chunk.Used;
+            chunk.Used += count;
+            return res;
+        }
+        template <typename Callback>
+        void ForEach(Callback callback)
+        {
+            for (auto& chunk : chunks)
+                for (uint32 index = 0; index < chunk.Used; index++)
+                    callback(chunk.Items[index]);
+        }
+        void Clear()
+        {
+            chunks.clear();
+        }
+    };
+
+    // open addressing (linear probing) - the key is the case insensitive hash of a name
+    template <typename T>
+    class HashTable
+    {
+      public:
+        struct Slot
+        {
+            uint64 Hash;
+            T* Object; // nullptr for an empty (HASH_SLOT_EMPTY) or a deleted (HASH_SLOT_DELETED) slot
+        };
+        struct Iterator
+        {
+            const Slot* Current;
+            const Slot* End;
+
+            Iterator(const Slot* current, const Slot* end) : Current(current), End(end)
+            {
+                SkipEmptySlots();
+            }
+            inline void SkipEmptySlots()
+            {
+                while ((Current < End) && (Current->Object == nullptr))
+                    Current++;
+            }
+            inline Iterator& operator++()
+            {
+                Current++;
+                SkipEmptySlots();
+                return *this;
+            }
+            inline bool operator!=(const Iterator& it) const
+            {
+                return Current != it.Current;
+            }
+            inline T* operator*() const
+            {
+                return Current->Object;
+            }
+        };
+
+      private:
+        vector<Slot> slots;
+        uint32 count;
+        uint32 usedSlots; // objects and deleted slots (a lookup stops only on an empty slot)
+
+        void Resize(size_t size)
+        {
+            vector<Slot> oldSlots(size, Slot{ HASH_SLOT_EMPTY, nullptr });
+            std::swap(oldSlots, slots);
+            const auto mask = slots.size() - 1;
+            for (auto& slot : oldSlots)
+            {
+                if (slot.Object == nullptr)
+                    continue;
+                auto index = slot.Hash & mask;
+                while (slots[index].Object)
+                    index = (index + 1) & mask;
+                slots[index] = slot;
+            }
+            usedSlots = count;
+        }
+
+      public:
+        HashTable() : count(0), usedSlots(0)
+        {
+        }
+        T* Find(uint64 hash) const
+        {
+            if (slots.empty())
+                return nullptr;
+            const auto mask = slots.size() - 1;
+            for (auto index = hash & mask;; index = (index + 1) & mask)
+            {
+                const auto& slot = slots[index];
+                if (slot.Object)
+                {
+                    if (slot.Hash == hash)
+                        return slot.Object;
+                }
+                else if (slot.Hash == HASH_SLOT_EMPTY)
+                    return nullptr;
+            }
+        }
+        // the hash must not be already in the table
+        void Insert(uint64 hash, T* object)
+        {
+            // keep at least 25% of the slots empty
+            if ((usedSlots + 1) * 4 > slots.size() * 3)
+            {
+                size_t size = HASH_TABLE_MIN_SIZE;
+                while (size < (count + 1) * 2)
+                    size <<= 1;
+                Resize(size);
+            }
+            const auto mask = slots.size() - 1;
+            auto index      = hash & mask;
+            while (slots[index].Object)
+                index = (index + 1) & mask;
+            if (slots[index].Hash == HASH_SLOT_EMPTY)
+                usedSlots++;
+            slots[index] = Slot{ hash, object };
+            count++;
+        }
+        void Remove(uint64 hash)
+        {
+            if (slots.empty())
+                return;
+            const auto mask = slots.size() - 1;
+            for (auto index = hash & mask;; index = (index + 1) & mask)
+            {
+                auto& slot = slots[index];
+                if ((slot.Object) && (slot.Hash == hash))
+                {
+                    slot = Slot{ HASH_SLOT_DELETED, nullptr };
+                    count--;
+                    return;
+                }
+                if ((slot.Object == nullptr) && (slot.Hash == HASH_SLOT_EMPTY))
+                    return;
+            }
+        }
+        void Clear()
+        {
+            slots.clear();
+            count     = 0;
+            usedSlots = 0;
+        }
+        inline uint32 Count() const
+        {
+            return count;
+        }
+        inline Iterator begin() const
+        {
+            return Iterator(slots.data(), slots.data() + slots.size());
+        }
+        inline Iterator end() const
+        {
+            return Iterator(slots.data() + slots.size(), slots.data() + slots.size());
+        }
+    };
+
+    // text of a value that was changed (or created) after the parsing
+    struct ValueText
     {
         std::string KeyName;
         std::string KeyValue;
         vector<std::string> KeyValues;
-        Value()
+        vector<string_view> Items;
+    };
+    // a parsed value refers to the parsed text (a mapped file or a copy of the parsed string) and it is copied only
+    // when it is changed or when a '\0' terminated string is needed
+    struct Value
+    {
+        string_view KeyName;
+        string_view KeyValue;
+        const string_view* Items; // array values
+        uint32 ItemsCount;
+        uint32 SourceStart; // the key name
+        uint32 SourceEnd;   // the end of the value (including the quotes or the array brackets)
+        bool Changed;       // a value from the source text that has to be rewritten
+        unique_ptr<ValueText> Text;
+
+        Value() : Items(nullptr), ItemsCount(0), SourceStart(NO_SOURCE), SourceEnd(NO_SOURCE), Changed(false)
+        {
+        }
+        void MarkChanged()
+        {
+            Changed = true;
+            Ini_ChangesCounter.fetch_add(1, std::memory_order_relaxed);
+        }
+        void Reset()
         {
+            KeyValue   = string_view();
+            Items      = nullptr;
+            ItemsCount = 0;
+            Text.reset();
+        }
+        ValueText& Own()
+        {
+            if (!Text)
+            {
+                Text           = std::make_unique<ValueText>();
+                Text->KeyValue = KeyValue;
+                Text->KeyValues.reserve(ItemsCount);
+                for (uint32 index = 0; index < ItemsCount; index++)
+                    Text->KeyValues.emplace_back(Items[index]);
+                Text->Items.assign(Text->KeyValues.begin(), Text->KeyValues.end());
+                KeyValue = Text->KeyValue;
+                Items    = ItemsCount > 0 ? Text->Items.data() : nullptr;
+            }
+            return *Text;
         }
-        Value(string_view keyName)
+        void SetName(string_view name)
         {
-            KeyName = keyName;
+            auto& text   = Own();
+            text.KeyName = name;
+            KeyName      = text.KeyName;
+            MarkChanged();
+        }
+        void SetValue(string_view value)
+        {
+            MarkChanged();
+            auto& text    = Own();
+            text.KeyValue = value;
+            text.KeyValues.clear();
+            text.Items.clear();
+            KeyValue   = text.KeyValue;
+            Items      = nullptr;
+            ItemsCount = 0;
+        }
+        vector<std::string>& EditArray()
+        {
+            MarkChanged();
+            auto& text = Own();
+            text.KeyValues.clear();
+            return text.KeyValues;
+        }
+        // after the values returned by EditArray were set
+        void SetArray()
+        {
+            auto& text = *Text;
+            text.KeyValue.clear();
+            text.Items.assign(text.KeyValues.begin(), text.KeyValues.end());
+            KeyValue   = text.KeyValue;
+            Items      = text.Items.empty() ? nullptr : text.Items.data();
+            ItemsCount = (uint32) text.Items.size();
+        }
+        const char* GetCString()
+        {
+            return Own().KeyValue.c_str();
+        }
+        const char* GetItemCString(uint32 index)
+        {
+            CHECK(index < ItemsCount, nullptr, "Invalid array index: %u (array has %u values)", index, ItemsCount);
+            return Own().KeyValues[index].c_str();
         }
     };
+    struct Parser;
     struct Section
     {
-        Utils::String Name;
-        std::unordered_map<uint64, Value> Keys;
-        Section()
-        {
-        }
-        Section(string_view name)
+        string_view Name;
+        std::string OwnedName; // for the sections that were created (not parsed)
+        HashTable<Value> Keys;
+        Parser* Owner;
+        uint32 SourceStart; // the '[' character of the section header
+        uint32 SourceEnd;   // the end of the header or of the last value (new values are added after this line)
+
+        Section() : Owner(nullptr), SourceStart(NO_SOURCE), SourceEnd(NO_SOURCE)
         {
-            Name.Set(name.data(), (uint32) name.length());
         }
+        void RemoveValue(uint64 hash);
+        void RemoveAllValues();
+    };
+    struct SourceRange
+    {
+        uint32 Start;
+        uint32 End;
+    };
+    enum class SourceEditType : uint8
+    {
+        InsertValues,
+        Remove,
+        ReplaceValue,
+        AppendSection
+    };
+    // a change of the source text: [Start, End) is replaced with [OutputStart, OutputEnd) from the saved text
+    struct SourceEdit
+    {
+        uint32 Start;
+        uint32 End;
+        uint32 OutputStart;
+        uint32 OutputEnd;
+        SourceEditType Type;
+        bool Skipped;    // inside a removed section
+        Value* Target;   // the value that is replaced
+        Section* Parent; // the section whose values are inserted (or appended)
+    };
+    // a section can be written several times in the same text
+    struct SectionHeader
+    {
+        uint32 Start;
+        uint64 Hash;
+    };
+    // the position (in the saved text) of a value that was added to a section
+    struct InsertedValue
+    {
+        Value* Target;
+        uint32 Start;
+        uint32 End;
     };
     struct Parser
     {
@@ -183,15 +569,45 @@ namespace Ini
         BuffPtr end;
         BuffPtr current;
         ParseState state;
+        Scanner scanner;
         std::string toStringBuffer;
 
-        std::unordered_map<uint64, unique_ptr<Ini::Section>> Sections;
+        // the parsed text - either a mapped file (FileView is the whole file) or a copy of a string
+        OS::MappedFile File;
+        BufferView FileView;
+        unique_ptr<char[]> Text;
+
+        HashTable<Section> Sections;
         Section DefaultSection; // KeyValue entries that do not have a section name (writtem directly in the root)
         Section* CurrentSection;
         uint64 CurrentKeyHash;
         BuffPtr CurrentKeyNamePtr;
         uint32 CurrentKeyNameLen;
 
+        Pool<Section> SectionsPool;
+        Pool<Value> ValuesPool;
+        Pool<string_view> ItemsPool;
+        vector<string_view> ArrayItems; // items of the array that is being parsed
+
+        // the text that was parsed (or saved) last time - a save only rewrites the parts that were changed
+        string_view Source;
+        std::string SavedText;
+        std::filesystem::path SourceFile; // the file that has the content of Source (if any)
+        bool HasSource;
+        vector<SectionHeader> SectionHeaders; // sorted by their start
+        vector<SourceRange> RemovedValues;
+        vector<uint32> RemovedSections;
+        vector<SourceEdit> Edits;
+        vector<InsertedValue> InsertedValues;
+
+        // debounced save (see IniObject::EnableAutoSave)
+        std::filesystem::path AutoSaveFile;
+        std::chrono::milliseconds AutoSaveDelay;
+        std::chrono::steady_clock::time_point AutoSaveLastChange;
+        uint64 AutoSaveChanges;
+        bool AutoSaveEnabled;
+        bool AutoSavePending;
+
         inline void SkipSpaces();
         inline void SkipArrayDelimiters();
         inline void SkipNewLine();
@@ -201,40 +617,94 @@ namespace Ini
         inline void SkipSingleLineWord(BuffPtr& wordEnds);
         inline void SkipArrayWord();
 
+        Parser() : AutoSaveDelay(0), AutoSaveChanges(0), AutoSaveEnabled(false), AutoSavePending(false)
+        {
+            DefaultSection.Owner = this;
+            Clear();
+        }
         void SetError(const char*)
         {
         }
         bool AddSection(BuffPtr nameStart, BuffPtr nameEnd);
-        bool AddValue(BuffPtr valueStart, BuffPtr valueEnd);
-        bool AddArrayValue(Ini::Value& value, BuffPtr valueStart, BuffPtr valueEnd);
+        bool AddValue(BuffPtr valueStart, BuffPtr valueEnd, BuffPtr sourceEnd);
+        void SetValueSource(Value& value, BuffPtr valueEnd);
+        bool AddArray();
         bool ParseState_ExpectingKeyOrSection();
         bool ParseState_ExpectingEQ();
         bool ParseState_ExpectingValue();
         bool ParseState_ExpectingArray();
 
+        Value* CreateValue(Section& section, uint64 hash, string_view name);
+        Section* CreateSection(uint64 hash, string_view name);
+        void RemoveSection(uint64 hash);
         bool Parse(BuffPtr bufferStart, BuffPtr bufferEnd);
+        void DetachFromFile();
         void Clear();
+
+        uint32 GetValueStart(const Value& value) const;
+        uint32 GetLineEnd(uint32 offset) const;
+        SourceRange GetRemovedLine(SourceRange range) const;
+        uint32 GetSectionEnd(uint32 headerStart) const;
+        void AddSourceEdits(Section& section);
+        bool WriteChanges(std::string& output);
+        void WriteSourceEdit(SourceEdit& edit, std::string& output);
+        void AcceptChanges(std::string& output, const std::filesystem::path& fileName);
     };
 }; // namespace Ini
 } // namespace AppCUI
 
+// lower-cases 8 characters at once (only 'A'..'Z' are changed, just like Ini_LoweCaseTable)
+inline uint64 Ini_LowerCase8(uint64 chars)
+{
+    const auto ascii       = chars & 0x7F7F7F7F7F7F7F7FULL;
+    const auto aboveA      = ascii + 0x3F3F3F3F3F3F3F3FULL; // high bit set for characters >= 'A'
+    const auto aboveZ      = ascii + 0x2525252525252525ULL; // high bit set for characters >  'Z'
+    const auto upperLetter = aboveA & (~aboveZ) & (~chars) & 0x8080808080808080ULL;
+    return chars | (upperLetter >> 2);
+}
 uint64 __compute_hash__(BuffPtr p_start, BuffPtr p_end)
 {
-    // use FNV algorithm ==> https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function
-    uint64 hash = 0xcbf29ce484222325ULL;
-    while (p_start < p_end)
+    // case insensitive hash, 8 characters per step (the values are never stored so they only need to be consistent
+    // within the same process)
+    uint64 hash = 0xcbf29ce484222325ULL ^ (uint64) (p_end - p_start);
+    uint64 chars;
+    for (; p_start + 8 <= p_end; p_start += 8)
     {
-        hash = hash ^ (Ini_LoweCaseTable[*p_start]);
-        hash = hash * 0x00000100000001B3ULL;
-        p_start++;
+        memcpy(&chars, p_start, 8);
+        hash = (hash ^ Ini_LowerCase8(chars)) * 0x9E3779B97F4A7C15ULL;
+        hash ^= hash >> 32;
     }
+    if (p_start < p_end)
+    {
+        chars = 0;
+        memcpy(&chars, p_start, p_end - p_start);
+        hash = (hash ^ Ini_LowerCase8(chars)) * 0x9E3779B97F4A7C15ULL;
+    }
+    // final mix (the hash table uses the low bits as index)
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
     return hash;
 }
 uint64 __compute_hash__(string_view text)
 {
     return __compute_hash__((BuffPtr) text.data(), ((BuffPtr) text.data()) + text.length());
 }
-void AddSectionValueToString(std::string& res, std::string value)
+int32 CompareNames(string_view name1, string_view name2)
+{
+    const auto size = std::min<>(name1.size(), name2.size());
+    for (size_t index = 0; index < size; index++)
+    {
+        const auto c1 = Ini_LoweCaseTable[(uint8) name1[index]];
+        const auto c2 = Ini_LoweCaseTable[(uint8) name2[index]];
+        if (c1 != c2)
+            return c1 < c2 ? -1 : 1;
+    }
+    if (name1.size() == name2.size())
+        return 0;
+    return name1.size() < name2.size() ? -1 : 1;
+}
+void AddSectionValueToString(std::string& res, string_view value)
 {
     // quick_check
     auto spaces        = 0;
@@ -280,19 +750,16 @@ void AddSectionValueToString(std::string& res, std::string value)
     res += value;
     res += string_separator;
 }
-void AddValueToString(std::string& res,AppCUI::Ini::Value& value)
+void AddValueContentToString(std::string& res, AppCUI::Ini::Value& value)
 {
-    res += value.KeyName;
-    res += " = ";
-    if (value.KeyValues.size() > 0)
+    if (value.ItemsCount > 0)
     {
-        auto sz = value.KeyValues.size();
         res += "[";
-        for (size_t index = 0; index < sz; index++)
+        for (uint32 index = 0; index < value.ItemsCount; index++)
         {
             if (index > 0)
                 res += " , ";
-            AddSectionValueToString(res, value.KeyValues[index]);
+            AddSectionValueToString(res, value.Items[index]);
         }
         res += "]";
     }
@@ -300,12 +767,18 @@ void AddValueToString(std::string& res,AppCUI::Ini::Value& value)
     {
         AddSectionValueToString(res, value.KeyValue);
     }
+}
+void AddValueToString(std::string& res, AppCUI::Ini::Value& value)
+{
+    res += value.KeyName;
+    res += " = ";
+    AddValueContentToString(res, value);
     res += "\n";
 }
 void AddSectionToString(std::string& res, Ini::Section& sect, bool sorted)
 {
     res += "\n";
-    if (sect.Name.Len() > 0)
+    if (!sect.Name.empty())
     {
         res += "[";
         res += sect.Name;
@@ -315,15 +788,15 @@ void AddSectionToString(std::string& res, Ini::Section& sect, bool sorted)
     // add values
     if (sorted)
     {
-        PointerArrayStorage<AppCUI::Ini::Value> entries(sect.Keys.size());
+        PointerArrayStorage<AppCUI::Ini::Value> entries(sect.Keys.Count());
         size_t idx = 0;
-        for (auto& entry : sect.Keys)
-            entries[idx++] = &entry.second;
+        for (auto* entry : sect.Keys)
+            entries[idx++] = entry;
         struct
         {
             bool operator()(AppCUI::Ini::Value* v1, AppCUI::Ini::Value* v2) const
             {
-                return String::Compare(v1->KeyName.c_str(), v2->KeyName.c_str(), true) < 0;
+                return CompareNames(v1->KeyName, v2->KeyName) < 0;
             }
         } CompareIniValue;
         std::sort(entries.begin(), entries.end(), CompareIniValue);
@@ -336,13 +809,81 @@ void AddSectionToString(std::string& res, Ini::Section& sect, bool sorted)
     else
     {
         // write them as they are (faster)
-        for (auto& entry : sect.Keys)
+        for (auto* entry : sect.Keys)
         {
-            AddValueToString(res, entry.second);
+            AddValueToString(res, *entry);
         }
     }
 }
 
+#if defined(APPCUI_INI_SCANNER_NEON)
+inline uint32 Ini_MoveMask(uint8x16_t mask)
+{
+    // one bit for every byte (like _mm_movemask_epi8)
+    static const uint8 weights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    const auto bits                = vandq_u8(mask, vld1q_u8(weights));
+    return ((uint32) vaddv_u8(vget_low_u8(bits))) | (((uint32) vaddv_u8(vget_high_u8(bits))) << 8);
+}
+#endif
+void Ini::Scanner::Classify(size_t index)
+{
+    // the last block is padded with 0 (a character that is not part of any class)
+    alignas(16) uint8 lastBlock[SCAN_BLOCK_SIZE];
+    BuffPtr p = start + index * SCAN_BLOCK_SIZE;
+    if ((size_t) (end - p) < SCAN_BLOCK_SIZE)
+    {
+        memset(lastBlock, 0, sizeof(lastBlock));
+        memcpy(lastBlock, p, (size_t) (end - p));
+        p = lastBlock;
+    }
+    // the bitmaps are built in local variables (stores through "block" could alias the buffer)
+    uint64 newLineBits = 0;
+    uint64 commentBits = 0;
+    uint64 quoteBits   = 0;
+#if defined(APPCUI_INI_SCANNER_SSE2)
+    const __m128i newLine     = _mm_set1_epi8('\n');
+    const __m128i carriage    = _mm_set1_epi8('\r');
+    const __m128i semicolon   = _mm_set1_epi8(';');
+    const __m128i hash        = _mm_set1_epi8('#');
+    const __m128i quote       = _mm_set1_epi8('"');
+    const __m128i apostrophe  = _mm_set1_epi8('\'');
+    for (uint32 tr = 0; tr < SCAN_BLOCK_SIZE; tr += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + tr));
+        const auto nl   = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, newLine), _mm_cmpeq_epi8(v, carriage)));
+        const auto cm   = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, semicolon), _mm_cmpeq_epi8(v, hash)));
+        const auto qt   = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, apostrophe)));
+        newLineBits |= ((uint64) (uint32) nl) << tr;
+        commentBits |= ((uint64) (uint32) cm) << tr;
+        quoteBits |= ((uint64) (uint32) qt) << tr;
+    }
+#elif defined(APPCUI_INI_SCANNER_NEON)
+    for (uint32 tr = 0; tr < SCAN_BLOCK_SIZE; tr += 16)
+    {
+        const uint8x16_t v = vld1q_u8(p + tr);
+        const auto nl      = Ini_MoveMask(vorrq_u8(vceqq_u8(v, vdupq_n_u8('\n')), vceqq_u8(v, vdupq_n_u8('\r'))));
+        const auto cm      = Ini_MoveMask(vorrq_u8(vceqq_u8(v, vdupq_n_u8(';')), vceqq_u8(v, vdupq_n_u8('#'))));
+        const auto qt      = Ini_MoveMask(vorrq_u8(vceqq_u8(v, vdupq_n_u8('"')), vceqq_u8(v, vdupq_n_u8('\''))));
+        newLineBits |= ((uint64) nl) << tr;
+        commentBits |= ((uint64) cm) << tr;
+        quoteBits |= ((uint64) qt) << tr;
+    }
+#else
+    for (uint32 tr = 0; tr < SCAN_BLOCK_SIZE; tr++)
+    {
+        const auto type = Ini_Char_Type[p[tr]];
+        const auto bit  = 1ULL << tr;
+        if (type == CHAR_TYPE_NEW_LINE)
+            newLineBits |= bit;
+        if (type == CHAR_TYPE_COMMENT)
+            commentBits |= bit;
+        if (type == CHAR_TYPE_STRING)
+            quoteBits |= bit;
+    }
+#endif
+    block      = ScannerBlock{ newLineBits, commentBits, quoteBits };
+    blockIndex = index;
+}
 void Ini::Parser::SkipSpaces()
 {
     while ((current < end) && (Ini_Char_Type[*current] == CHAR_TYPE_SPACE))
@@ -370,13 +911,13 @@ void Ini::Parser::SkipNewLine()
 }
 void Ini::Parser::SkipWord()
 {
+    // names are short - a scalar loop is faster than classifying the characters of a word class
     while ((current < end) && (Ini_Char_Type[*current] & CHAR_TYPE_WORD_OR_NUMBER))
         current++;
 }
 void Ini::Parser::SkipCurrentLine()
 {
-    while ((current < end) && (Ini_Char_Type[*current] != CHAR_TYPE_NEW_LINE))
-        current++;
+    current = scanner.Find<SCAN_NEW_LINE>(current);
 }
 void Ini::Parser::SkipSingleLineWord(BuffPtr& wordEnds)
 {
@@ -384,8 +925,7 @@ void Ini::Parser::SkipSingleLineWord(BuffPtr& wordEnds)
     // we'll have to parse until we find a comment or a new line
     // skip spaces from the end (word will be trimmed)
     BuffPtr p_start = current;
-    while ((current < end) && (!(Ini_Char_Type[*current] & CHAR_TYPE_COMMENT_OR_NL)))
-        current++;
+    current         = scanner.Find<SCAN_NEW_LINE | SCAN_COMMENT>(current);
     if (current < end)
     {
         // remove the ending spaces
@@ -427,9 +967,12 @@ bool Ini::Parser::SkipString(bool& multiLineFormat)
     {
         current += 3;
         BuffPtr s_end = end - 2;
-        while (current < s_end)
+        while (true)
         {
-            if (((*current) == currentChar) && (current[1] == current[2]) && (current[0] == current[1]))
+            current = scanner.Find<SCAN_QUOTE>(current);
+            if (current >= s_end)
+                break;
+            if ((current[0] == currentChar) && (current[1] == currentChar) && (current[2] == currentChar))
             {
                 current += 3;
                 return true;
@@ -442,8 +985,10 @@ bool Ini::Parser::SkipString(bool& multiLineFormat)
     else
     {
         current++;
-        while ((current < end) && ((*current) != currentChar) && (Ini_Char_Type[*current] != CHAR_TYPE_NEW_LINE))
-            current++;
+        // the other quote character is part of the string
+        current = scanner.Find<SCAN_QUOTE | SCAN_NEW_LINE>(current);
+        while ((current < end) && ((*current) != currentChar) && (Ini_Char_Type[*current] == CHAR_TYPE_STRING))
+            current = scanner.Find<SCAN_QUOTE | SCAN_NEW_LINE>(current + 1);
         PARSER_CHECK((current < end) && ((*current) == currentChar), false, "Premature end of a string !");
         current++;
         return true;
@@ -530,11 +1075,11 @@ bool Ini::Parser::ParseState_ExpectingValue()
         CHECK(SkipString(multiLineString), false, "Fail parsing a string buffer !");
         if (multiLineString)
         {
-            CHECK(AddValue(valueStart + 3, current - 3), false, "Fail to add multi-line string");
+            CHECK(AddValue(valueStart + 3, current - 3, current), false, "Fail to add multi-line string");
         }
         else
         {
-            CHECK(AddValue(valueStart + 1, current - 1), false, "Fail to add single-line string");
+            CHECK(AddValue(valueStart + 1, current - 1, current), false, "Fail to add single-line string");
         }
         // all good
         state = ParseState::ExpectingKeyOrSection;
@@ -544,7 +1089,7 @@ bool Ini::Parser::ParseState_ExpectingValue()
     case CHAR_TYPE_OTHER:
         valueStart = current;
         SkipSingleLineWord(valueEnd);
-        CHECK(AddValue(valueStart, valueEnd), false, "Fail to add word value");
+        CHECK(AddValue(valueStart, valueEnd, valueEnd), false, "Fail to add word value");
         state = ParseState::ExpectingKeyOrSection;
         break;
     default:
@@ -561,12 +1106,7 @@ bool Ini::Parser::ParseState_ExpectingArray()
     current++;
     // sanity check
     PARSER_CHECK(current < end, false, "Premature end of INI file: expecting a value after '[' character !");
-    // all good --> create the value
-    auto& value       = CurrentSection->Keys[this->CurrentKeyHash];
-    value.KeyName     = string_view((const char*) CurrentKeyNamePtr, CurrentKeyNameLen);
-    CurrentKeyNamePtr = nullptr;
-    CurrentKeyNameLen = 0;
-    // value is created and is empy
+    ArrayItems.clear();
     while (true)
     {
         switch (Ini_Char_Type[*current])
@@ -576,11 +1116,11 @@ bool Ini::Parser::ParseState_ExpectingArray()
             CHECK(SkipString(multiLineString), false, "Fail parsing a string buffer !");
             if (multiLineString)
             {
-                CHECK(AddArrayValue(value, valueStart + 3, current - 3), false, "Fail to add multi-line string");
+                ArrayItems.emplace_back((const char*) valueStart + 3, (size_t) (current - valueStart - 6));
             }
             else
             {
-                CHECK(AddArrayValue(value, valueStart + 1, current - 1), false, "Fail to add single-line string");
+                ArrayItems.emplace_back((const char*) valueStart + 1, (size_t) (current - valueStart - 2));
             }
             SkipArrayDelimiters();
             break;
@@ -589,13 +1129,13 @@ bool Ini::Parser::ParseState_ExpectingArray()
         case CHAR_TYPE_OTHER:
             valueStart = current;
             SkipArrayWord();
-            CHECK(AddArrayValue(value, valueStart, current), false, "Fail to add word value");
+            ArrayItems.emplace_back((const char*) valueStart, (size_t) (current - valueStart));
             SkipArrayDelimiters();
             break;
         case CHAR_TYPE_SECTION_END:
             current++;
             state = ParseState::ExpectingKeyOrSection;
-            return true;
+            return AddArray();
         default:
             SetError("Expecting a value (a string, a number, etc)");
             RETURNERROR(false, "Expecting a value (a string, a number, etc)");
@@ -606,8 +1146,23 @@ bool Ini::Parser::ParseState_ExpectingArray()
 }
 void Ini::Parser::Clear()
 {
-    this->Sections.clear();
-    this->DefaultSection.Keys.clear();
+    this->Sections.Clear();
+    this->DefaultSection.Keys.Clear();
+    this->SectionsPool.Clear();
+    this->ValuesPool.Clear();
+    this->ItemsPool.Clear();
+    this->DefaultSection.SourceStart = NO_SOURCE;
+    this->DefaultSection.SourceEnd   = NO_SOURCE;
+    this->File.Close();
+    this->FileView = BufferView();
+    this->Text.reset();
+    this->Source    = string_view();
+    this->HasSource = false;
+    this->SavedText.clear();
+    this->SourceFile.clear();
+    this->SectionHeaders.clear();
+    this->RemovedValues.clear();
+    this->RemovedSections.clear();
     this->CurrentSection    = &this->DefaultSection;
     this->CurrentKeyHash    = 0;
     this->CurrentKeyNamePtr = nullptr;
@@ -615,15 +1170,24 @@ void Ini::Parser::Clear()
 }
 bool Ini::Parser::Parse(BuffPtr bufferStart, BuffPtr bufferEnd)
 {
-    Clear();
     // sanity check
     CHECK(bufferStart, false, "Expecting a valid value for internal 'bufferStart' pointer");
     CHECK(bufferStart <= bufferEnd, false, "Expecting a valid value for internal 'bufferEnd' pointer");
     // reset
-    start   = bufferStart;
-    end     = bufferEnd;
-    current = start;
-    state   = Ini::ParseState::ExpectingKeyOrSection;
+    start          = bufferStart;
+    end            = bufferEnd;
+    current        = start;
+    scanner.Init(start, end);
+    state          = Ini::ParseState::ExpectingKeyOrSection;
+    CurrentSection = &DefaultSection;
+    // the offsets are 32 bits (a larger text is always saved entirely)
+    HasSource = (size_t) (end - start) <= MAX_SOURCE_SIZE;
+    if (HasSource)
+    {
+        Source                     = string_view((const char*) start, (size_t) (end - start));
+        DefaultSection.SourceStart = 0;
+        DefaultSection.SourceEnd   = 0;
+    }
     while (current < end)
     {
         switch (state)
@@ -647,42 +1211,421 @@ bool Ini::Parser::Parse(BuffPtr bufferStart, BuffPtr bufferEnd)
     }
     return true;
 }
-bool Ini::Parser::AddSection(BuffPtr nameStart, BuffPtr nameEnd)
+// the file can not be mapped while it is being written (the parsed text is copied in memory)
+void Ini::Parser::DetachFromFile()
+{
+    if (!FileView.IsValid())
+        return;
+    const auto fileStart = (uintptr_t) FileView.GetData();
+    const auto fileSize  = FileView.GetLength();
+    auto copy            = std::make_unique<char[]>(fileSize);
+    memcpy(copy.get(), FileView.GetData(), fileSize);
+    const auto rebase = [fileStart, fileSize, &copy](string_view& text)
+    {
+        const auto offset = ((uintptr_t) text.data()) - fileStart;
+        if ((text.data()) && (offset < fileSize))
+            text = string_view(copy.get() + offset, text.size());
+    };
+    rebase(Source);
+    SectionsPool.ForEach([&rebase](Section& sect) { rebase(sect.Name); });
+    ValuesPool.ForEach(
+          [&rebase](Value& value)
+          {
+              rebase(value.KeyName);
+              rebase(value.KeyValue);
+          });
+    ItemsPool.ForEach(rebase);
+    Text     = std::move(copy);
+    FileView = BufferView();
+    File.Close();
+}
+Ini::Section* Ini::Parser::CreateSection(uint64 hash, string_view name)
+{
+    auto sect = Sections.Find(hash);
+    if (sect == nullptr)
+    {
+        sect        = SectionsPool.Allocate(1);
+        sect->Name  = name;
+        sect->Owner = this;
+        Sections.Insert(hash, sect);
+    }
+    return sect;
+}
+Ini::Value* Ini::Parser::CreateValue(Section& section, uint64 hash, string_view name)
 {
-    uint64 hash = __compute_hash__(nameStart, nameEnd);
-    auto& sect  = Sections[hash];
-    if (sect.get() == nullptr)
+    auto value = section.Keys.Find(hash);
+    if (value == nullptr)
+    {
+        value = ValuesPool.Allocate(1);
+        section.Keys.Insert(hash, value);
+    }
+    else
+    {
+        value->Reset();
+    }
+    value->KeyName = name;
+    return value;
+}
+void Ini::Section::RemoveValue(uint64 hash)
+{
+    auto value = Keys.Find(hash);
+    if (value == nullptr)
+        return;
+    if (value->SourceStart != NO_SOURCE)
+        Owner->RemovedValues.push_back({ value->SourceStart, value->SourceEnd });
+    Keys.Remove(hash);
+    Ini_ChangesCounter.fetch_add(1, std::memory_order_relaxed);
+}
+void Ini::Section::RemoveAllValues()
+{
+    for (auto* value : Keys)
+        if (value->SourceStart != NO_SOURCE)
+            Owner->RemovedValues.push_back({ value->SourceStart, value->SourceEnd });
+    Keys.Clear();
+    Ini_ChangesCounter.fetch_add(1, std::memory_order_relaxed);
+}
+void Ini::Parser::RemoveSection(uint64 hash)
+{
+    auto sect = Sections.Find(hash);
+    if (sect == nullptr)
+        return;
+    sect->RemoveAllValues();
+    if (sect->SourceStart != NO_SOURCE)
+    {
+        for (auto header : SectionHeaders)
+            if (header.Hash == hash)
+                RemovedSections.push_back(header.Start);
+    }
+    Sections.Remove(hash);
+}
+// the first character of the value (after '=' and the spaces that follow it)
+uint32 Ini::Parser::GetValueStart(const Value& value) const
+{
+    auto pos = value.SourceStart;
+    while ((pos < value.SourceEnd) && (Source[pos] != '='))
+        pos++;
+    pos++;
+    while ((pos < value.SourceEnd) && (Ini_Char_Type[(uint8) Source[pos]] == CHAR_TYPE_SPACE))
+        pos++;
+    return std::min<>(pos, value.SourceEnd);
+}
+// the start of the next line
+uint32 Ini::Parser::GetLineEnd(uint32 offset) const
+{
+    const auto size = (uint32) Source.size();
+    while ((offset < size) && (Ini_Char_Type[(uint8) Source[offset]] != CHAR_TYPE_NEW_LINE))
+        offset++;
+    if ((offset < size) && (Source[offset] == '\r'))
+        offset++;
+    if ((offset < size) && (Source[offset] == '\n'))
+        offset++;
+    return offset;
+}
+// the whole line of a removed value (including its comment) if there is no other value on it
+Ini::SourceRange Ini::Parser::GetRemovedLine(SourceRange range) const
+{
+    const auto size = (uint32) Source.size();
+    auto lineStart  = range.Start;
+    auto lineEnd    = range.End;
+    while ((lineStart > 0) && (Ini_Char_Type[(uint8) Source[lineStart - 1]] == CHAR_TYPE_SPACE))
+        lineStart--;
+    while ((lineEnd < size) && (Ini_Char_Type[(uint8) Source[lineEnd]] == CHAR_TYPE_SPACE))
+        lineEnd++;
+    if ((lineStart > 0) && (Ini_Char_Type[(uint8) Source[lineStart - 1]] != CHAR_TYPE_NEW_LINE))
+        return range;
+    if ((lineEnd < size) && ((Ini_Char_Type[(uint8) Source[lineEnd]] & CHAR_TYPE_COMMENT_OR_NL) == 0))
+        return range;
+    return { lineStart, GetLineEnd(lineEnd) };
+}
+// a removed section ends where the next one starts (its comments are removed as well)
+uint32 Ini::Parser::GetSectionEnd(uint32 headerStart) const
+{
+    auto next = std::upper_bound(
+          SectionHeaders.begin(),
+          SectionHeaders.end(),
+          headerStart,
+          [](uint32 value, const SectionHeader& header) { return value < header.Start; });
+    return next != SectionHeaders.end() ? next->Start : (uint32) Source.size();
+}
+void Ini::Parser::AddSourceEdits(Section& section)
+{
+    bool hasNewValues = false;
+    for (auto* value : section.Keys)
+    {
+        if (value->SourceStart == NO_SOURCE)
+            hasNewValues = true;
+        else if (value->Changed)
+            Edits.push_back({ GetValueStart(*value),
+                              value->SourceEnd,
+                              0,
+                              0,
+                              SourceEditType::ReplaceValue,
+                              false,
+                              value,
+                              nullptr });
+    }
+    const auto size = (uint32) Source.size();
+    if (section.SourceStart == NO_SOURCE)
+    {
+        Edits.push_back({ size, size, 0, 0, SourceEditType::AppendSection, false, nullptr, &section });
+    }
+    else if (hasNewValues)
+    {
+        // after the last value of the section (or after its header)
+        const auto pos = section.SourceEnd == 0 ? 0 : GetLineEnd(section.SourceEnd);
+        Edits.push_back({ pos, pos, 0, 0, SourceEditType::InsertValues, false, nullptr, &section });
+    }
+}
+void Ini::Parser::WriteSourceEdit(SourceEdit& edit, std::string& output)
+{
+    if ((edit.Type == SourceEditType::InsertValues) || (edit.Type == SourceEditType::AppendSection))
+    {
+        // the last line does not end with a new line
+        if ((!output.empty()) && (Ini_Char_Type[(uint8) output.back()] != CHAR_TYPE_NEW_LINE))
+            output += "\n";
+    }
+    edit.OutputStart = (uint32) output.size();
+    switch (edit.Type)
+    {
+    case SourceEditType::ReplaceValue:
+        AddValueContentToString(output, *edit.Target);
+        break;
+    case SourceEditType::AppendSection:
+        output += "\n";
+        edit.OutputStart = (uint32) output.size(); // the header of the section
+        output += "[";
+        output += edit.Parent->Name;
+        output += "]\n";
+        [[fallthrough]];
+    case SourceEditType::InsertValues:
+    {
+        vector<Value*> values;
+        for (auto* value : edit.Parent->Keys)
+            if (value->SourceStart == NO_SOURCE)
+                values.push_back(value);
+        std::sort(
+              values.begin(),
+              values.end(),
+              [](Value* v1, Value* v2) { return CompareNames(v1->KeyName, v2->KeyName) < 0; });
+        for (auto* value : values)
+        {
+            const auto valueStart = (uint32) output.size();
+            AddValueToString(output, *value);
+            InsertedValues.push_back({ value, valueStart, (uint32) output.size() - 1 }); // without the new line
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    edit.OutputEnd = (uint32) output.size();
+}
+// the source text with the changes (returns false if nothing was changed)
+bool Ini::Parser::WriteChanges(std::string& output)
+{
+    Edits.clear();
+    InsertedValues.clear();
+    AddSourceEdits(DefaultSection);
+    for (auto* section : Sections)
+        AddSourceEdits(*section);
+    for (auto range : RemovedValues)
+    {
+        const auto line = GetRemovedLine(range);
+        Edits.push_back({ line.Start, line.End, 0, 0, SourceEditType::Remove, false, nullptr, nullptr });
+    }
+    for (auto headerStart : RemovedSections)
+        Edits.push_back(
+              { headerStart, GetSectionEnd(headerStart), 0, 0, SourceEditType::Remove, false, nullptr, nullptr });
+    if (Edits.empty())
+        return false;
+
+    // the new sections are appended sorted by their names (just like ToString does)
+    std::sort(
+          Edits.begin(),
+          Edits.end(),
+          [](const SourceEdit& e1, const SourceEdit& e2)
+          {
+              if (e1.Start != e2.Start)
+                  return e1.Start < e2.Start;
+              if (e1.Type != e2.Type)
+                  return e1.Type < e2.Type;
+              if (e1.Type == SourceEditType::AppendSection)
+                  return CompareNames(e1.Parent->Name, e2.Parent->Name) < 0;
+              return false;
+          });
+    output.clear();
+    output.reserve(Source.size() + 256);
+    uint32 pos = 0;
+    for (auto& edit : Edits)
+    {
+        // the removed values of a removed section
+        edit.Skipped = edit.Start < pos;
+        if (edit.Skipped)
+            continue;
+        output.append(Source.substr(pos, edit.Start - pos));
+        WriteSourceEdit(edit, output);
+        pos = edit.End;
+    }
+    output.append(Source.substr(pos));
+    return true;
+}
+// the output becomes the new source text (all offsets are moved in it)
+void Ini::Parser::AcceptChanges(std::string& output, const std::filesystem::path& fileName)
+{
+    Edits.erase(
+          std::remove_if(Edits.begin(), Edits.end(), [](const SourceEdit& edit) { return edit.Skipped; }), Edits.end());
+    const auto moveOffset = [this](uint32 offset) -> uint32
+    {
+        // the text between two edits is copied as it is
+        auto next = std::upper_bound(
+              Edits.begin(),
+              Edits.end(),
+              offset,
+              [](uint32 value, const SourceEdit& edit) { return value < edit.End; });
+        if (next == Edits.begin())
+            return offset;
+        next--;
+        return offset - next->End + next->OutputEnd;
+    };
+    const auto isRemoved = [this](uint32 offset)
+    {
+        for (auto& edit : Edits)
+            if ((edit.Type == SourceEditType::Remove) && (offset >= edit.Start) && (offset < edit.End))
+                return true;
+        return false;
+    };
+    const auto moveSection = [&moveOffset](Section& section)
+    {
+        if (section.SourceStart == NO_SOURCE)
+            return;
+        section.SourceStart = moveOffset(section.SourceStart);
+        for (auto* value : section.Keys)
+        {
+            if (value->SourceStart == NO_SOURCE)
+                continue;
+            value->SourceStart = moveOffset(value->SourceStart);
+            if (!value->Changed)
+                value->SourceEnd = moveOffset(value->SourceEnd);
+        }
+    };
+    moveSection(DefaultSection);
+    for (auto* section : Sections)
+        moveSection(*section);
+
+    vector<SectionHeader> headers;
+    headers.reserve(SectionHeaders.size());
+    for (auto header : SectionHeaders)
+        if (!isRemoved(header.Start))
+            headers.push_back({ moveOffset(header.Start), header.Hash });
+    for (auto& edit : Edits)
+    {
+        if (edit.Type == SourceEditType::ReplaceValue)
+        {
+            edit.Target->SourceEnd = edit.OutputEnd;
+            edit.Target->Changed   = false;
+        }
+        else if (edit.Type == SourceEditType::AppendSection)
+        {
+            edit.Parent->SourceStart = edit.OutputStart;
+            headers.push_back({ edit.OutputStart, __compute_hash__(edit.Parent->Name) });
+        }
+    }
+    std::sort(
+          headers.begin(),
+          headers.end(),
+          [](const SectionHeader& h1, const SectionHeader& h2) { return h1.Start < h2.Start; });
+    for (auto& inserted : InsertedValues)
     {
-        sect.reset(new Section());
+        inserted.Target->SourceStart = inserted.Start;
+        inserted.Target->SourceEnd   = inserted.End;
+        inserted.Target->Changed     = false;
     }
-    CurrentSection = sect.get();
+    SectionHeaders = std::move(headers);
+    RemovedValues.clear();
+    RemovedSections.clear();
+    Edits.clear();
+    InsertedValues.clear();
+
+    SavedText  = std::move(output);
+    Source     = SavedText;
+    SourceFile = fileName;
+    HasSource  = SavedText.size() <= MAX_SOURCE_SIZE;
+
+    // new values are added after the last value of a section (or after its header)
+    const auto updateSectionEnd = [this](Section& section)
+    {
+        uint32 end = 0;
+        if (&section != &DefaultSection)
+        {
+            end = section.SourceStart;
+            while ((end < Source.size()) && (Source[end] != ']'))
+                end++;
+            end++;
+        }
+        for (auto* value : section.Keys)
+            end = std::max<>(end, value->SourceEnd);
+        section.SourceEnd = end;
+    };
+    updateSectionEnd(DefaultSection);
+    for (auto* section : Sections)
+        updateSectionEnd(*section);
+}
+bool Ini::Parser::AddSection(BuffPtr nameStart, BuffPtr nameEnd)
+{
+    const auto hash = __compute_hash__(nameStart, nameEnd);
+    CurrentSection  = CreateSection(hash, string_view((const char*) nameStart, (size_t) (nameEnd - nameStart)));
     CHECK(CurrentSection, false, "Fail to allocate a section");
-    if (CurrentSection->Name.Len() == 0)
+    if (HasSource)
     {
-        CHECK(CurrentSection->Name.Set((const char*) nameStart, (uint32) (nameEnd - nameStart)),
-              false,
-              "Fail to allocate section name");
+        BuffPtr header = nameStart;
+        while ((*header) != '[')
+            header--;
+        const auto headerStart = (uint32) (header - start);
+        // a section can be written several times (all of its headers are removed if the section is deleted)
+        if (CurrentSection->SourceStart == NO_SOURCE)
+            CurrentSection->SourceStart = headerStart;
+        CurrentSection->SourceEnd = (uint32) (current - start);
+        SectionHeaders.push_back({ headerStart, hash });
     }
     return true;
 }
-bool Ini::Parser::AddValue(BuffPtr valueStart, BuffPtr valueEnd)
+void Ini::Parser::SetValueSource(Value& value, BuffPtr valueEnd)
+{
+    if (!HasSource)
+        return;
+    value.SourceStart         = (uint32) (CurrentKeyNamePtr - start);
+    value.SourceEnd           = (uint32) (valueEnd - start);
+    CurrentSection->SourceEnd = value.SourceEnd;
+}
+bool Ini::Parser::AddValue(BuffPtr valueStart, BuffPtr valueEnd, BuffPtr sourceEnd)
 {
     CHECK(valueStart <= valueEnd, false, "Invalid buffer pointers !");
-    auto& value       = CurrentSection->Keys[this->CurrentKeyHash];
-    value.KeyValue    = string_view((const char*) valueStart, (uint32) (valueEnd - valueStart));
-    value.KeyName     = string_view((const char*) CurrentKeyNamePtr, CurrentKeyNameLen);
+    auto value = CreateValue(
+          *CurrentSection, CurrentKeyHash, string_view((const char*) CurrentKeyNamePtr, CurrentKeyNameLen));
+    value->KeyValue = string_view((const char*) valueStart, (size_t) (valueEnd - valueStart));
+    SetValueSource(*value, sourceEnd);
     CurrentKeyNamePtr = nullptr;
     CurrentKeyNameLen = 0;
     return true;
 }
-bool Ini::Parser::AddArrayValue(Ini::Value& value, BuffPtr valueStart, BuffPtr valueEnd)
+bool Ini::Parser::AddArray()
 {
-    CHECK(valueStart <= valueEnd, false, "Invalid buffer pointers !");
-    value.KeyValues.push_back(std::string(string_view((const char*) valueStart, (uint32) (valueEnd - valueStart))));
+    auto value = CreateValue(
+          *CurrentSection, CurrentKeyHash, string_view((const char*) CurrentKeyNamePtr, CurrentKeyNameLen));
+    if (!ArrayItems.empty())
+    {
+        auto* items = ItemsPool.Allocate((uint32) ArrayItems.size());
+        std::copy(ArrayItems.begin(), ArrayItems.end(), items);
+        value->Items      = items;
+        value->ItemsCount = (uint32) ArrayItems.size();
+    }
+    SetValueSource(*value, current);
+    CurrentKeyNamePtr = nullptr;
+    CurrentKeyNameLen = 0;
     return true;
 }
 //============================================================================= INI Section iterator ===
-using IniSectionIterator = std::unordered_map<uint64, IniValue>::iterator;
+using IniSectionIterator = Ini::HashTable<Ini::Value>::Iterator;
 IniSection::Iterator::Iterator(void* data)
 {
     static_assert(
@@ -699,7 +1642,7 @@ IniSection::Iterator::~Iterator()
 }
       IniSection::Iterator& IniSection::Iterator::operator++()
 {
-    (*((IniSectionIterator*) &this->data))++;
+    ++(*((IniSectionIterator*) &this->data));
     return *this;
 }
 bool IniSection::Iterator::operator!=(const Iterator& it)
@@ -708,41 +1651,42 @@ bool IniSection::Iterator::operator!=(const Iterator& it)
 }
 IniValue IniSection::Iterator::operator*()
 {
-    return IniValue(&((*((IniSectionIterator*) &this->data))->second));
+    return IniValue(*(*((IniSectionIterator*) &this->data)));
 }
 //============================================================================= INI Section ============
 string_view IniSection::GetName() const
 {
     CHECK(this->Data, "", "");
-    return string_view{ ((Ini::Section*) Data)->Name.GetText(), ((Ini::Section*) Data)->Name.Len() };
+    return ((Ini::Section*) Data)->Name;
 }
 IniValue IniSection::GetValue(string_view keyName)
 {
     CHECK(Data, IniValue(), "Section key does not exists (unable to get key-value datat!)");
     Ini::Section* entry = ((Ini::Section*) Data);
-    auto value          = entry->Keys.find(__compute_hash__(keyName));
-    CHECK(value != entry->Keys.cend(), IniValue(), "Unable to find key !");
+    auto value          = entry->Keys.Find(__compute_hash__(keyName));
+    CHECK(value, IniValue(), "Unable to find key !");
     // all good -> value exists
-    return IniValue(&value->second);
+    return IniValue(value);
 }
 bool IniSection::HasValue(string_view keyName)
 {
     CHECK(Data, false, "Section key does not exists (unable to get key-value datat!)");
     Ini::Section* entry = ((Ini::Section*) Data);
-    auto value          = entry->Keys.find(__compute_hash__(keyName));
-    return value != entry->Keys.cend();
+    return entry->Keys.Find(__compute_hash__(keyName)) != nullptr;
 }
 IniValue IniSection::operator[](string_view keyName)
 {
     CHECK(Data, IniValue(), "Section key does not exists (unable to get key-value datat!)");
     Ini::Section* entry = ((Ini::Section*) Data);
     auto hash           = __compute_hash__(keyName);
-    auto value          = entry->Keys.find(hash);
+    auto value          = entry->Keys.Find(hash);
     // if element already exists --> return it
-    if (value != entry->Keys.cend())
-        return IniValue(&value->second);
-    auto res = entry->Keys.emplace(hash, Ini::Value(keyName));
-    return IniValue(&res.first->second);
+    if (value)
+        return IniValue(value);
+    value = entry->Owner->ValuesPool.Allocate(1);
+    value->SetName(keyName);
+    entry->Keys.Insert(hash, value);
+    return IniValue(value);
 }
 vector<IniValue> IniSection::GetValues() const
 {
@@ -751,10 +1695,10 @@ vector<IniValue> IniSection::GetValues() const
     vector<IniValue> res;
     auto sect = ((Ini::Section*) Data);
 
-    res.reserve(sect->Keys.size());
-    for (auto& v : sect->Keys)
+    res.reserve(sect->Keys.Count());
+    for (auto* v : sect->Keys)
     {
-        res.push_back(IniValue(&v.second));
+        res.push_back(IniValue(v));
     }
 
     return res;
@@ -773,12 +1717,12 @@ IniSection::Iterator IniSection::end()
 void IniSection::Clear()
 {
     if (this->Data)
-        ((Ini::Section*) Data)->Keys.clear();
+        ((Ini::Section*) Data)->RemoveAllValues();
 }
 bool IniSection::DeleteValue(string_view keyName)
 {
     CHECK(Data, false, "Section key does not exists (unable to get key-value datat!)");
-    ((Ini::Section*) Data)->Keys.erase(__compute_hash__(keyName));
+    ((Ini::Section*) Data)->RemoveValue(__compute_hash__(keyName));
     return true;
 }
 template <typename T>
@@ -791,7 +1735,7 @@ void UpdateValueForSection(void* sectionData, string_view name, T value, bool do
     if (dontUpdateIfValueExits)
     {
         auto hash = __compute_hash__(name);
-        if (entry->Keys.contains(hash))
+        if (entry->Keys.Find(hash))
             return;
     }
     IniSection sect(sectionData);
@@ -879,9 +1823,18 @@ void IniSection::UpdateValue(string_view name, const initializer_list<double>& v
 }
 //============================================================================= INI Value ===
 
-optional<bool> IniValue_ToBool(const char* txt, uint32 len)
+// the first (at most 4) characters in lower case - the text is not always aligned or followed by a '\0' (it can
+// refer to the parsed text)
+inline uint32 IniValue_LowerCaseCode(const char* txt, uint32 len)
 {
     auto v = 0U;
+    for (auto index = 0U; (index < len) && (index < 4); index++)
+        v |= ((uint32) (uint8) (txt[index] | 0x20)) << (index * 8);
+    return v;
+}
+optional<bool> IniValue_ToBool(const char* txt, uint32 len)
+{
+    auto v = IniValue_LowerCaseCode(txt, len);
     switch (len)
     {
     case 1:
@@ -891,27 +1844,22 @@ optional<bool> IniValue_ToBool(const char* txt, uint32 len)
             return false;
         break;
     case 2:
-        v = (*((const uint16*) txt)) | 0x2020;
         if (v == INI_VALUE_ON)
             return true;
         if (v == INI_VALUE_NO)
             return false;
         break;
     case 3:
-        // in fact there are 4 bytes (3 for the text followed by 0)
-        v = (*((const uint32*) txt)) | 0x202020;
         if (v == INI_VALUE_YES)
             return true;
         if (v == INI_VALUE_OFF)
             return false;
         break;
     case 4:
-        v = (*((const uint32*) txt)) | 0x20202020;
         if (v == INI_VALUE_TRUE)
             return true;
         break;
     case 5:
-        v = (*((const uint32*) txt)) | 0x20202020;
         if ((v == INI_VALUE_FALSE) && ((txt[4] | 0x20) == 'e'))
             return false;
         break;
@@ -925,32 +1873,32 @@ optional<bool> IniValue_ToBool(const char* txt, uint32 len)
 optional<uint64> IniValue::AsUInt64() const
 {
     VALIDATE_VALUE(std::nullopt);
-    return Number::ToUInt64(static_cast<string_view>(value->KeyValue));
+    return Number::ToUInt64(value->KeyValue);
 }
 optional<int64> IniValue::AsInt64() const
 {
     VALIDATE_VALUE(std::nullopt);
-    return Number::ToInt64(static_cast<string_view>(value->KeyValue));
+    return Number::ToInt64(value->KeyValue);
 }
 optional<uint32> IniValue::AsUInt32() const
 {
     VALIDATE_VALUE(std::nullopt);
-    return Number::ToUInt32(static_cast<string_view>(value->KeyValue));
+    return Number::ToUInt32(value->KeyValue);
 }
 optional<int32> IniValue::AsInt32() const
 {
     VALIDATE_VALUE(std::nullopt);
-    return Number::ToInt32(static_cast<string_view>(value->KeyValue));
+    return Number::ToInt32(value->KeyValue);
 }
 optional<bool> IniValue::AsBool() const
 {
     VALIDATE_VALUE(std::nullopt);
-    return IniValue_ToBool(value->KeyValue.c_str(), (uint32) value->KeyValue.length());
+    return IniValue_ToBool(value->KeyValue.data(), (uint32) value->KeyValue.length());
 }
 optional<Input::Key> IniValue::AsKey() const
 {
     VALIDATE_VALUE(std::nullopt);
-    Key k = KeyUtils::FromString((static_cast<string_view>(value->KeyValue)));
+    Key k = KeyUtils::FromString(value->KeyValue);
     if (k == Key::None)
         return std::nullopt;
     return k;
@@ -958,12 +1906,12 @@ optional<Input::Key> IniValue::AsKey() const
 optional<const char*> IniValue::AsString() const
 {
     VALIDATE_VALUE(std::nullopt);
-    return value->KeyValue.c_str();
+    return value->GetCString();
 }
 optional<string_view> IniValue::AsStringView() const
 {
     VALIDATE_VALUE(std::nullopt);
-    return static_cast<string_view>(value->KeyValue);
+    return value->KeyValue;
 }
 optional<Graphics::Size> IniValue::AsSize() const
 {
@@ -973,22 +1921,22 @@ optional<Graphics::Size> IniValue::AsSize() const
 optional<float> IniValue::AsFloat() const
 {
     VALIDATE_VALUE(std::nullopt);
-    return Number::ToFloat((static_cast<string_view>(value->KeyValue)));
+    return Number::ToFloat(value->KeyValue);
 }
 optional<double> IniValue::AsDouble() const
 {
     VALIDATE_VALUE(std::nullopt);
-    return Number::ToDouble((static_cast<string_view>(value->KeyValue)));
+    return Number::ToDouble(value->KeyValue);
 }
 optional<Graphics::Color> IniValue::AsColor() const
 {
     VALIDATE_VALUE(std::nullopt);
-    return ColorUtils::GetColor(static_cast<string_view>(value->KeyValue));
+    return ColorUtils::GetColor(value->KeyValue);
 }
 optional<Graphics::ColorPair> IniValue::AsColorPair() const
 {
     VALIDATE_VALUE(std::nullopt);
-    return ColorUtils::GetColorPair(static_cast<string_view>(value->KeyValue));
+    return ColorUtils::GetColorPair(value->KeyValue);
 }
 
 uint64 IniValue::ToUInt64(uint64 defaultValue) const
@@ -1042,7 +1990,7 @@ Input::Key IniValue::ToKey(Input::Key defaultValue) const
 const char* IniValue::ToString(const char* defaultValue) const
 {
     VALIDATE_VALUE(defaultValue);
-    return value->KeyValue.c_str();
+    return value->GetCString();
 }
 string_view IniValue::ToStringView(string_view defaultValue) const
 {
@@ -1102,30 +2050,26 @@ string_view IniValue::GetName() const
 bool IniValue::IsArray() const
 {
     VALIDATE_VALUE(false);
-    return value->KeyValues.size() > 0;
+    return value->ItemsCount > 0;
 }
 uint32 IniValue::GetArrayCount() const
 {
     VALIDATE_VALUE(0);
-    return (uint32) value->KeyValues.size();
+    return value->ItemsCount;
 }
 IniValueArray IniValue::operator[](int32 index) const
 {
     VALIDATE_VALUE(IniValueArray());
-    if ((index < 0) || (index >= (int32)value->KeyValues.size()))
+    if ((index < 0) || (index >= (int32) value->ItemsCount))
         return IniValueArray();
 
-    return IniValueArray((string_view) value->KeyValues[index]);
+    return IniValueArray(this->Data, (uint32) index, value->Items[index]);
 }
 
 void IniValue::operator=(bool value)
 {
     PREPARE_VALUE;
-    if (value)
-        iniValue->KeyValue = "true";
-    else
-        iniValue->KeyValue = "false";
-    iniValue->KeyValues.clear();
+    iniValue->SetValue(value ? "true" : "false");
 }
 void IniValue::operator=(uint32 value)
 {
@@ -1147,34 +2091,29 @@ void IniValue::operator=(float value)
 {
     PREPARE_VALUE;
     LocalString<64> tmp;
-    iniValue->KeyValue = tmp.Format("%.3f", value);
-    iniValue->KeyValues.clear();
+    iniValue->SetValue(tmp.Format("%.3f", value));
 }
 void IniValue::operator=(double value)
 {
     PREPARE_VALUE;
     LocalString<64> tmp;
-    iniValue->KeyValue = tmp.Format("%.3lf", value);
-    iniValue->KeyValues.clear();
+    iniValue->SetValue(tmp.Format("%.3lf", value));
 }
 void IniValue::operator=(string_view value)
 {
     PREPARE_VALUE;
-    iniValue->KeyValue = value;
-    iniValue->KeyValues.clear();
+    iniValue->SetValue(value);
 }
 void IniValue::operator=(const char* value)
 {
     PREPARE_VALUE;
-    iniValue->KeyValue = value;
-    iniValue->KeyValues.clear();
+    iniValue->SetValue(value);
 }
 void IniValue::operator=(Graphics::Size value)
 {
     PREPARE_VALUE;
     LocalString<64> tmp;
-    iniValue->KeyValue = tmp.Format("%u x %u", value.Width, value.Height);
-    iniValue->KeyValues.clear();
+    iniValue->SetValue(tmp.Format("%u x %u", value.Width, value.Height));
 }
 void IniValue::operator=(Input::Key value)
 {
@@ -1182,36 +2121,35 @@ void IniValue::operator=(Input::Key value)
     LocalString<64> tmp;
     if (!Utils::KeyUtils::ToString(value, tmp))
         return;
-    iniValue->KeyValue = tmp;
-    iniValue->KeyValues.clear();
+    iniValue->SetValue(tmp);
 }
 void IniValue::operator=(const initializer_list<std::string>& values)
 {
     PREPARE_VALUE;
-    iniValue->KeyValue.clear();
-    iniValue->KeyValues = values;
+    iniValue->EditArray() = values;
+    iniValue->SetArray();
 }
 void IniValue::operator=(const initializer_list<const char*>& values)
 {
     PREPARE_VALUE;
-    iniValue->KeyValue.clear();
-    iniValue->KeyValues.clear();
-    iniValue->KeyValues.reserve(values.size());
+    auto& items = iniValue->EditArray();
+    items.reserve(values.size());
     for (auto val : values)
     {
-        iniValue->KeyValues.push_back(val);
+        items.push_back(val);
     }
+    iniValue->SetArray();
 }
 void IniValue::operator=(const initializer_list<bool>& values)
 {
     PREPARE_VALUE;
-    iniValue->KeyValue.clear();
-    iniValue->KeyValues.clear();
-    iniValue->KeyValues.reserve(values.size());
+    auto& items = iniValue->EditArray();
+    items.reserve(values.size());
     for (auto val : values)
     {
-        iniValue->KeyValues.push_back(val ? "true" : "false");
+        items.push_back(val ? "true" : "false");
     }
+    iniValue->SetArray();
 }
 template <typename T>
 void IniValueSetVector(void* Data, const initializer_list<T>& values)
@@ -1219,14 +2157,14 @@ void IniValueSetVector(void* Data, const initializer_list<T>& values)
     if (!Data)
         return;
     Ini::Value* iniValue = (Ini::Value*) Data;
-    iniValue->KeyValue.clear();
-    iniValue->KeyValues.clear();
-    iniValue->KeyValues.reserve(values.size());
+    auto& items = iniValue->EditArray();
+    items.reserve(values.size());
     NumericFormatter n;
     for (auto val : values)
     {
-        iniValue->KeyValues.push_back(std::string(n.ToDec(val)));
+        items.push_back(std::string(n.ToDec(val)));
     }
+    iniValue->SetArray();
 }
 void IniValue::operator=(const initializer_list<uint32>& values)
 {
@@ -1341,10 +2279,17 @@ Input::Key IniValueArray::ToKey(Input::Key defaultValue) const
     else
         return defaultValue;
 }
-const char* IniValueArray::ToString(const char* /*defaultValue*/) const
+optional<const char*> IniValueArray::AsString() const
 {
+    // values read from a file are not '\0' terminated --> they are copied the first time they are needed as a string
+    if (Data)
+        return ((Ini::Value*) Data)->GetItemCString(index);
     return text;
 }
+const char* IniValueArray::ToString(const char* /*defaultValue*/) const
+{
+    return AsString().value();
+}
 string_view IniValueArray::ToStringView(string_view defaultValue) const
 {
     auto result = this->AsStringView();
@@ -1378,7 +2323,7 @@ double IniValueArray::ToDouble(double defaultValue) const
         return defaultValue;
 }
 //============================================================================= INI object iterator ===
-using IniObjectIterator = std::unordered_map<uint64, unique_ptr<Ini::Section>>::iterator;
+using IniObjectIterator = Ini::HashTable<Ini::Section>::Iterator;
 IniObject::Iterator::Iterator(void* data)
 {
     static_assert(
@@ -1395,7 +2340,7 @@ IniObject::Iterator::~Iterator()
 }
 IniObject::Iterator& IniObject::Iterator::operator++()
 {
-    (*((IniObjectIterator*) &this->data))++;
+    ++(*((IniObjectIterator*) &this->data));
     return *this;
 }
 bool IniObject::Iterator::operator!=(const Iterator& it)
@@ -1404,7 +2349,7 @@ bool IniObject::Iterator::operator!=(const Iterator& it)
 }
 IniSection IniObject::Iterator::operator*()
 {
-    return IniSection((*((IniObjectIterator*) &this->data))->second.get());
+    return IniSection(*(*((IniObjectIterator*) &this->data)));
 }
 //============================================================================= INI Object ===
 IniObject::IniObject()
@@ -1414,7 +2359,11 @@ IniObject::IniObject()
 IniObject::~IniObject()
 {
     if (Data)
+    {
+        if (((Ini::Parser*) Data)->AutoSaveEnabled)
+            DisableAutoSave();
         delete ((Ini::Parser*) Data);
+    }
     Data = nullptr;
 }
 bool IniObject::Init()
@@ -1430,35 +2379,110 @@ bool IniObject::CreateFromString(string_view text)
 {
     CHECK(text.data(), false, "Expecting a valid (non-null) string !");
     CHECK(Init(), false, "Fail to initialize parser object !");
-    BuffPtr start = (BuffPtr) text.data();
+    WRAPPER->Clear();
+    // keys and values refer to a copy of the text
+    WRAPPER->Text = std::make_unique<char[]>(std::max<>(text.length(), (size_t) 1));
+    memcpy(WRAPPER->Text.get(), text.data(), text.length());
+    BuffPtr start = (BuffPtr) WRAPPER->Text.get();
     BuffPtr end   = start + text.length();
     CHECK(WRAPPER->Parse(start, end), false, "Fail to parser buffer !");
     return true;
 }
 bool IniObject::CreateFromFile(const std::filesystem::path& fileName)
 {
+    CHECK(Init(), false, "Fail to initialize parser object !");
+    WRAPPER->Clear();
+    // keys and values refer to the mapped file (only the pages that are parsed are read)
+    WRAPPER->FileView = OS::MapWholeFile(WRAPPER->File, fileName);
+    if (WRAPPER->FileView.IsValid())
+    {
+        BuffPtr start = WRAPPER->FileView.GetData();
+        BuffPtr end   = start + WRAPPER->FileView.GetLength();
+        CHECK(WRAPPER->Parse(start, end), false, "Fail to parse ini file: %s", fileName.string().c_str());
+        WRAPPER->SourceFile = fileName;
+        return true;
+    }
     auto buf = OS::File::ReadContent(fileName);
     CHECK(buf.IsValid(), false, "Unable to read content of ini file: %s", fileName.string().c_str());
-    return CreateFromString(buf);
+    CHECK(CreateFromString(buf), false, "Fail to parse ini file: %s", fileName.string().c_str());
+    WRAPPER->SourceFile = fileName;
+    return true;
 }
 bool IniObject::Save(const std::filesystem::path& fileName)
 {
-    auto iniContent = this->ToString();
-    CHECK(!iniContent.empty(), false, "Fail to create ini content !");
-    OS::File f;
-    CHECK(f.Create(fileName, true), false, "Fail to create file: %s", fileName.string().c_str());
-    if (iniContent.size())
+    VALIDATE_INITED(false);
+    WRAPPER->DetachFromFile(); // the file might be the one that is mapped
+    if (!WRAPPER->HasSource)
     {
-        if (!f.Write(iniContent))
-        {
-            LOG_ERROR("Fail to write ini content to file: %s", fileName.string().c_str());
-            f.Close();
-            return false;
-        }
+        // created from code (or too large to keep the offsets) --> the whole content is written
+        auto iniContent = this->ToString();
+        CHECK(!iniContent.empty(), false, "Fail to create ini content !");
+        CHECK(OS::File::ReplaceContent(fileName, iniContent),
+              false,
+              "Fail to write ini content to file: %s",
+              fileName.string().c_str());
+        return true;
     }
-    f.Close();
+    // only the changed values and sections are written (the comments and the layout of the file are kept)
+    std::string output;
+    if (!WRAPPER->WriteChanges(output))
+    {
+        std::error_code err;
+        if ((WRAPPER->SourceFile == fileName) && (std::filesystem::exists(fileName, err)))
+            return true; // nothing was changed since the file was loaded or saved
+        output = WRAPPER->Source;
+    }
+    CHECK(OS::File::ReplaceContent(fileName, output),
+          false,
+          "Fail to write ini content to file: %s",
+          fileName.string().c_str());
+    WRAPPER->AcceptChanges(output, fileName);
     return true;
 }
+bool IniObject::EnableAutoSave(const std::filesystem::path& fileName, uint32 delayMilliseconds)
+{
+    CHECK(Init(), false, "Fail to initialize parser object !");
+    CHECK(!fileName.empty(), false, "Expecting a valid file name !");
+    WRAPPER->AutoSaveFile    = fileName;
+    WRAPPER->AutoSaveDelay   = std::chrono::milliseconds(delayMilliseconds);
+    WRAPPER->AutoSaveChanges = Ini_ChangesCounter.load(std::memory_order_relaxed);
+    WRAPPER->AutoSaveEnabled = true;
+    WRAPPER->AutoSavePending = false;
+    return true;
+}
+bool IniObject::DisableAutoSave()
+{
+    VALIDATE_INITED(false);
+    if (!WRAPPER->AutoSaveEnabled)
+        return true;
+    const auto result        = ProcessAutoSave(true);
+    WRAPPER->AutoSaveEnabled = false;
+    WRAPPER->AutoSavePending = false;
+    return result;
+}
+bool IniObject::ProcessAutoSave(bool saveNow)
+{
+    if ((this->Data == nullptr) || (!WRAPPER->AutoSaveEnabled))
+        return true;
+    // the counter is shared by all ini objects (a change of another object only results in a save with no changes)
+    const auto changes = Ini_ChangesCounter.load(std::memory_order_relaxed);
+    const auto now     = std::chrono::steady_clock::now();
+    if (changes != WRAPPER->AutoSaveChanges)
+    {
+        WRAPPER->AutoSaveChanges    = changes;
+        WRAPPER->AutoSaveLastChange = now;
+        WRAPPER->AutoSavePending    = true;
+    }
+    if ((!WRAPPER->AutoSavePending) || ((!saveNow) && (now - WRAPPER->AutoSaveLastChange < WRAPPER->AutoSaveDelay)))
+        return true;
+    WRAPPER->AutoSavePending = false;
+    if (Save(WRAPPER->AutoSaveFile))
+        return true;
+    // try again after another delay
+    WRAPPER->AutoSavePending    = true;
+    WRAPPER->AutoSaveLastChange = now;
+    RETURNERROR(false, "Fail to auto-save ini object to: %s", WRAPPER->AutoSaveFile.string().c_str());
+}
 bool IniObject::Create()
 {
     CHECK(Init(), false, "Fail to initialize parser object !");
@@ -1478,10 +2502,10 @@ bool IniObject::DeleteSection(string_view name)
     // null-strings or empty strings refer to the Default section that always exists
     if ((name.data() == nullptr) || (name.length() == 0))
     {
-        WRAPPER->DefaultSection.Keys.clear();
+        WRAPPER->DefaultSection.RemoveAllValues();
         return true;
     }
-    WRAPPER->Sections.erase(__compute_hash__(name));
+    WRAPPER->RemoveSection(__compute_hash__(name));
     return true;
 }
 bool IniObject::HasSection(string_view name) const
@@ -1490,17 +2514,14 @@ bool IniObject::HasSection(string_view name) const
     // null-strings or empty strings refer to the Default section that always exists
     if ((name.data() == nullptr) || (name.length() == 0))
         return true;
-    return WRAPPER->Sections.contains(__compute_hash__(name));
+    return WRAPPER->Sections.Find(__compute_hash__(name)) != nullptr;
 }
 IniSection IniObject::GetSection(string_view name)
 {
     VALIDATE_INITED(IniSection());
     if ((name.data() == nullptr) || (name.length() == 0))
         return IniSection(&(WRAPPER->DefaultSection));
-    auto result = WRAPPER->Sections.find(__compute_hash__(name));
-    if (result == WRAPPER->Sections.cend())
-        return IniSection();
-    return IniSection(result->second.get());
+    return IniSection(WRAPPER->Sections.Find(__compute_hash__(name)));
 }
 IniSection IniObject::CreateSection(string_view name, bool emptyContent)
 {
@@ -1512,29 +2533,32 @@ IniSection IniObject::CreateSection(string_view name, bool emptyContent)
     if ((name.data() == nullptr) || (name.length() == 0))
     {
         if (emptyContent)
-            WRAPPER->DefaultSection.Keys.clear();
+            WRAPPER->DefaultSection.RemoveAllValues();
         return IniSection(&(WRAPPER->DefaultSection));
     }
     // check if the section exists
     auto hash   = __compute_hash__(name);
-    auto result = WRAPPER->Sections.find(hash);
-    if (result != WRAPPER->Sections.cend())
+    auto result = WRAPPER->Sections.Find(hash);
+    if (result)
     {
         if (emptyContent)
-            result->second->Keys.clear();
-        return IniSection(result->second.get());
+            result->RemoveAllValues();
+        return IniSection(result);
     }
     // create a new section
-    auto res = WRAPPER->Sections.emplace(hash, std::make_unique<Ini::Section>(name));
-    return IniSection(res.first->second.get());
+    result            = WRAPPER->CreateSection(hash, name);
+    result->OwnedName = name;
+    result->Name      = result->OwnedName;
+    Ini_ChangesCounter.fetch_add(1, std::memory_order_relaxed);
+    return IniSection(result);
 }
 vector<IniSection> IniObject::GetSections() const
 {
     VALIDATE_INITED(vector<IniSection>());
     vector<IniSection> res;
-    res.reserve(WRAPPER->Sections.size());
-    for (auto& s : WRAPPER->Sections)
-        res.push_back(IniSection(s.second.get()));
+    res.reserve(WRAPPER->Sections.Count());
+    for (auto* s : WRAPPER->Sections)
+        res.push_back(IniSection(s));
     return res;
 }
 IniObject::Iterator IniObject::begin()
@@ -1561,25 +2585,27 @@ IniValue IniObject::GetValue(string_view valuePath)
     if (p >= end)
     {
         // no section was provided --> using the default one
-        auto value = WRAPPER->DefaultSection.Keys.find(__compute_hash__(start, end));
-        CHECK(value != WRAPPER->DefaultSection.Keys.cend(), IniValue(), "Unable to find key for default section!");
+        auto value = WRAPPER->DefaultSection.Keys.Find(__compute_hash__(start, end));
+        CHECK(value, IniValue(), "Unable to find key for default section!");
         // all good -> value exists
-        return IniValue(&value->second);
+        return IniValue(value);
     }
     else
     {
         // we have both a section and a value name
-        auto result = WRAPPER->Sections.find(__compute_hash__(start, p));
-        if (result == WRAPPER->Sections.cend())
+        Ini::Section* sect = WRAPPER->Sections.Find(__compute_hash__(start, p));
+        if (sect == nullptr)
             return IniValue();
-        Ini::Section* sect = result->second.get();
-        CHECK(sect, IniValue(), "Invalid section (null)");
         p++;
         CHECK(p < end, IniValue(), "Missing value from path !");
-        auto value = sect->Keys.find(__compute_hash__(p, end));
-        CHECK(value != sect->Keys.cend(), IniValue(), "Unable to find key for section: %s", sect->Name.GetText());
+        auto value = sect->Keys.Find(__compute_hash__(p, end));
+        CHECK(value,
+              IniValue(),
+              "Unable to find key for section: %.*s",
+              (int32) sect->Name.size(),
+              sect->Name.data());
         // all good -> value exists
-        return IniValue(&value->second);
+        return IniValue(value);
     }
 }
 bool IniObject::DeleteValue(string_view valuePath)
@@ -1596,27 +2622,25 @@ bool IniObject::DeleteValue(string_view valuePath)
     if (p >= end)
     {
         // no section was provided --> using the default one
-        WRAPPER->DefaultSection.Keys.erase(__compute_hash__(start, end));
+        WRAPPER->DefaultSection.RemoveValue(__compute_hash__(start, end));
         return true;
     }
     else
     {
         // we have both a section and a value name
-        auto result = WRAPPER->Sections.find(__compute_hash__(start, p));
-        if (result == WRAPPER->Sections.cend())
+        Ini::Section* sect = WRAPPER->Sections.Find(__compute_hash__(start, p));
+        if (sect == nullptr)
             return false;
-        Ini::Section* sect = result->second.get();
-        CHECK(sect, false, "Invalid section (null)");
         p++;
         CHECK(p < end, false, "Missing value from path !");
-        sect->Keys.erase(__compute_hash__(p, end));
+        sect->RemoveValue(__compute_hash__(p, end));
         return true;
     }
 }
 uint32 IniObject::GetSectionsCount()
 {
     VALIDATE_INITED(0);
-    return (uint32) WRAPPER->Sections.size();
+    return WRAPPER->Sections.Count();
 }
 
 string_view IniObject::ToString(bool sorted)
@@ -1631,15 +2655,15 @@ string_view IniObject::ToString(bool sorted)
     // add rest of the sections
     if (sorted)
     {
-        PointerArrayStorage<AppCUI::Ini::Section> entries(WRAPPER->Sections.size());
+        PointerArrayStorage<AppCUI::Ini::Section> entries(WRAPPER->Sections.Count());
         size_t idx = 0;
-        for (auto& entry : WRAPPER->Sections)
-            entries[idx++] = entry.second.get();
+        for (auto* entry : WRAPPER->Sections)
+            entries[idx++] = entry;
         struct
         {
             bool operator()(AppCUI::Ini::Section* s1, AppCUI::Ini::Section* s2) const
             {
-                return s1->Name.CompareWith(s2->Name.GetText(),true) < 0;
+                return CompareNames(s1->Name, s2->Name) < 0;
             }
         } CompareIniSections;
         std::sort(entries.begin(), entries.end(), CompareIniSections);
@@ -1651,9 +2675,9 @@ string_view IniObject::ToString(bool sorted)
     else
     {
         // faster -> no sort
-        for (auto& entry : WRAPPER->Sections)
+        for (auto* entry : WRAPPER->Sections)
         {
-            AddSectionToString(WRAPPER->toStringBuffer, *entry.second, sorted);
+            AddSectionToString(WRAPPER->toStringBuffer, *entry, sorted);
         }
     }
     // return result
@@ -1,7 +1,4 @@
 #include "AppCUI.hpp"
-#include <chrono>
-#include <thread>
-#include <time.h>
 
 using namespace AppCUI;
 using namespace AppCUI::Application;
@@ -9,76 +6,64 @@ using namespace AppCUI::Controls;
 using namespace AppCUI::Dialogs;
 using namespace AppCUI::Graphics;
 
-using namespace std::string_literals;
-
 constexpr uint32 VIDEO_WIDTH    = 100;
 constexpr uint32 VIDEO_HEIGHT   = 30;
+constexpr uint32 VIDEO_FPS      = 30;
+constexpr uint32 FRAME_SIZE     = VIDEO_WIDTH * VIDEO_HEIGHT;
 constexpr uint32 BUTTON_ID_PLAY = 1;
 constexpr uint32 BUTTON_ID_STOP = 2;
 
-class VideoScreen : public AppCUI::Controls::UserControl
+// every frame is a block of VIDEO_HEIGHT lines of VIDEO_WIDTH characters --> frames are read from the file only
+// when they are played (VideoView decodes them on a separate thread)
+class TextFrames : public FrameSource
 {
+    OS::File file;
+    uint32 count;
+    char buffer[FRAME_SIZE];
+
   public:
-    VideoScreen(std::string_view layout) : UserControl(layout), painitng(false), currentFrame(0)
+    TextFrames() : count(0)
     {
     }
-
-    void Paint(Graphics::Renderer& renderer) override
+    bool Open(const std::filesystem::path& path)
     {
-        if (currentFrame < frames.size())
-        {
-            renderer.Clear(' ', { Color::Transparent, Color::Transparent });
-            uint32 y = 0;
-            for (const auto& line : frames[currentFrame])
-            {
-                renderer.WriteSingleLineText(0, y, line, { Color::White, Color::Transparent });
-                ++y;
-            }
-        }
-        else
-        {
-            painitng     = false;
-            currentFrame = 0;
-        }
+        if (!file.OpenRead(path))
+            return false;
+        count = (uint32) ((file.GetSize() + FRAME_SIZE - 1) / FRAME_SIZE);
+        return count > 0;
     }
-    bool OnFrameUpdate() override
+    uint32 GetFramesCount() override
     {
-        if (painitng)
-        {
-            currentFrame++;
-            return true;
-        }
-
-        return false;
+        return count;
     }
-
-    void SetFrames(const std::vector<std::vector<std::string>>& _frames)
+    bool DrawFrame(uint32 index, Canvas& frame) override
     {
-        frames = _frames;
-    }
-
-    void SetPaining(const bool _painting)
-    {
-        painitng = _painting;
+        uint32 bytesRead = 0;
+        if (!file.Read(((uint64) index) * FRAME_SIZE, buffer, FRAME_SIZE, bytesRead))
+            return false;
+        if (!frame.Resize(VIDEO_WIDTH, VIDEO_HEIGHT))
+            return false;
+        frame.Clear(' ', { Color::White, Color::Black });
+        for (uint32 y = 0; (y < VIDEO_HEIGHT) && (y * VIDEO_WIDTH < bytesRead); y++)
+        {
+            const auto size = std::min<>(VIDEO_WIDTH, bytesRead - y * VIDEO_WIDTH);
+            frame.WriteSingleLineText(
+                  0, y, string_view(buffer + y * VIDEO_WIDTH, size), { Color::White, Color::Black });
+        }
+        return true;
     }
-
-  private:
-    bool painitng;
-    size_t currentFrame;
-    std::vector<std::vector<std::string>> frames;
 };
 
 class BadApple : public AppCUI::Controls::Window
 {
+    Reference<VideoView> video;
+
   public:
-    BadApple() : Window("ASCII Player", "d:c,w:100,h:32", WindowFlags::None)
+    BadApple() : Window("ASCII Player", "d:c,w:100,h:34", WindowFlags::None)
     {
         Factory::Button::Create(this, "Play", "x:0,y:0,w:50%,h:2", BUTTON_ID_PLAY, ButtonFlags::None);
         Factory::Button::Create(this, "Stop", "x:50%,y:0,w:50%,h:2", BUTTON_ID_STOP, ButtonFlags::None);
-        auto videoScreen = std::make_unique<VideoScreen>("x:0,y:2,h:30,w:100");
-
-        myVideo = videoScreen.get();
-        AddChildControl(std::move(videoScreen));
+        video = Factory::VideoView::Create(this, "x:0,y:2,w:100%,h:30", ViewerFlags::HideScrollBar);
 
         const auto maybeFile = AppCUI::Dialogs::FileDialog::ShowOpenFileWindow("", "Text Files:txt", "");
         if (!maybeFile.has_value())
@@ -86,31 +71,13 @@ class BadApple : public AppCUI::Controls::Window
             MessageBox::ShowError("Error", "Frames file not loaded");
             return;
         }
-        if (!txtFile.OpenRead(maybeFile.value()))
+        auto frames = std::make_unique<TextFrames>();
+        if (!frames->Open(maybeFile.value()))
         {
             MessageBox::ShowError("Error", "Can't open file for reading");
+            return;
         }
-        ReadAllFrames();
-    }
-
-    void ReadAllFrames()
-    {
-        uint32 bytesRead                  = 0;
-        char videoBuffer[VIDEO_WIDTH + 1] = { 0 };
-        do
-        {
-            std::vector<std::string> frame;
-            for (uint32 i = 0; i < VIDEO_HEIGHT; i++)
-            {
-                txtFile.Read(videoBuffer, VIDEO_WIDTH, bytesRead);
-                videoBuffer[VIDEO_WIDTH] = 0;
-                frame.push_back(videoBuffer);
-                if (bytesRead == 0)
-                    break;
-            }
-            frames.push_back(frame);
-        } while (bytesRead != 0);
-        myVideo->SetFrames(frames);
+        video->SetFrames(std::move(frames), VIDEO_FPS);
     }
 
     bool OnEvent(Reference<Control>, Event eventType, int controlID) override
@@ -124,21 +91,16 @@ class BadApple : public AppCUI::Controls::Window
         {
             if (controlID == BUTTON_ID_PLAY)
             {
-                myVideo->SetPaining(true);
+                video->Play();
             }
             else if (controlID == BUTTON_ID_STOP)
             {
-                myVideo->SetPaining(false);
+                video->Stop();
             }
             return true;
         }
         return false;
     }
-
-    Reference<VideoScreen> myVideo;
-    OS::File txtFile;
-    std::filesystem::path filePath;
-    std::vector<std::vector<std::string>> frames;
 };
 
 int main()
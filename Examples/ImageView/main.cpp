@@ -13,6 +13,7 @@ using namespace AppCUI::Utils;
 #define BTN_SHOW_COLOR_SCALES  1003
 #define BTN_SHOW_STRING_IMAGE  1004
 #define BTN_SHOW_LOAD_IMAGE    1005
+#define BTN_SHOW_LOAD_TILED    1006
 
 // image taken from https://en.wikipedia.org/wiki/Treasure_Island_Dizzy#/media/File:Treasure_Island_Dizzy.png
 uint32 dizzy_pixels[] = {
@@ -6541,18 +6542,42 @@ class ImageWinViewer : public Window, public Handlers::OnCheckInterface
 {
     Reference<ImageView> img;
 
-  public:
-    ImageWinViewer(
-          const AppCUI::Graphics::Image& _img, ImageRenderingMethod method, ImageScaleMethod scale, bool border)
-        : Window("Image view", "d:c,w:100%,h:100%", WindowFlags::None)
+    void CreateImageView(bool border)
     {
         if (border)
             img = Factory::ImageView::Create(this, "l:2,t:2,r:2,b:2", ViewerFlags::Border);
         else
             img = Factory::ImageView::Create(this, "l:0,t:1,r:0,b:0");
-        img->SetImage(_img, method, scale);
         Factory::CheckBox::Create(this, "Disable image view", "x:1,y:0,w:30")->Handlers()->OnCheck = this;
     }
+
+  public:
+    ImageWinViewer(
+          const AppCUI::Graphics::Image& _img,
+          ImageRenderingMethod method,
+          ImageScaleMethod scale,
+          bool fitToWindow,
+          bool border)
+        : Window("Image view", "d:c,w:100%,h:100%", WindowFlags::None)
+    {
+        CreateImageView(border);
+        if (fitToWindow)
+        {
+            // any scale - use '+' / '-' to zoom and '*' to fit the image again
+            img->SetImage(_img, method, 1.0);
+            img->ScaleToFit();
+        }
+        else
+            img->SetImage(_img, method, scale);
+    }
+    ImageWinViewer(AppCUI::Graphics::TiledImage&& _img, ImageRenderingMethod method, bool border)
+        : Window("Image view (tiled)", "d:c,w:100%,h:100%", WindowFlags::None)
+    {
+        // only the visible part of the image is read (use '+' / '-' to zoom and '*' to fit the image again)
+        CreateImageView(border);
+        img->SetImage(std::move(_img), method, 1.0);
+        img->ScaleToFit();
+    }
     void OnCheck(Reference<Controls::Control> control, bool /*value*/) override
     {
         img->SetEnabled(!control->IsChecked());
@@ -6566,7 +6591,7 @@ class MainWin : public Window
     Reference<CheckBox> cbBorder;
 
   public:
-    MainWin() : Window("Image example", "d:c,w:50,h:21", WindowFlags::None)
+    MainWin() : Window("Image example", "d:c,w:50,h:23", WindowFlags::None)
     {
         Factory::Button::Create(this, "Show Dizzy image !", "x:1,y:1,w:46", BTN_SHOW_DIZZY);
         Factory::Button::Create(this, "Show Me !", "x:1,y:3,w:46", BTN_SHOW_GDT);
@@ -6574,6 +6599,7 @@ class MainWin : public Window
         Factory::Button::Create(this, "Color scales", "x:1,y:7,w:46", BTN_SHOW_COLOR_SCALES);
         Factory::Button::Create(this, "String example", "x:1,y:9,w:46", BTN_SHOW_STRING_IMAGE);
         Factory::Button::Create(this, "Load image", "x:1,y:11,w:46", BTN_SHOW_LOAD_IMAGE);
+        Factory::Button::Create(this, "Load a very large image (tiled)", "x:1,y:13,w:46", BTN_SHOW_LOAD_TILED);
 
         Factory::Label::Create(this, "Method", "l:1,b:3,w:6");
         cbMethod = Factory::ComboBox::Create(
@@ -6581,7 +6607,8 @@ class MainWin : public Window
         cbMethod->SetCurentItemIndex(0);
 
         Factory::Label::Create(this, "Scale", "l:1,b:5,w:6");
-        cbScale = Factory::ComboBox::Create(this, "l:8,b:5,w:38", "No scale (keep original size),50%,25%,20%,10%,5%");
+        cbScale = Factory::ComboBox::Create(
+              this, "l:8,b:5,w:38", "No scale (keep original size),50%,25%,20%,10%,5%,Fit to window");
         cbScale->SetCurentItemIndex(0);
 
         cbBorder = Factory::CheckBox::Create(this, "Paint a &border around the image", "l:1,b:1,w:50");
@@ -6624,6 +6651,10 @@ class MainWin : public Window
             return ImageScaleMethod::NoScale;
         }
     }
+    bool IsFitToWindow()
+    {
+        return cbScale->GetCurrentItemIndex() == 6;
+    }
     bool OnEvent(Reference<Control>, Event eventType, int controlID) override
     {
         if (eventType == Event::WindowClose)
@@ -6638,7 +6669,7 @@ class MainWin : public Window
                 AppCUI::Graphics::Image img;
                 img.Create(256, 192);                                              // ZX Spectrum screen size
                 memcpy(img.GetPixelsBuffer(), dizzy_pixels, sizeof(dizzy_pixels)); // direct memory copy
-                ImageWinViewer iwv(img, GetMethod(), GetScale(), cbBorder->IsChecked());
+                ImageWinViewer iwv(img, GetMethod(), GetScale(), IsFitToWindow(), cbBorder->IsChecked());
                 iwv.Show();
                 return true;
             }
@@ -6647,7 +6678,7 @@ class MainWin : public Window
                 AppCUI::Graphics::Image img;
                 img.Create(150, 150);                                          // 150x150 small icon with my face
                 memcpy(img.GetPixelsBuffer(), gdt_pixels, sizeof(gdt_pixels)); // direct memory copy
-                ImageWinViewer iwv(img, GetMethod(), GetScale(), cbBorder->IsChecked());
+                ImageWinViewer iwv(img, GetMethod(), GetScale(), IsFitToWindow(), cbBorder->IsChecked());
                 iwv.Show();
                 return true;
             }
@@ -6678,7 +6709,7 @@ class MainWin : public Window
                         }
                     }
                 }
-                ImageWinViewer iwv(img, GetMethod(), GetScale(), cbBorder->IsChecked());
+                ImageWinViewer iwv(img, GetMethod(), GetScale(), IsFitToWindow(), cbBorder->IsChecked());
                 iwv.Show();
                 return true;
             }
@@ -6696,7 +6727,7 @@ class MainWin : public Window
                               Pixel(x * 16 * ((bit >> 2) & 1), x * 16 * ((bit >> 1) & 1), x * 16 * (bit & 1)));
                     }
                 }
-                ImageWinViewer iwv(img, GetMethod(), GetScale(), cbBorder->IsChecked());
+                ImageWinViewer iwv(img, GetMethod(), GetScale(), IsFitToWindow(), cbBorder->IsChecked());
                 iwv.Show();
                 return true;
             }
@@ -6714,7 +6745,7 @@ class MainWin : public Window
                       "...66..."
                       "..6666.."
                       "bBbBbBbB");
-                ImageWinViewer iwv(img, GetMethod(), GetScale(), cbBorder->IsChecked());
+                ImageWinViewer iwv(img, GetMethod(), GetScale(), IsFitToWindow(), cbBorder->IsChecked());
                 iwv.Show();
                 return true;
             }
@@ -6730,7 +6761,25 @@ class MainWin : public Window
                     }
                     else
                     {
-                        ImageWinViewer iwv(img, GetMethod(), GetScale(), cbBorder->IsChecked());
+                        ImageWinViewer iwv(img, GetMethod(), GetScale(), IsFitToWindow(), cbBorder->IsChecked());
+                        iwv.Show();
+                    }
+                }
+                return true;
+            }
+            if (controlID == BTN_SHOW_LOAD_TILED)
+            {
+                AppCUI::Graphics::TiledImage img;
+                auto path = AppCUI::Dialogs::FileDialog::ShowOpenFileWindow("", "Image Files:bmp,png", ".");
+                if (path.has_value())
+                {
+                    if (img.Load(path.value()) == false)
+                    {
+                        AppCUI::Dialogs::MessageBox::ShowError("Error", "Fail to open image file !");
+                    }
+                    else
+                    {
+                        ImageWinViewer iwv(std::move(img), GetMethod(), cbBorder->IsChecked());
                         iwv.Show();
                     }
                 }
@@ -126,15 +126,15 @@ int main()
     LOG_INFO("List all sections:");
     for (auto s : ini.GetSections())
     {
-        LOG_INFO("- Section: %s", s.GetName().data());
+        LOG_INFO("- Section: %.*s", (int) s.GetName().size(), s.GetName().data());
     }
     LOG_INFO("List all values for section: Values");
     for (auto v : ini.GetSection("Values").GetValues())
     {
-        LOG_INFO("- %s = %s", v.GetName().data(), v.AsString().value());
+        LOG_INFO("- %.*s = %s", (int) v.GetName().size(), v.GetName().data(), v.AsString().value());
     }
 
-    LOG_INFO("Hex buffer: %s", ini.GetSection("Strings").GetValue("hexBuffer").ToStringView().data());
+    LOG_INFO("Hex buffer: %s", ini.GetSection("Strings").GetValue("hexBuffer").ToString());
 
     auto av = ini.GetSection("Arrays").GetValue("primeNumbers");
     LOG_INFO("Prime nubers: %d", av.GetArrayCount());
@@ -142,16 +142,16 @@ int main()
     {
         LOG_INFO(" - %d", av[tr].ToUInt32());
     }
-    LOG_INFO("Lising all values from [Values] using iterators")
+    LOG_INFO("Lising all values from [Values] using iterators");
     auto sec_values = ini.GetSection("Values");
     for (auto v: sec_values)
     {
-        LOG_INFO("   Value = %s", v.GetName().data());
+        LOG_INFO("   Value = %.*s", (int) v.GetName().size(), v.GetName().data());
     }
     LOG_INFO("Listing all keys using iterators (except default one)");
     for (auto s: ini)
     {
-        LOG_INFO("   Key: %s", s.GetName().data());
+        LOG_INFO("   Key: %.*s", (int) s.GetName().size(), s.GetName().data());
     }
 
     CreateMyIni();
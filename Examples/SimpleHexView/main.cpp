@@ -1,9 +1,5 @@
 #include "AppCUI.hpp"
 #include <filesystem>
-#include <fstream>
-#include <iostream>
-#include <istream>
-#include <iterator>
 
 using namespace AppCUI;
 using namespace AppCUI::Application;
@@ -24,7 +20,11 @@ class HexViewUserControl : public UserControl
     bool Open(const fs::path& filePath)
     {
         resetAll();
-        return readAll(filePath);
+        CHECK(file.OpenRead(filePath), false, "Fail to open %s", filePath.string().c_str());
+        // scrolling reads the same pages again and again --> they are read from the file only once
+        CHECK(cache.Create(&file), false, "Fail to create a cache for %s", filePath.string().c_str());
+        fileSize = cache.GetSize();
+        return true;
     }
 
     void Paint(Graphics::Renderer& renderer) override
@@ -35,12 +35,13 @@ class HexViewUserControl : public UserControl
         const uint64 width      = GetWidth();
         const uint64 bufferSize = height * width;
         const uint64 maxProcess = std::min(bufferSize, fileSize - filePosition);
+        const auto data         = cache.GetView(filePosition, static_cast<uint32>(maxProcess));
 
-        for (uint64 i = 0; i < maxProcess; i++)
+        for (size_t i = 0; i < data.GetLength(); i++)
         {
             const int y = static_cast<int>(i / width);
             const int x = static_cast<int>(i % width);
-            renderer.WriteCharacter(x, y, fileData[filePosition + i], ColorPair{ Color::White, Color::Transparent });
+            renderer.WriteCharacter(x, y, data[i], ColorPair{ Color::White, Color::Transparent });
         }
     }
 
@@ -75,29 +76,15 @@ class HexViewUserControl : public UserControl
   private:
     void resetAll()
     {
-        fileData.clear();
+        cache.Close();
+        file.Close();
         fileSize     = 0;
         filePosition = 0;
     }
 
-    bool readAll(const fs::path& filePath)
-    {
-        CHECK(fs::exists(filePath), false, "File %s doesn't exist", filePath.string().c_str());
-        fileSize = fs::file_size(filePath);
-
-        std::ifstream fileStream(filePath);
-        fileData.reserve(fileSize);
-        std::copy(
-              std::istream_iterator<uint8>(fileStream),
-              std::istream_iterator<uint8>(),
-              std::back_inserter(fileData));
-        fileSize = fileData.size();
-
-        return true;
-    }
-
   private:
-    std::vector<uint8> fileData;
+    OS::File file;
+    OS::CachedDataObject cache;
     uint64 filePosition;
     uint64 fileSize;
 };
@@ -50,7 +50,7 @@ int main()
     )SCRIPT");
     if (result)
     {
-        LOG_INFO("Script was validated !")
+        LOG_INFO("Script was validated !");
     }
     else
     {
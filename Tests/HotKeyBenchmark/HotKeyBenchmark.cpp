@@ -0,0 +1,68 @@
+#include "AppCUI.hpp"
+#include <stdio.h>
+#include <chrono>
+#include <string>
+
+using namespace AppCUI;
+using namespace AppCUI::Application;
+using namespace AppCUI::Controls;
+
+constexpr uint32 CONTROLS_COUNT = 500;
+constexpr uint32 KEY_PRESSES    = 20000;
+
+class BigForm : public Window
+{
+  public:
+    BigForm() : Window("Form", "x:0,y:0,w:100%,h:100%", WindowFlags::Menu)
+    {
+        // 500 controls split in 10 panels (a more realistic tree than a flat list)
+        // only the last control has a hot key (worst case for a tree walk)
+        LocalString<64> caption, layout;
+        for (uint32 p = 0; p < 10; p++)
+        {
+            auto panel = Factory::Panel::Create(this, layout.Format("x:%u,y:0,w:20,h:52", p * 20));
+            for (uint32 tr = 0; tr < CONTROLS_COUNT / 10; tr++)
+            {
+                Factory::CheckBox::Create(
+                      panel, caption.Format("Option %u", p * 50 + tr), layout.Format("x:0,y:%u,w:18", tr));
+            }
+        }
+        Factory::Button::Create(this, "&Last", "r:0,b:0,w:10", 1);
+
+        auto mnu = this->AddMenu("&File");
+        for (uint32 tr = 0; tr < 64; tr++)
+            mnu->AddCommandItem(caption.Format("Command %u", tr), 100 + tr, Input::Key::None);
+        mnu->AddCommandItem("Save", 200, Input::Key::Ctrl | Input::Key::S);
+    }
+};
+bool Bench(const char* name, std::string_view key)
+{
+    CHECK(Application::InitForTests(220, 60, InitializationFlags::CommandBar, true), false, "");
+    Application::AddWindow(std::make_unique<BigForm>());
+    std::string script = "Key.PressMultipleTimes(";
+    script += key;
+    script += ",";
+    script += std::to_string(KEY_PRESSES);
+    script += ")";
+    auto start  = std::chrono::high_resolution_clock::now();
+    auto result = Application::RunTestScript(script);
+    auto end    = std::chrono::high_resolution_clock::now();
+    auto us     = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    printf("%-32s : %u presses in %8lld us (%.3f us/press)\n",
+           name,
+           KEY_PRESSES,
+           (long long) us,
+           ((double) us) / KEY_PRESSES);
+    return result;
+}
+int main()
+{
+    printf("Form with %u controls\n", CONTROLS_COUNT);
+    // Alt+Q is not used by any control --> the whole form would be scanned
+    Bench("Unused hot key (Alt+Q)", "Alt+Q");
+    // Alt+L presses the last button and Ctrl+S is a menu shortcut
+    // both are handled --> each press also includes a repaint of the form
+    Bench("Control hot key (Alt+L)", "Alt+L");
+    Bench("Menu shortcut (Ctrl+S)", "Ctrl+S");
+    return 0;
+}
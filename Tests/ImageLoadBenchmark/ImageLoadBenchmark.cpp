@@ -0,0 +1,171 @@
+#include "AppCUI.hpp"
+#include <png.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#ifdef BUILD_FOR_WINDOWS
+#    include <Windows.h>
+#    include <Psapi.h>
+#else
+#    include <sys/resource.h>
+#endif
+
+using namespace AppCUI;
+using namespace AppCUI::Graphics;
+
+// 8K image by default (~127 MB once decoded)
+constexpr uint32 DEFAULT_IMAGE_WIDTH  = 7680;
+constexpr uint32 DEFAULT_IMAGE_HEIGHT = 4320;
+
+// peak resident memory of the process (in KB)
+uint64 GetPeakMemory()
+{
+#ifdef BUILD_FOR_WINDOWS
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return 0;
+    return pmc.PeakWorkingSetSize / 1024;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#    ifdef BUILD_FOR_OSX
+    return usage.ru_maxrss / 1024; // bytes on macOS
+#    else
+    return usage.ru_maxrss;
+#    endif
+#endif
+}
+
+bool Generate(const char* fileName, uint32 width, uint32 height)
+{
+    // smooth gradients with some noise --> compresses like a photo (neither too well nor too bad)
+    FILE* f = fopen(fileName, "wb");
+    if (!f)
+        return false;
+    auto png  = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+    auto info = png_create_info_struct(png);
+    if (setjmp(png_jmpbuf(png)))
+    {
+        png_destroy_write_struct(&png, &info);
+        fclose(f);
+        return false;
+    }
+    png_init_io(png, f);
+    png_set_IHDR(png, info, width, height, 8, PNG_COLOR_TYPE_RGBA, PNG_INTERLACE_NONE, 0, 0);
+    png_write_info(png, info);
+    std::vector<uint8> row(((size_t) width) * 4);
+    uint32 seed = 12345;
+    for (uint32 y = 0; y < height; y++)
+    {
+        for (uint32 x = 0; x < width; x++)
+        {
+            seed           = seed * 1103515245 + 12345;
+            const auto n   = (seed >> 16) & 0x0F;
+            row[x * 4]     = (uint8) ((x >> 5) + n);
+            row[x * 4 + 1] = (uint8) ((y >> 4) + n);
+            row[x * 4 + 2] = (uint8) (((x + y) >> 6) + n);
+            row[x * 4 + 3] = 0xFF;
+        }
+        png_write_row(png, row.data());
+    }
+    png_write_end(png, info);
+    png_destroy_write_struct(&png, &info);
+    fclose(f);
+    return true;
+}
+
+// the way PNG files were loaded before: the whole file in a buffer, decoded in a temporary RGBA buffer and
+// then copied (with the color channels swapped) into the image
+bool LoadBuffered(Image& img, const char* fileName)
+{
+    auto buf = OS::File::ReadContent(fileName);
+    png_image pi;
+    memset(&pi, 0, sizeof(pi));
+    pi.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_memory(&pi, buf.GetData(), buf.GetLength()))
+        return false;
+    pi.format  = PNG_FORMAT_RGBA;
+    auto* temp = (uint8*) malloc(PNG_IMAGE_SIZE(pi));
+    if ((!temp) || (!png_image_finish_read(&pi, nullptr, temp, 0, nullptr)) || (!img.Create(pi.width, pi.height)))
+    {
+        free(temp);
+        return false;
+    }
+    auto* p = img.GetPixelsBuffer();
+    auto* c = temp;
+    auto* e = temp + ((size_t) pi.width) * pi.height * 4;
+    while (c < e)
+    {
+        p->Red   = *c++;
+        p->Green = *c++;
+        p->Blue  = *c++;
+        p->Alpha = *c++;
+        p++;
+    }
+    free(temp);
+    return true;
+}
+
+int main(int argc, const char** argv)
+{
+    // usage: ImageLoadBenchmark generate <file.png> [width height]
+    //        ImageLoadBenchmark load|memory|buffered <file.png>
+    // every measurement should run in its own process (the peak memory of a process never decreases)
+    if (argc < 3)
+    {
+        printf("Usage: %s generate <file.png> [width height]\n", argv[0]);
+        printf("       %s load|memory|buffered <file.png>\n", argv[0]);
+        return 1;
+    }
+    if (strcmp(argv[1], "generate") == 0)
+    {
+        const uint32 w = argc > 4 ? (uint32) atoi(argv[3]) : DEFAULT_IMAGE_WIDTH;
+        const uint32 h = argc > 4 ? (uint32) atoi(argv[4]) : DEFAULT_IMAGE_HEIGHT;
+        return Generate(argv[2], w, h) ? 0 : 1;
+    }
+
+    Image img;
+    bool result;
+    const auto memoryBefore = GetPeakMemory();
+    auto start              = std::chrono::high_resolution_clock::now();
+    if (strcmp(argv[1], "load") == 0)
+    {
+        // decoded while the file is read
+        result = img.Load(argv[2]);
+    }
+    else if (strcmp(argv[1], "memory") == 0)
+    {
+        // decoded from a buffer with the content of the file
+        auto buf = OS::File::ReadContent(argv[2]);
+        result   = img.Create(buf);
+    }
+    else
+    {
+        result = LoadBuffered(img, argv[2]);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    if (!result)
+    {
+        printf("Fail to load %s\n", argv[2]);
+        return 1;
+    }
+    uint32 checksum = 0;
+    auto* p         = img.GetPixelsBuffer();
+    for (size_t tr = ((size_t) img.GetWidth()) * img.GetHeight(); tr > 0; tr--, p++)
+        checksum = checksum * 31 + p->ColorValue;
+
+    const auto imageSize = ((uint64) img.GetWidth()) * img.GetHeight() * sizeof(Pixel) / 1024;
+    printf("%-8s %ux%u: %8lld us | image %7llu KB | peak memory %7llu KB (%.2fx the image) | checksum %08X\n",
+           argv[1],
+           img.GetWidth(),
+           img.GetHeight(),
+           (long long) std::chrono::duration_cast<std::chrono::microseconds>(end - start).count(),
+           (unsigned long long) imageSize,
+           (unsigned long long) (GetPeakMemory() - memoryBefore),
+           ((double) (GetPeakMemory() - memoryBefore)) / imageSize,
+           checksum);
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include "AppCUI.hpp"
+#include <stdio.h>
+#include <chrono>
+
+using namespace AppCUI;
+using namespace AppCUI::Application;
+using namespace AppCUI::Controls;
+using namespace AppCUI::Graphics;
+
+// 8K image zoomed so that it is 120, 240, 480 and 960 characters wide
+constexpr uint32 IMAGE_WIDTH     = 7680;
+constexpr uint32 IMAGE_HEIGHT    = 4320;
+constexpr uint32 CellsWidths[]   = { 120, 240, 480, 960 };
+// ... and zoomed in (up to the largest scale of the image view --> about 4 billion characters)
+constexpr double ZoomScales[]    = { 1.0, 1.25, 2.0, 4.0, 16.0 };
+constexpr uint32 ZOOM_ITERATIONS = 5;
+
+template <typename T>
+long long Measure(T&& fn)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    for (uint32 tr = 0; tr < ZOOM_ITERATIONS; tr++)
+        fn();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / ZOOM_ITERATIONS;
+}
+int main()
+{
+    if (!Application::InitForTests(120, 40))
+        return 1;
+    Image img;
+    if (!img.Create(IMAGE_WIDTH, IMAGE_HEIGHT))
+        return 1;
+    auto* p = img.GetPixelsBuffer();
+    for (uint32 y = 0; y < IMAGE_HEIGHT; y++)
+        for (uint32 x = 0; x < IMAGE_WIDTH; x++, p++)
+            *p = Pixel((uint8) (x >> 4), (uint8) (y >> 4), (uint8) ((x ^ y) & 0xFF));
+
+    // the view has to be inside a window (its size is needed to know what is visible)
+    auto wnd   = Factory::Window::Create("Image", "x:0,y:0,w:100%,h:100%", WindowFlags::None);
+    auto view  = Factory::ImageView::Create(wnd, "x:0,y:0,w:100%,h:100%");
+    Application::AddWindow(std::move(wnd));
+    auto start = std::chrono::high_resolution_clock::now();
+    if (!view->SetImage(img, ImageRenderingMethod::PixelTo16ColorsSmallBlock, 1.0 / 64.0))
+        return 1;
+    auto end = std::chrono::high_resolution_clock::now();
+    printf("ImageView::SetImage (summed-area table + first render): %lld us\n",
+           (long long) std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+    Canvas canvas;
+    uint32 checksum = 0;
+    for (auto cellsWidth : CellsWidths)
+    {
+        const uint32 box         = IMAGE_WIDTH / cellsWidth;
+        const uint32 cellsHeight = IMAGE_HEIGHT / (box * 2);
+
+        // a box average per pixel half of a character, straight from the pixels
+        auto squareAverage = Measure([&]() {
+            for (uint32 y = 0; y < IMAGE_HEIGHT; y += box)
+                for (uint32 x = 0; x < IMAGE_WIDTH; x += box)
+                    checksum += img.ComputeSquareAverageColor(x, y, box).ColorValue;
+        });
+        // every pixel read once, per column sums (the image is modified so that the cached cells are not used)
+        canvas.Resize(cellsWidth, cellsHeight);
+        auto bandAverage = Measure([&]() {
+            img.SetPixel(0, 0, Pixel((uint8) (checksum++), 0, 0));
+            canvas.DrawImage(img, 0, 0, cellsWidth, cellsHeight, ImageRenderingMethod::PixelTo16ColorsSmallBlock);
+        });
+        // O(1) per box from the summed-area table kept by the image view
+        auto summedArea = Measure([&]() { view->SetScale(((double) cellsWidth) / IMAGE_WIDTH); });
+
+        printf("%4u characters (%2ux%-2u pixels boxes): ComputeSquareAverageColor %8lld us | DrawImage %8lld us | "
+               "ImageView::SetScale %6lld us\n",
+               cellsWidth,
+               box,
+               box,
+               squareAverage,
+               bandAverage,
+               summedArea);
+    }
+    // only the visible characters are rendered, no matter how large the zoomed image is
+    for (auto scale : ZoomScales)
+    {
+        auto zoomIn = Measure([&]() { view->SetScale(scale); });
+        auto scroll = Measure([&]() {
+            view->OnKeyEvent(Input::Key::Shift | Input::Key::Right, 0);
+            view->OnKeyEvent(Input::Key::Shift | Input::Key::Down, 0);
+            view->Paint(canvas);
+        });
+        printf("scale %5.2f (%6ux%-5u characters): ImageView::SetScale %6lld us | scroll one screen %6lld us\n",
+               scale,
+               (uint32) (IMAGE_WIDTH * scale),
+               (uint32) (IMAGE_HEIGHT * scale / 2.0),
+               zoomIn,
+               scroll);
+    }
+    printf("(checksum: %08X)\n", checksum);
+    return 0;
+}
@@ -0,0 +1,180 @@
+#include "AppCUI.hpp"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <chrono>
+#ifdef BUILD_FOR_WINDOWS
+#    include <Windows.h>
+#    include <Psapi.h>
+#else
+#    include <sys/resource.h>
+#endif
+
+using namespace AppCUI;
+using namespace AppCUI::Utils;
+
+// ~50 MB by default
+constexpr uint32 DEFAULT_SECTIONS     = 5000;
+constexpr uint32 DEFAULT_KEYS         = 200;
+constexpr uint32 LOOKUPS              = 1000000;
+constexpr uint32 PARSE_REPEAT         = 10;
+constexpr uint32 ARRAY_KEY_FREQUENCY  = 10; // one key out of 10 is an array
+constexpr uint32 STRING_KEY_FREQUENCY = 7;  // one key out of 7 is a quoted string
+
+// peak resident memory of the process (in KB)
+uint64 GetPeakMemory()
+{
+#ifdef BUILD_FOR_WINDOWS
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return 0;
+    return pmc.PeakWorkingSetSize / 1024;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#    ifdef BUILD_FOR_OSX
+    return usage.ru_maxrss / 1024; // bytes on macOS
+#    else
+    return usage.ru_maxrss;
+#    endif
+#endif
+}
+
+// best parse time (the text is already in memory - this is the speed of the tokenizer and of the hash tables)
+int Parse(const char* fileName)
+{
+    auto buf = OS::File::ReadContent(fileName);
+    if (buf.GetLength() == 0)
+    {
+        printf("Fail to read %s\n", fileName);
+        return 1;
+    }
+    long long best = 0;
+    for (uint32 tr = 0; tr < PARSE_REPEAT; tr++)
+    {
+        IniObject ini;
+        const auto start = std::chrono::high_resolution_clock::now();
+        if (!ini.CreateFromString(buf))
+        {
+            printf("Fail to parse %s\n", fileName);
+            return 1;
+        }
+        const auto end  = std::chrono::high_resolution_clock::now();
+        const auto time = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        if ((tr == 0) || (time < best))
+            best = time;
+    }
+    printf("parse  %llu bytes: best of %u %8lld us | %8.1f MB/s\n",
+           (unsigned long long) buf.GetLength(),
+           PARSE_REPEAT,
+           best,
+           best > 0 ? ((double) buf.GetLength()) / ((double) best) : 0.0);
+    return 0;
+}
+
+bool Generate(const char* fileName, uint32 sections, uint32 keys)
+{
+    FILE* f = fopen(fileName, "wb");
+    if (!f)
+        return false;
+    for (uint32 s = 0; s < sections; s++)
+    {
+        fprintf(f, "\n[Section.%05u]\n", s);
+        for (uint32 k = 0; k < keys; k++)
+        {
+            if ((k % ARRAY_KEY_FREQUENCY) == 0)
+                fprintf(f, "array_key_%04u = [%u, %u, %u, %u]\n", k, s, k, s + k, s * k);
+            else if ((k % STRING_KEY_FREQUENCY) == 0)
+                fprintf(f, "string_key_%04u = \"a longer text value for key %u of section %u\"\n", k, k, s);
+            else
+                fprintf(f, "numeric_key_%04u = %u ; a comment\n", k, s * 1000 + k);
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+int main(int argc, const char** argv)
+{
+    // usage: IniLoadBenchmark generate <file.ini> [sections keys]
+    //        IniLoadBenchmark file|string <file.ini>
+    //        IniLoadBenchmark parse <file.ini>
+    // every measurement should run in its own process (the peak memory of a process never decreases)
+    if (argc < 3)
+    {
+        printf("Usage: %s generate <file.ini> [sections keys]\n", argv[0]);
+        printf("       %s file|string <file.ini>\n", argv[0]);
+        printf("       %s parse <file.ini>\n", argv[0]);
+        return 1;
+    }
+    if (strcmp(argv[1], "generate") == 0)
+    {
+        const uint32 sections = argc > 4 ? (uint32) atoi(argv[3]) : DEFAULT_SECTIONS;
+        const uint32 keys     = argc > 4 ? (uint32) atoi(argv[4]) : DEFAULT_KEYS;
+        return Generate(argv[2], sections, keys) ? 0 : 1;
+    }
+    if (strcmp(argv[1], "parse") == 0)
+        return Parse(argv[2]);
+
+    IniObject ini;
+    bool result;
+    const auto memoryBefore = GetPeakMemory();
+    auto start              = std::chrono::high_resolution_clock::now();
+    if (strcmp(argv[1], "file") == 0)
+    {
+        // keys and values refer to the mapped file
+        result = ini.CreateFromFile(argv[2]);
+    }
+    else
+    {
+        // keys and values refer to a copy of the buffer
+        auto buf = OS::File::ReadContent(argv[2]);
+        result   = ini.CreateFromString(buf);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    if (!result)
+    {
+        printf("Fail to load %s\n", argv[2]);
+        return 1;
+    }
+    const auto loadTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    const auto memory   = GetPeakMemory() - memoryBefore;
+
+    uint32 keys = 0;
+    for (auto section : ini)
+        for (auto value : section)
+            keys += value.HasValue() ? 1 : 0;
+
+    // random lookups (most of them exist)
+    const auto sections = ini.GetSectionsCount();
+    uint64 checksum     = 0;
+    uint32 seed         = 12345;
+    LocalString<64> path;
+    start = std::chrono::high_resolution_clock::now();
+    for (uint32 tr = 0; tr < LOOKUPS; tr++)
+    {
+        seed         = seed * 1103515245 + 12345;
+        const auto s = (seed >> 8) % (sections + 1);
+        const auto k = (seed >> 4) % DEFAULT_KEYS;
+        if ((k % ARRAY_KEY_FREQUENCY) == 0)
+            checksum += ini.GetValue(path.Format("Section.%05u/array_key_%04u", s, k))[3].ToUInt32(0);
+        else if ((k % STRING_KEY_FREQUENCY) == 0)
+            checksum += ini.GetValue(path.Format("Section.%05u/string_key_%04u", s, k)).ToStringView().size();
+        else
+            checksum += ini.GetValue(path.Format("Section.%05u/numeric_key_%04u", s, k)).ToUInt32(0);
+    }
+    end = std::chrono::high_resolution_clock::now();
+
+    printf("%-6s %u sections, %u keys: load %8lld us | peak memory %7llu KB | %u lookups %7lld us | checksum "
+           "%016llX\n",
+           argv[1],
+           sections,
+           keys,
+           (long long) loadTime,
+           (unsigned long long) memory,
+           LOOKUPS,
+           (long long) std::chrono::duration_cast<std::chrono::microseconds>(end - start).count(),
+           (unsigned long long) checksum);
+    return 0;
+}
@@ -0,0 +1,39 @@
+#include "AppCUI.hpp"
+#include <stdio.h>
+#include <chrono>
+
+using namespace AppCUI;
+using namespace AppCUI::Application;
+using namespace AppCUI::Controls;
+
+constexpr uint32 CONTROLS_COUNT = 200000;
+
+template <typename T>
+void Bench(const char* name, const T& layout)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    for (uint32 tr = 0; tr < CONTROLS_COUNT; tr++)
+    {
+        auto lbl = Factory::Label::Create("Label", layout);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto us  = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    printf("%-40s : %u controls in %8lld us (%.0f controls/sec)\n",
+           name,
+           CONTROLS_COUNT,
+           (long long) us,
+           us > 0 ? ((double) CONTROLS_COUNT * 1000000.0) / us : 0.0);
+}
+int main()
+{
+    if (!Application::InitForTests(120, 40, InitializationFlags::None, true))
+        return 1;
+    // each layout is measured twice: parsed at runtime (string) and parsed at compile time (_layout)
+    Bench("x:1,y:2,w:15,h:1", "x:1,y:2,w:15,h:1");
+    Bench("x:1,y:2,w:15,h:1 (_layout)", "x:1,y:2,w:15,h:1"_layout);
+    Bench("left:1,top:1,right:1,bottom:1", "left:1,top:1,right:1,bottom:1");
+    Bench("left:1,top:1,right:1,bottom:1 (_layout)", "left:1,top:1,right:1,bottom:1"_layout);
+    Bench("a:c,x:50%,y:50%,w:50%,h:10", "a:c,x:50%,y:50%,w:50%,h:10");
+    Bench("a:c,x:50%,y:50%,w:50%,h:10 (_layout)", "a:c,x:50%,y:50%,w:50%,h:10"_layout);
+    return 0;
+}
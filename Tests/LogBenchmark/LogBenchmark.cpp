@@ -0,0 +1,124 @@
+#include "AppCUI.hpp"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace AppCUI;
+
+constexpr uint32 DEFAULT_THREADS  = 4;
+constexpr uint32 DEFAULT_MESSAGES = 100000; // per thread
+constexpr uint32 SMALL_QUEUE_SIZE = 0x10000;
+constexpr uint32 LARGE_QUEUE_SIZE = 0x4000000; // the messages fit in the queue --> only the cost of the call is measured
+
+// Log::Report and Log::ReportStructured are called directly (LOG_INFO does nothing in release builds)
+void LogMessages(uint32 threadID, uint32 messages)
+{
+    for (uint32 tr = 0; tr < messages; tr++)
+        Log::Report(
+              Log::Severity::Information,
+              __FILE__,
+              __FUNCTION__,
+              "",
+              __LINE__,
+              "Thread %u, message %u (a short text that is similar to the usual log messages)",
+              threadID,
+              tr);
+}
+void LogStructuredMessages(uint32 threadID, uint32 messages)
+{
+    for (uint32 tr = 0; tr < messages; tr++)
+        Log::ReportStructured(
+              Log::Severity::Information,
+              __FILE__,
+              __FUNCTION__,
+              "",
+              __LINE__,
+              "Thread %u, message %u (a short text that is similar to the usual log messages)",
+              threadID,
+              tr);
+}
+
+// a string that does not fit in a deferred record is truncated, but the arguments that follow it are still written
+// (the strings that follow it are empty)
+int CheckLongString(const char* fileName)
+{
+    if (!Log::ToFileAsync(fileName, SMALL_QUEUE_SIZE))
+    {
+        printf("Fail to create %s\n", fileName);
+        return 1;
+    }
+    std::string big(5000, 'x');
+    Log::ReportStructured(
+          Log::Severity::Information, __FILE__, __FUNCTION__, "", __LINE__, "big=%s end=%d", big.c_str(), 1);
+    Log::ReportStructured(
+          Log::Severity::Information, __FILE__, __FUNCTION__, "", __LINE__, "%s|%s|%s", big.c_str(), "a", "b");
+    Log::ToStdOut(); // closes the async writer (everything is written)
+
+    std::string content;
+    if (auto f = fopen(fileName, "rb"))
+    {
+        char buffer[4096];
+        size_t read;
+        while ((read = fread(buffer, 1, sizeof(buffer), f)) > 0)
+            content.append(buffer, read);
+        fclose(f);
+    }
+    const bool result = (content.find("big=xxx") != std::string::npos) &&
+                        (content.find("x end=1") != std::string::npos) &&
+                        (content.find("x||\n") != std::string::npos) && (content.find(big) == std::string::npos);
+    printf("check    long string followed by other arguments: %s\n", result ? "OK" : "FAILED");
+    return result ? 0 : 1;
+}
+
+int main(int argc, const char** argv)
+{
+    // usage: LogBenchmark sync|async|drop|deferred|check <file.log> [threads messages]
+    // the time spent in Log::Report by the threads that log and the time needed to write what is left in the queue
+    if (argc < 3)
+    {
+        printf("Usage: %s sync|async|drop|deferred|check <file.log> [threads messages]\n", argv[0]);
+        return 1;
+    }
+    if (strcmp(argv[1], "check") == 0)
+        return CheckLongString(argv[2]);
+    const uint32 threads  = argc > 4 ? (uint32) atoi(argv[3]) : DEFAULT_THREADS;
+    const uint32 messages = argc > 4 ? (uint32) atoi(argv[4]) : DEFAULT_MESSAGES;
+    bool result;
+    if (strcmp(argv[1], "sync") == 0)
+        result = Log::ToFile(argv[2]);
+    else if ((strcmp(argv[1], "async") == 0) || (strcmp(argv[1], "deferred") == 0))
+        result = Log::ToFileAsync(argv[2], LARGE_QUEUE_SIZE);
+    else
+        result = Log::ToFileAsync(argv[2], SMALL_QUEUE_SIZE, Log::OverflowPolicy::Drop);
+    if (!result)
+    {
+        printf("Fail to create %s\n", argv[2]);
+        return 1;
+    }
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> workers;
+    for (uint32 tr = 0; tr < threads; tr++)
+        workers.emplace_back(strcmp(argv[1], "deferred") == 0 ? LogStructuredMessages : LogMessages, tr, messages);
+    for (auto& worker : workers)
+        worker.join();
+    const auto logged = std::chrono::high_resolution_clock::now();
+    Log::Flush();
+    const auto flushed = std::chrono::high_resolution_clock::now();
+
+    const auto logTime   = std::chrono::duration_cast<std::chrono::microseconds>(logged - start).count();
+    const auto flushTime = std::chrono::duration_cast<std::chrono::microseconds>(flushed - logged).count();
+    printf("%-8s %u threads x %u messages: log %8lld us (%6.1f ns/message) | flush %8lld us\n",
+           argv[1],
+           threads,
+           messages,
+           (long long) logTime,
+           ((double) logTime) * 1000.0 / ((double) threads * messages),
+           (long long) flushTime);
+    Log::ToStdOut(); // closes the async writer
+    return 0;
+}
@@ -0,0 +1,142 @@
+#include "AppCUI.hpp"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <chrono>
+
+using namespace AppCUI;
+using namespace AppCUI::OS;
+
+constexpr uint32 CHUNK_SIZE     = 4096;
+constexpr uint32 RANDOM_READS   = 200000;
+constexpr uint64 DEFAULT_SIZE   = 0x40000000ULL; // 1 GB
+constexpr uint32 GENERATE_CHUNK = 0x100000;
+
+bool Generate(const char* fileName, uint64 size)
+{
+    FILE* f = fopen(fileName, "wb");
+    if (!f)
+        return false;
+    auto* buf   = new uint8[GENERATE_CHUNK];
+    uint32 seed = 12345;
+    for (uint64 written = 0; written < size; written += GENERATE_CHUNK)
+    {
+        for (uint32 tr = 0; tr < GENERATE_CHUNK; tr++)
+        {
+            seed    = seed * 1103515245 + 12345;
+            buf[tr] = (uint8) (seed >> 16);
+        }
+        fwrite(buf, 1, (size_t) std::min<>((uint64) GENERATE_CHUNK, size - written), f);
+    }
+    delete[] buf;
+    fclose(f);
+    return true;
+}
+
+uint64 Checksum(const uint8* data, size_t size)
+{
+    uint64 sum = 0;
+    for (size_t tr = 0; tr < size; tr++)
+        sum += data[tr];
+    return sum;
+}
+
+// the same 4K chunks are read from a File (read/lseek), a MappedFile (copy), a MappedFile (view) and a File through
+// a CachedDataObject (view)
+int Run(const char* mode, const char* fileName, uint64 budget, bool random)
+{
+    File file;
+    MappedFile mapped;
+    CachedDataObject cache;
+    uint8 buf[CHUNK_SIZE];
+    uint32 bytesRead;
+    uint64 checksum = 0;
+    uint64 size;
+    if (strcmp(mode, "file") == 0)
+    {
+        if (!file.OpenRead(fileName))
+            return 1;
+        size = file.GetSize();
+    }
+    else if (strcmp(mode, "cached") == 0)
+    {
+        if ((!file.OpenRead(fileName)) || (!cache.Create(&file)))
+            return 1;
+        size = cache.GetSize();
+    }
+    else
+    {
+        if (!mapped.Open(fileName, budget))
+            return 1;
+        mapped.SetAccessPattern(random ? AccessPattern::Random : AccessPattern::Sequential);
+        size = mapped.GetSize();
+    }
+    const auto chunks = size / CHUNK_SIZE;
+    const auto reads  = random ? (uint64) RANDOM_READS : chunks;
+    uint64 seed       = 12345;
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (uint64 tr = 0; tr < reads; tr++)
+    {
+        auto offset = tr * CHUNK_SIZE;
+        if (random)
+        {
+            seed   = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            offset = ((seed >> 16) % chunks) * CHUNK_SIZE;
+        }
+        if (strcmp(mode, "file") == 0)
+        {
+            if (!file.Read(offset, buf, CHUNK_SIZE, bytesRead))
+                return 1;
+            checksum += Checksum(buf, bytesRead);
+        }
+        else if (strcmp(mode, "cached") == 0)
+        {
+            auto view = cache.GetView(offset, CHUNK_SIZE);
+            checksum += Checksum(view.GetData(), view.GetLength());
+        }
+        else if (strcmp(mode, "copy") == 0)
+        {
+            if (!mapped.Read(offset, buf, CHUNK_SIZE, bytesRead))
+                return 1;
+            checksum += Checksum(buf, bytesRead);
+        }
+        else
+        {
+            auto view = mapped.GetView(offset, CHUNK_SIZE);
+            checksum += Checksum(view.GetData(), view.GetLength());
+        }
+    }
+    const auto end  = std::chrono::high_resolution_clock::now();
+    const auto time = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    printf("%-6s %-10s %8llu reads: %8lld us | %8.1f MB/s | checksum %016llX\n",
+           mode,
+           random ? "random" : "sequential",
+           (unsigned long long) reads,
+           (long long) time,
+           time > 0 ? ((double) (reads * CHUNK_SIZE)) / ((double) time) : 0.0,
+           (unsigned long long) checksum);
+    return 0;
+}
+
+int main(int argc, const char** argv)
+{
+    // usage: MappedFileBenchmark generate <file> [size]
+    //        MappedFileBenchmark file|copy|view|cached sequential|random <file> [address space budget]
+    // the file should be larger than the RAM (or the page cache should be dropped) to measure the disk access
+    if ((argc >= 3) && (strcmp(argv[1], "generate") == 0))
+        return Generate(argv[2], argc > 3 ? strtoull(argv[3], nullptr, 0) : DEFAULT_SIZE) ? 0 : 1;
+    if (argc < 4)
+    {
+        printf("Usage: %s generate <file> [size]\n", argv[0]);
+        printf("       %s file|copy|view|cached sequential|random <file> [address space budget]\n", argv[0]);
+        return 1;
+    }
+    const auto budget = argc > 4 ? strtoull(argv[4], nullptr, 0) : 0ULL;
+    if (Run(argv[1], argv[3], budget, strcmp(argv[2], "random") == 0) != 0)
+    {
+        printf("Fail to read %s\n", argv[3]);
+        return 1;
+    }
+    return 0;
+}
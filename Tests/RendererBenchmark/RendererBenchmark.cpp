@@ -0,0 +1,82 @@
+#include "AppCUI.hpp"
+#include <stdio.h>
+#include <chrono>
+
+using namespace AppCUI;
+using namespace AppCUI::Graphics;
+using namespace AppCUI::Utils;
+
+constexpr uint32 CELLS_PER_TEST = 50000000;
+
+struct ControlSize
+{
+    const char* Name;
+    uint32 Width, Height;
+};
+// typical sizes: a button, a single line text field, a dialog and a full screen desktop
+constexpr ControlSize Sizes[] = {
+    { "button", 10, 1 }, { "textfield", 40, 1 }, { "window", 60, 20 }, { "desktop", 200, 60 }
+};
+
+template <typename T>
+void Bench(const char* name, const ControlSize& sz, T&& fn)
+{
+    const uint32 cells      = sz.Width * sz.Height;
+    const uint32 iterations = CELLS_PER_TEST / cells;
+    auto start              = std::chrono::high_resolution_clock::now();
+    for (uint32 tr = 0; tr < iterations; tr++)
+        fn(tr);
+    auto end = std::chrono::high_resolution_clock::now();
+    auto us  = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    printf("%-36s %-10s (%3ux%-2u) : %8lld us (%.0f Mcells/sec)\n",
+           name,
+           sz.Name,
+           sz.Width,
+           sz.Height,
+           (long long) us,
+           us > 0 ? ((double) iterations * cells) / us : 0.0);
+}
+int main()
+{
+    Canvas surface, source;
+    if (!surface.Create(220, 70))
+        return 1;
+    if (!source.Create(200, 60, '*', ColorPair{ Color::White, Color::DarkBlue }))
+        return 1;
+    Character line[200];
+    for (uint32 tr = 0; tr < 200; tr++)
+    {
+        line[tr].Code  = 'a' + (tr % 26);
+        line[tr].Color = ColorPair{ (tr & 1) ? Color::Transparent : Color::Yellow, Color::Transparent };
+    }
+    for (const auto& sz : Sizes)
+    {
+        const int r = (int) sz.Width - 1;
+        const int b = (int) sz.Height - 1;
+        Bench("FillRect (opaque)", sz, [&](uint32 tr) {
+            surface.FillRect(1, 1, r + 1, b + 1, ' ', ColorPair{ Color::Black, (Color) (tr & 15) });
+        });
+        Bench("FillRect (transparent foreground)", sz, [&](uint32 tr) {
+            surface.FillRect(1, 1, r + 1, b + 1, -1, ColorPair{ Color::Transparent, (Color) (tr & 15) });
+        });
+        Bench("FillHorizontalLine (per row)", sz, [&](uint32 tr) {
+            for (int y = 0; y <= b; y++)
+                surface.FillHorizontalLine(1, y + 1, r + 1, '-', ColorPair{ Color::White, (Color) (tr & 15) });
+        });
+        Bench("Clear (clipped)", sz, [&](uint32 tr) {
+            surface.SetClipRect({ { 1, 1 }, { sz.Width, sz.Height } });
+            surface.Clear(' ', ColorPair{ Color::White, (Color) (tr & 15) });
+            surface.ResetClip();
+        });
+        Bench("DrawCanvas (overwrite background)", sz, [&](uint32 tr) {
+            surface.SetClipRect({ { 1, 1 }, { sz.Width, sz.Height } });
+            surface.DrawCanvas(1, 1, source, ColorPair{ Color::Transparent, (Color) (tr & 15) });
+            surface.ResetClip();
+        });
+        Bench("WriteSingleLineCharacterBuffer", sz, [&](uint32) {
+            for (int y = 0; y <= b; y++)
+                surface.WriteSingleLineCharacterBuffer(1, y + 1, CharacterView(line, sz.Width), false);
+        });
+    }
+    return 0;
+}
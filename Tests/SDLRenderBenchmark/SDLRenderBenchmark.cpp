@@ -0,0 +1,74 @@
+#include "AppCUI.hpp"
+#include <stdio.h>
+#include <string>
+
+using namespace AppCUI;
+using namespace AppCUI::Application;
+using namespace AppCUI::Controls;
+
+constexpr uint32 CHECKBOXES_COUNT = 60;
+constexpr uint32 FRAMES_COUNT     = 500;
+constexpr int BUTTON_STATS        = 1;
+
+class BenchmarkWindow : public Window
+{
+  public:
+    BenchmarkWindow() : Window("SDL render benchmark", "x:0,y:0,w:100%,h:100%", WindowFlags::None)
+    {
+        // 3 columns of check boxes with different (unicode) captions --> many different glyphs
+        LocalString<64> layout;
+        LocalUnicodeStringBuilder<64> caption;
+        for (uint32 tr = 0; tr < CHECKBOXES_COUNT; tr++)
+        {
+            caption.Set("Option ");
+            caption.AddChar(static_cast<char16>(0x0410 + tr));        // cyrillic
+            caption.AddChar(static_cast<char16>(0x03B1 + (tr % 24))); // greek
+            Factory::CheckBox::Create(this, caption, layout.Format("x:%u,y:%u,w:30", (tr / 20) * 32, tr % 20));
+        }
+        Factory::Button::Create(this, "&Stats", "r:1,b:0,w:12", BUTTON_STATS);
+    }
+    bool OnEvent(Reference<Control> control, Event eventType, int ID) override
+    {
+        if ((eventType == Event::ButtonClicked) && (ID == BUTTON_STATS))
+        {
+            GlyphCacheStats stats;
+            if (Application::GetGlyphCacheStats(stats))
+            {
+                printf("Glyph cache: %llu hits, %llu misses, %llu evictions, %u/%u glyphs (%llu bytes budget)\n",
+                       (unsigned long long) stats.Hits,
+                       (unsigned long long) stats.Misses,
+                       (unsigned long long) stats.Evictions,
+                       stats.UsedGlyphs,
+                       stats.MaxGlyphs,
+                       (unsigned long long) stats.MemoryBudget);
+            }
+            return true;
+        }
+        return Window::OnEvent(control, eventType, ID);
+    }
+};
+int main(int argc, const char** argv)
+{
+    // usage: SDLRenderBenchmark [golden.png]
+    InitializationData initData;
+    initData.Width    = 120;
+    initData.Height   = 40;
+    initData.Frontend = FrontendType::SDLHeadless;
+    if (!Application::Init(initData))
+        return 1;
+    Application::AddWindow(std::make_unique<BenchmarkWindow>());
+
+    // every Tab press moves the focus to another check box --> a repaint with only a few changed cells
+    std::string script = "Key.PressMultipleTimes(Tab," + std::to_string(FRAMES_COUNT) + ")\n";
+    script += "Frame.PrintRenderTime()\n";
+    // every resize forces a full redraw
+    script += "Terminal.Resize(100,30)\nTerminal.Resize(120,40)\nFrame.PrintRenderTime()\n";
+    if (argc > 1)
+    {
+        script += "Frame.Save(";
+        script += argv[1];
+        script += ")\n";
+    }
+    script += "Key.Press(Alt+S)\n";
+    return Application::RunTestScript(script) ? 0 : 1;
+}
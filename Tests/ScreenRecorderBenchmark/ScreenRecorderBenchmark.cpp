@@ -0,0 +1,91 @@
+#include "AppCUI.hpp"
+#include <stdio.h>
+#include <chrono>
+#include <string>
+
+using namespace AppCUI;
+using namespace AppCUI::Application;
+using namespace AppCUI::Controls;
+using namespace AppCUI::Graphics;
+
+constexpr uint32 CONTROLS_COUNT = 200;
+constexpr uint32 KEY_PRESSES    = 5000;
+constexpr uint32 SEEKS          = 1000;
+
+class BigForm : public Window
+{
+  public:
+    BigForm() : Window("Form", "x:0,y:0,w:100%,h:100%", WindowFlags::None)
+    {
+        // every Tab moves the focus to another check box --> every key press changes a few lines of the screen
+        LocalString<64> caption, layout;
+        for (uint32 tr = 0; tr < CONTROLS_COUNT; tr++)
+        {
+            Factory::CheckBox::Create(
+                  this, caption.Format("Option %u", tr), layout.Format("x:%u,y:%u,w:18", (tr / 50) * 20, tr % 50));
+        }
+    }
+};
+long long Run(const char* recordingFile)
+{
+    CHECK(Application::InitForTests(200, 60, InitializationFlags::None, true), -1, "");
+    Application::AddWindow(std::make_unique<BigForm>());
+    if (recordingFile)
+    {
+        CHECK(Application::Recorder::Start(recordingFile), -1, "");
+    }
+    // the application is closed (and the recording is finished) when the script ends
+    std::string script = "Key.PressMultipleTimes(Tab," + std::to_string(KEY_PRESSES) + ")";
+    auto start         = std::chrono::high_resolution_clock::now();
+    CHECK(Application::RunTestScript(script), -1, "");
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+int main(int argc, const char** argv)
+{
+    // usage: ScreenRecorderBenchmark <recording file>
+    if (argc < 2)
+    {
+        printf("Usage: %s <recording file>\n", argv[0]);
+        return 1;
+    }
+    auto normal   = Run(nullptr);
+    auto recorded = Run(argv[1]);
+    printf("%u key presses (200x60 screen)\n", KEY_PRESSES);
+    printf("Without recording: %8lld us (%.3f us/frame)\n", normal, ((double) normal) / KEY_PRESSES);
+    printf("With recording   : %8lld us (%.3f us/frame)\n", recorded, ((double) recorded) / KEY_PRESSES);
+    printf("Recording cost   : %8lld us (%.3f us/frame)\n",
+           recorded - normal,
+           ((double) (recorded - normal)) / KEY_PRESSES);
+
+    ScreenRecording rec;
+    if (!rec.Open(argv[1]))
+    {
+        printf("Fail to open %s\n", argv[1]);
+        return 1;
+    }
+    OS::File f;
+    uint64 size = 0;
+    if (f.OpenRead(argv[1]))
+        size = f.GetSize();
+    printf("Recording: %u frames, %llu bytes (%.1f bytes/frame, raw frame: %u bytes)\n",
+           rec.GetFramesCount(),
+           (unsigned long long) size,
+           ((double) size) / rec.GetFramesCount(),
+           200 * 60 * (uint32) sizeof(Character));
+
+    Canvas frame;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (uint32 tr = 0; tr < rec.GetFramesCount(); tr++)
+        rec.DrawFrame(tr, frame);
+    auto end = std::chrono::high_resolution_clock::now();
+    auto us  = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    printf("Sequential decoding: %.3f us/frame\n", ((double) us) / rec.GetFramesCount());
+    start = std::chrono::high_resolution_clock::now();
+    for (uint32 tr = 0; tr < SEEKS; tr++)
+        rec.DrawFrame((tr * 7919) % rec.GetFramesCount(), frame);
+    end = std::chrono::high_resolution_clock::now();
+    us  = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    printf("Random seeks: %.3f us/seek\n", ((double) us) / SEEKS);
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include "AppCUI.hpp"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+using namespace AppCUI;
+using namespace AppCUI::Application;
+using namespace AppCUI::Controls;
+using namespace AppCUI::Graphics;
+
+// 30000 x 20000 pixels, 24 bits/pixel --> a 1.8 GB bitmap
+constexpr uint32 IMAGE_WIDTH  = 30000;
+constexpr uint32 IMAGE_HEIGHT = 20000;
+constexpr uint32 SCROLL_STEPS = 50;
+
+bool GenerateBitmap(const char* fileName)
+{
+    OS::File f;
+    if (!f.Create(fileName, true))
+        return false;
+    const uint32 lineSize = ((IMAGE_WIDTH * 3 + 3) / 4) * 4;
+    const uint64 size     = 54ULL + (uint64) lineSize * IMAGE_HEIGHT;
+    uint8 header[54]      = { 'B', 'M' };
+    const uint32 fields[] = { (uint32) size, 0, 54, 40, IMAGE_WIDTH, IMAGE_HEIGHT };
+    memcpy(header + 2, fields, sizeof(fields));
+    header[26] = 1;  // color planes
+    header[28] = 24; // bits per pixel
+    if (!f.Write(header, sizeof(header)))
+        return false;
+    std::vector<uint8> line(lineSize, 0);
+    for (uint32 y = 0; y < IMAGE_HEIGHT; y++)
+    {
+        for (uint32 x = 0; x < IMAGE_WIDTH; x++)
+        {
+            line[x * 3]     = (uint8) ((x >> 6) ^ (y >> 6));
+            line[x * 3 + 1] = (uint8) (y >> 4);
+            line[x * 3 + 2] = (uint8) (x >> 4);
+        }
+        if (!f.Write(line.data(), lineSize))
+            return false;
+    }
+    f.Close();
+    return true;
+}
+
+template <typename T>
+long long Measure(T&& fn)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    fn();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+int main(int argc, const char** argv)
+{
+    // usage: TiledImageBenchmark <file.bmp> [generate]
+    if (argc < 2)
+    {
+        printf("Usage: %s <file.bmp> [generate]\n", argv[0]);
+        return 1;
+    }
+    if ((argc > 2) && (strcmp(argv[2], "generate") == 0))
+    {
+        auto t = Measure([&]() { GenerateBitmap(argv[1]); });
+        printf("Generated a %ux%u bitmap in %lld ms\n", IMAGE_WIDTH, IMAGE_HEIGHT, t / 1000);
+    }
+    if (!Application::InitForTests(120, 40))
+        return 1;
+
+    TiledImage img;
+    bool result = false;
+    auto load   = Measure([&]() { result = img.Load(argv[1]); });
+    if (!result)
+    {
+        printf("Fail to load %s\n", argv[1]);
+        return 1;
+    }
+    printf("TiledImage::Load (%ux%u): %lld us\n", img.GetWidth(), img.GetHeight(), load);
+
+    // the view has to be inside a window (its size is needed to know what is visible)
+    auto wnd = Factory::Window::Create("Tiled image", "x:0,y:0,w:100%,h:100%", WindowFlags::None);
+    auto v   = Factory::ImageView::Create(wnd, "x:0,y:0,w:100%,h:100%");
+    Application::AddWindow(std::move(wnd));
+    Canvas canvas;
+    canvas.Resize(120, 40);
+    auto fit = Measure([&]() {
+        result = v->SetImage(std::move(img), ImageRenderingMethod::PixelTo16ColorsSmallBlock, 1.0);
+        result = result && v->ScaleToFit();
+    });
+    printf("ImageView fit to window (scale %f): %lld us\n", v->GetScale(), fit);
+    auto full = Measure([&]() { result = v->SetScale(1.0); });
+    printf("ImageView 1:1 (first screen): %lld us\n", full);
+    auto scroll = Measure([&]() {
+        for (uint32 tr = 0; tr < SCROLL_STEPS; tr++)
+        {
+            v->OnKeyEvent(Input::Key::Shift | Input::Key::Right, 0);
+            v->OnKeyEvent(Input::Key::Shift | Input::Key::Down, 0);
+            v->Paint(canvas);
+        }
+    });
+    printf("ImageView 1:1 scroll: %lld us per screen\n", scroll / SCROLL_STEPS);
+    auto zoom = Measure([&]() {
+        for (uint32 tr = 0; tr < SCROLL_STEPS; tr++)
+        {
+            v->SetScale(v->GetScale() / 1.25);
+            v->Paint(canvas);
+        }
+    });
+    printf("ImageView zoom out: %lld us per screen\n", zoom / SCROLL_STEPS);
+    return result ? 0 : 1;
+}